@@ -0,0 +1,378 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Measures the performance of frequently used vector, bitset and allocator operations.
+ */
+
+#include "Benchmark.h"
+#include <Zycore/Allocator.h>
+#include <Zycore/Bitset.h>
+#include <Zycore/LibC.h>
+#include <Zycore/SoAVector.h>
+#include <Zycore/Vector.h>
+
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+/**
+ * @brief   Keeps the compiler from removing computations whose results are not used otherwise.
+ */
+static volatile ZyanUSize benchmark_sink;
+
+/**
+ * @brief   The element that is copied into the vectors.
+ */
+static ZyanU8 benchmark_element[256 * 16];
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Vector                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Measures `ZyanVectorPush` on a vector that starts empty and grows on demand.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkVectorPush(BenchmarkContext* context)
+{
+    enum { COUNT = 4096 };
+
+    ZyanVector vector;
+    ZYAN_CHECK(ZyanVectorInit(&vector, context->parameter, 1));
+
+    BenchmarkStart(context);
+    for (ZyanUSize i = 0; i < COUNT; ++i)
+    {
+        ZYAN_CHECK(ZyanVectorPush(&vector, benchmark_element));
+    }
+    BenchmarkStop(context, COUNT);
+
+    return ZyanVectorDestroy(&vector);
+}
+
+/**
+ * @brief   Measures `ZyanVectorInsertElements` in the middle of a vector.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkVectorInsertElements(BenchmarkContext* context)
+{
+    enum { INITIAL = 1024, COUNT = 64, BATCH = 16 };
+
+    ZyanVector vector;
+    ZYAN_CHECK(ZyanVectorInit(&vector, context->parameter, INITIAL + COUNT * BATCH));
+    for (ZyanUSize i = 0; i < INITIAL; ++i)
+    {
+        ZYAN_CHECK(ZyanVectorPush(&vector, benchmark_element));
+    }
+
+    BenchmarkStart(context);
+    for (ZyanUSize i = 0; i < COUNT; ++i)
+    {
+        ZYAN_CHECK(ZyanVectorInsertElements(&vector, (INITIAL + i * BATCH) / 2,
+            benchmark_element, BATCH));
+    }
+    BenchmarkStop(context, COUNT);
+
+    return ZyanVectorDestroy(&vector);
+}
+
+/**
+ * @brief   Measures `ZyanVectorGetConst` by reading the first byte of every element.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkVectorGet(BenchmarkContext* context)
+{
+    enum { COUNT = 4096 };
+
+    ZyanVector vector;
+    ZYAN_CHECK(ZyanVectorInit(&vector, context->parameter, COUNT));
+    for (ZyanUSize i = 0; i < COUNT; ++i)
+    {
+        ZYAN_CHECK(ZyanVectorPush(&vector, benchmark_element));
+    }
+
+    BenchmarkStart(context);
+    ZyanUSize sum = 0;
+    for (ZyanUSize i = 0; i < COUNT; ++i)
+    {
+        const ZyanU8* element;
+        ZYAN_CHECK(ZyanVectorGetConst(&vector, i, (const void**)&element));
+        sum += *element;
+    }
+    benchmark_sink = sum;
+    BenchmarkStop(context, COUNT);
+
+    return ZyanVectorDestroy(&vector);
+}
+
+/**
+ * @brief   Measures `ZyanVectorGetConstUnchecked` by reading the first byte of every element.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkVectorGetUnchecked(BenchmarkContext* context)
+{
+    enum { COUNT = 4096 };
+
+    ZyanVector vector;
+    ZYAN_CHECK(ZyanVectorInit(&vector, context->parameter, COUNT));
+    for (ZyanUSize i = 0; i < COUNT; ++i)
+    {
+        ZYAN_CHECK(ZyanVectorPush(&vector, benchmark_element));
+    }
+
+    BenchmarkStart(context);
+    ZyanUSize sum = 0;
+    for (ZyanUSize i = 0; i < ZyanVectorSizeUnchecked(&vector); ++i)
+    {
+        sum += *(const ZyanU8*)ZyanVectorGetConstUnchecked(&vector, i);
+    }
+    benchmark_sink = sum;
+    BenchmarkStop(context, COUNT);
+
+    return ZyanVectorDestroy(&vector);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Struct-of-arrays vector                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   A 64 byte record of which the scan benchmarks only read the `key` field.
+ */
+typedef struct BenchmarkRecord_
+{
+    ZyanU32 key;
+    ZyanU8 payload[60];
+} BenchmarkRecord;
+
+/**
+ * @brief   Measures summing up the `key` field of all records stored in a `ZyanVector`.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkVectorScanField(BenchmarkContext* context)
+{
+    ZyanVector vector;
+    ZYAN_CHECK(ZyanVectorInit(&vector, sizeof(BenchmarkRecord), context->parameter));
+    BenchmarkRecord record;
+    ZYAN_MEMSET(&record, 0, sizeof(record));
+    for (ZyanUSize i = 0; i < context->parameter; ++i)
+    {
+        record.key = (ZyanU32)i;
+        ZYAN_CHECK(ZyanVectorPush(&vector, &record));
+    }
+
+    BenchmarkStart(context);
+    ZyanU64 sum = 0;
+    for (ZyanUSize i = 0; i < context->parameter; ++i)
+    {
+        sum += ((const BenchmarkRecord*)ZyanVectorGetConstUnchecked(&vector, i))->key;
+    }
+    benchmark_sink = (ZyanUSize)sum;
+    BenchmarkStop(context, context->parameter);
+
+    return ZyanVectorDestroy(&vector);
+}
+
+/**
+ * @brief   Measures summing up the `key` column of all records stored in a `ZyanSoAVector`.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkSoAVectorScanField(BenchmarkContext* context)
+{
+    static const ZyanSoAVectorField fields[] =
+    {
+        ZYAN_SOA_VECTOR_FIELD(BenchmarkRecord, key),
+        ZYAN_SOA_VECTOR_FIELD(BenchmarkRecord, payload)
+    };
+
+    ZyanSoAVector vector;
+    ZYAN_CHECK(ZyanSoAVectorInit(&vector, fields, ZYAN_ARRAY_LENGTH(fields),
+        sizeof(BenchmarkRecord), context->parameter));
+    BenchmarkRecord record;
+    ZYAN_MEMSET(&record, 0, sizeof(record));
+    for (ZyanUSize i = 0; i < context->parameter; ++i)
+    {
+        record.key = (ZyanU32)i;
+        ZYAN_CHECK(ZyanSoAVectorPush(&vector, &record));
+    }
+
+    BenchmarkStart(context);
+    const ZyanU32* const keys = (const ZyanU32*)ZyanSoAVectorGetColumnConstUnchecked(&vector, 0);
+    ZyanU64 sum = 0;
+    for (ZyanUSize i = 0; i < context->parameter; ++i)
+    {
+        sum += keys[i];
+    }
+    benchmark_sink = (ZyanUSize)sum;
+    BenchmarkStop(context, context->parameter);
+
+    return ZyanSoAVectorDestroy(&vector);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Bitset                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Measures `ZyanBitsetCount` on a bitset with every third bit set.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkBitsetCount(BenchmarkContext* context)
+{
+    ZyanBitset bitset;
+    ZYAN_CHECK(ZyanBitsetInit(&bitset, context->parameter));
+    for (ZyanUSize i = 0; i < context->parameter; i += 3)
+    {
+        ZYAN_CHECK(ZyanBitsetSet(&bitset, i));
+    }
+
+    // Amortize the timer overhead for small bitsets
+    const ZyanUSize count = ZYAN_MAX(1, 65536 / context->parameter);
+
+    BenchmarkStart(context);
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ZyanUSize bits;
+        ZYAN_CHECK(ZyanBitsetCount(&bitset, &bits));
+        benchmark_sink = bits;
+    }
+    BenchmarkStop(context, count);
+
+    return ZyanBitsetDestroy(&bitset);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocator                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Measures an allocation followed by a deallocation with the default allocator.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkAllocatorDefault(BenchmarkContext* context)
+{
+    enum { COUNT = 64 };
+
+    ZyanAllocator* const allocator = ZyanAllocatorDefault();
+    void* blocks[COUNT];
+
+    BenchmarkStart(context);
+    for (ZyanUSize i = 0; i < COUNT; ++i)
+    {
+        ZYAN_CHECK(allocator->allocate(allocator, &blocks[i], 1, context->parameter));
+    }
+    for (ZyanUSize i = 0; i < COUNT; ++i)
+    {
+        ZYAN_CHECK(allocator->deallocate(allocator, blocks[i], 1, context->parameter));
+    }
+    BenchmarkStop(context, COUNT);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Registry                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   The element sizes in bytes the vector benchmarks are executed with.
+ */
+static const ZyanUSize ELEMENT_SIZES[] = { 4, 16, 64, 256 };
+
+/**
+ * @brief   The number of records the scan benchmarks are executed with.
+ */
+static const ZyanUSize RECORD_COUNTS[] = { 1024, 65536, 1048576 };
+
+/**
+ * @brief   The number of bits the bitset benchmarks are executed with.
+ */
+static const ZyanUSize BIT_COUNTS[] = { 64, 4096, 65536, 1048576 };
+
+/**
+ * @brief   The block sizes in bytes the allocator benchmarks are executed with.
+ */
+static const ZyanUSize BLOCK_SIZES[] = { 16, 256, 4096, 65536 };
+
+/**
+ * @brief   Contains all benchmarks.
+ */
+static const BenchmarkDefinition BENCHMARKS[] =
+{
+    { "VectorPush"          , BenchmarkVectorPush          ,
+      ELEMENT_SIZES, ZYAN_ARRAY_LENGTH(ELEMENT_SIZES) },
+    { "VectorInsertElements", BenchmarkVectorInsertElements,
+      ELEMENT_SIZES, ZYAN_ARRAY_LENGTH(ELEMENT_SIZES) },
+    { "VectorGet"           , BenchmarkVectorGet           ,
+      ELEMENT_SIZES, ZYAN_ARRAY_LENGTH(ELEMENT_SIZES) },
+    { "VectorGetUnchecked"  , BenchmarkVectorGetUnchecked  ,
+      ELEMENT_SIZES, ZYAN_ARRAY_LENGTH(ELEMENT_SIZES) },
+    { "VectorScanField"     , BenchmarkVectorScanField     ,
+      RECORD_COUNTS, ZYAN_ARRAY_LENGTH(RECORD_COUNTS) },
+    { "SoAVectorScanField"  , BenchmarkSoAVectorScanField  ,
+      RECORD_COUNTS, ZYAN_ARRAY_LENGTH(RECORD_COUNTS) },
+    { "BitsetCount"         , BenchmarkBitsetCount         ,
+      BIT_COUNTS   , ZYAN_ARRAY_LENGTH(BIT_COUNTS)    },
+    { "AllocatorDefault"    , BenchmarkAllocatorDefault    ,
+      BLOCK_SIZES  , ZYAN_ARRAY_LENGTH(BLOCK_SIZES)   }
+};
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char** argv)
+{
+    return BenchmarkMain(argc, argv, BENCHMARKS, ZYAN_ARRAY_LENGTH(BENCHMARKS));
+}
+
+/* ============================================================================================== */
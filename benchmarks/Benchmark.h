@@ -0,0 +1,624 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Provides the timer, the statistics and the report formats shared by all benchmarks.
+ *
+ * Every benchmark is executed a number of times to warm up caches and branch predictors before
+ * the actual samples are recorded. A sample is the average number of timer ticks per operation
+ * of a single run. The results are reported as human readable table, CSV or JSON.
+ *
+ * On x86 the timer ticks are read from the time-stamp counter, on AArch64 from the virtual
+ * counter and on all other architectures from the monotonic system clock in nanoseconds. The tick
+ * rate is calibrated against the system clock on startup, so every result is additionally
+ * reported in nanoseconds.
+ *
+ * This header is shared by the C and the C++ benchmarks and must be included before any other
+ * header.
+ */
+
+#ifndef ZYCORE_BENCHMARK_H
+#define ZYCORE_BENCHMARK_H
+
+#if defined(__unix__) || defined(__APPLE__)
+#   define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Zycore/Defines.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#if defined(ZYAN_WINDOWS)
+#   include <windows.h>
+#else
+#   include <time.h>
+#endif
+#if defined(ZYAN_MSVC)
+#   include <intrin.h>
+#elif defined(ZYAN_X86) || defined(ZYAN_X64)
+#   include <x86intrin.h>
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `BenchmarkFormat` enum.
+ */
+typedef enum BenchmarkFormat_
+{
+    BENCHMARK_FORMAT_TEXT,
+    BENCHMARK_FORMAT_CSV,
+    BENCHMARK_FORMAT_JSON
+} BenchmarkFormat;
+
+/**
+ * @brief   Defines the `BenchmarkContext` struct that is passed to every benchmark function.
+ */
+typedef struct BenchmarkContext_
+{
+    /**
+     * @brief   The benchmark specific parameter (e.g. the element size).
+     */
+    ZyanUSize parameter;
+    /**
+     * @brief   The timestamp of the last call to `BenchmarkStart`.
+     */
+    ZyanU64 start;
+    /**
+     * @brief   The number of ticks spent in timed regions.
+     */
+    ZyanU64 ticks;
+    /**
+     * @brief   The number of operations that were executed in timed regions.
+     */
+    ZyanUSize operations;
+} BenchmarkContext;
+
+/**
+ * @brief   Defines the `BenchmarkFunction` function prototype.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ *
+ * Benchmarks that can not allocate the memory they need return `ZYAN_STATUS_NOT_ENOUGH_MEMORY`
+ * and are skipped.
+ */
+typedef ZyanStatus (*BenchmarkFunction)(BenchmarkContext* context);
+
+/**
+ * @brief   Defines the `BenchmarkDefinition` struct.
+ */
+typedef struct BenchmarkDefinition_
+{
+    /**
+     * @brief   The name of the benchmark.
+     */
+    const char* name;
+    /**
+     * @brief   The benchmark function.
+     */
+    BenchmarkFunction function;
+    /**
+     * @brief   The parameters the benchmark is executed with.
+     */
+    const ZyanUSize* parameters;
+    /**
+     * @brief   The number of parameters.
+     */
+    ZyanUSize parameter_count;
+} BenchmarkDefinition;
+
+/**
+ * @brief   Defines the `BenchmarkOptions` struct.
+ */
+typedef struct BenchmarkOptions_
+{
+    /**
+     * @brief   The output format.
+     */
+    BenchmarkFormat format;
+    /**
+     * @brief   Only benchmarks whose name contains this string are executed, if not `NULL`.
+     */
+    const char* filter;
+    /**
+     * @brief   The number of samples.
+     */
+    ZyanUSize samples;
+    /**
+     * @brief   The number of runs that are discarded before the samples are recorded.
+     */
+    ZyanUSize warmup;
+    /**
+     * @brief   Parameters above this value are skipped.
+     */
+    ZyanU64 max_parameter;
+    /**
+     * @brief   The time budget per benchmark and parameter in milliseconds.
+     */
+    ZyanU64 max_time;
+} BenchmarkOptions;
+
+/**
+ * @brief   Defines the `BenchmarkResult` struct.
+ */
+typedef struct BenchmarkResult_
+{
+    /**
+     * @brief   The number of operations per sample.
+     */
+    ZyanUSize operations;
+    /**
+     * @brief   The number of recorded samples.
+     */
+    ZyanUSize samples;
+    /**
+     * @brief   The fastest sample in ticks per operation.
+     */
+    double min;
+    /**
+     * @brief   The median sample in ticks per operation.
+     */
+    double median;
+    /**
+     * @brief   The 99th percentile in ticks per operation.
+     */
+    double p99;
+    /**
+     * @brief   The arithmetic mean in ticks per operation.
+     */
+    double mean;
+} BenchmarkResult;
+
+/* ============================================================================================== */
+/* Timer                                                                                          */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the current value of the monotonic system clock in nanoseconds.
+ *
+ * @return  The current value of the monotonic system clock in nanoseconds.
+ */
+ZYAN_INLINE ZyanU64 BenchmarkReadNanoseconds(void)
+{
+#if defined(ZYAN_WINDOWS)
+    LARGE_INTEGER counter;
+    LARGE_INTEGER frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    const ZyanU64 value = (ZyanU64)counter.QuadPart;
+    const ZyanU64 rate  = (ZyanU64)frequency.QuadPart;
+    return (value / rate) * 1000000000u + (value % rate) * 1000000000u / rate;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ZyanU64)ts.tv_sec * 1000000000u + (ZyanU64)ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief   Returns the name of the timer that is used by `BenchmarkReadTicks`.
+ *
+ * @return  The name of the timer.
+ */
+ZYAN_INLINE const char* BenchmarkGetTimerName(void)
+{
+#if defined(ZYAN_X86) || defined(ZYAN_X64)
+    return "tsc";
+#elif defined(ZYAN_AARCH64) && defined(ZYAN_GNUC)
+    return "cntvct";
+#else
+    return "monotonic";
+#endif
+}
+
+/**
+ * @brief   Returns the current value of the high resolution timer.
+ *
+ * @return  The current value of the high resolution timer.
+ *
+ * The time-stamp counter is fenced on both sides to keep the CPU from moving the measured code
+ * across the read.
+ */
+ZYAN_INLINE ZyanU64 BenchmarkReadTicks(void)
+{
+#if defined(ZYAN_X86) || defined(ZYAN_X64)
+    _mm_lfence();
+    const ZyanU64 ticks = __rdtsc();
+    _mm_lfence();
+    return ticks;
+#elif defined(ZYAN_AARCH64) && defined(ZYAN_GNUC)
+    ZyanU64 ticks;
+    __asm__ __volatile__("isb\n\tmrs %0, cntvct_el0" : "=r"(ticks) :: "memory");
+    return ticks;
+#else
+    return BenchmarkReadNanoseconds();
+#endif
+}
+
+/**
+ * @brief   Measures the number of timer ticks per nanosecond.
+ *
+ * @return  The number of timer ticks per nanosecond.
+ */
+ZYAN_INLINE double BenchmarkCalibrateTicks(void)
+{
+    const ZyanU64 ns_begin = BenchmarkReadNanoseconds();
+    const ZyanU64 ticks_begin = BenchmarkReadTicks();
+    ZyanU64 ns_end;
+    do
+    {
+        ns_end = BenchmarkReadNanoseconds();
+    } while (ns_end - ns_begin < 50000000u);
+    const ZyanU64 ticks_end = BenchmarkReadTicks();
+
+    return (double)(ticks_end - ticks_begin) / (double)(ns_end - ns_begin);
+}
+
+/**
+ * @brief   Starts a timed region.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ */
+ZYAN_INLINE void BenchmarkStart(BenchmarkContext* context)
+{
+    context->start = BenchmarkReadTicks();
+}
+
+/**
+ * @brief   Ends a timed region.
+ *
+ * @param   context     A pointer to the `BenchmarkContext` struct.
+ * @param   operations  The number of operations that were executed in the timed region.
+ */
+ZYAN_INLINE void BenchmarkStop(BenchmarkContext* context, ZyanUSize operations)
+{
+    context->ticks += BenchmarkReadTicks() - context->start;
+    context->operations += operations;
+}
+
+/**
+ * @brief   Forces the compiler to assume that the memory behind `p` is read and modified.
+ *
+ * @param   p   A pointer to the memory.
+ *
+ * This keeps loops that repeat an idempotent operation from being collapsed into one iteration.
+ */
+ZYAN_INLINE void BenchmarkEscape(const void* p)
+{
+#if defined(ZYAN_GNUC)
+    __asm__ __volatile__("" : : "g"(p) : "memory");
+#elif defined(ZYAN_MSVC)
+    ZYAN_UNUSED(p);
+    _ReadWriteBarrier();
+#else
+    ZYAN_UNUSED(p);
+#endif
+}
+
+/* ============================================================================================== */
+/* Driver                                                                                         */
+/* ============================================================================================== */
+
+/**
+ * @brief   Compares two `double` values for `qsort`.
+ */
+ZYAN_INLINE int BenchmarkCompareDouble(const void* left, const void* right)
+{
+    const double l = *(const double*)left;
+    const double r = *(const double*)right;
+    return (l > r) - (l < r);
+}
+
+/**
+ * @brief   Executes a single run of the given benchmark.
+ *
+ * @param   function    The benchmark function.
+ * @param   parameter   The benchmark parameter.
+ * @param   sample      Receives the number of ticks per operation.
+ * @param   operations  Receives the number of operations.
+ *
+ * @return  A zycore status code.
+ */
+ZYAN_INLINE ZyanStatus BenchmarkRunOnce(BenchmarkFunction function, ZyanUSize parameter,
+    double* sample, ZyanUSize* operations)
+{
+    BenchmarkContext context;
+    context.parameter  = parameter;
+    context.start      = 0;
+    context.ticks      = 0;
+    context.operations = 0;
+    ZYAN_CHECK(function(&context));
+
+    *sample     = (double)context.ticks / (double)ZYAN_MAX(context.operations, 1);
+    *operations = context.operations;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Executes the given benchmark and computes the statistics.
+ *
+ * @param   function    The benchmark function.
+ * @param   parameter   The benchmark parameter.
+ * @param   options     A pointer to the `BenchmarkOptions` struct.
+ * @param   samples     A buffer that receives up to `options->samples` samples.
+ * @param   result      Receives the statistics.
+ *
+ * @return  A zycore status code.
+ *
+ * Benchmarks whose runs would exceed the time budget are executed with less warmup runs and
+ * samples, but at least three samples are recorded.
+ */
+ZYAN_INLINE ZyanStatus BenchmarkRun(BenchmarkFunction function, ZyanUSize parameter,
+    const BenchmarkOptions* options, double* samples, BenchmarkResult* result)
+{
+    ZyanUSize warmup = options->warmup;
+    ZyanUSize count  = options->samples;
+
+    // The first run is always discarded and used to estimate the duration of a single run
+    const ZyanU64 begin = BenchmarkReadNanoseconds();
+    ZYAN_CHECK(BenchmarkRunOnce(function, parameter, &samples[0], &result->operations));
+    const ZyanU64 duration = ZYAN_MAX(BenchmarkReadNanoseconds() - begin, 1);
+    const ZyanU64 budget = options->max_time * 1000000u / duration;
+    if (warmup + count > budget)
+    {
+        warmup = 0;
+        count  = (ZyanUSize)ZYAN_MIN(count, ZYAN_MAX(budget, 3));
+    }
+
+    for (ZyanUSize i = 1; i < warmup; ++i)
+    {
+        ZYAN_CHECK(BenchmarkRunOnce(function, parameter, &samples[0], &result->operations));
+    }
+    double sum = 0;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ZYAN_CHECK(BenchmarkRunOnce(function, parameter, &samples[i], &result->operations));
+        sum += samples[i];
+    }
+    qsort(samples, count, sizeof(double), &BenchmarkCompareDouble);
+
+    // Nearest-rank percentiles
+    result->samples = count;
+    result->min     = samples[0];
+    result->median  = samples[count / 2];
+    result->p99     = samples[(count * 99 + 99) / 100 - 1];
+    result->mean    = sum / (double)count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Prints the header of the report.
+ *
+ * @param   options         A pointer to the `BenchmarkOptions` struct.
+ * @param   ticks_per_ns    The number of timer ticks per nanosecond.
+ */
+ZYAN_INLINE void BenchmarkPrintHeader(const BenchmarkOptions* options, double ticks_per_ns)
+{
+    switch (options->format)
+    {
+    case BENCHMARK_FORMAT_TEXT:
+        printf("timer: %s (%.3f ticks/ns), warmup: %zu, samples: %zu\n\n",
+            BenchmarkGetTimerName(), ticks_per_ns, options->warmup, options->samples);
+        printf("%-32s %10s %12s %12s %12s %12s %12s\n", "benchmark", "param", "min", "median",
+            "p99", "mean", "median [ns]");
+        break;
+    case BENCHMARK_FORMAT_CSV:
+        puts("benchmark,param,operations,samples,min_ticks,median_ticks,p99_ticks,mean_ticks,"
+            "median_ns,p99_ns");
+        break;
+    case BENCHMARK_FORMAT_JSON:
+        printf("{\n  \"timer\": \"%s\",\n  \"ticks_per_ns\": %.6f,\n  \"warmup\": %zu,\n"
+            "  \"samples\": %zu,\n  \"benchmarks\": [", BenchmarkGetTimerName(), ticks_per_ns,
+            options->warmup, options->samples);
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * @brief   Prints a single result.
+ *
+ * @param   options         A pointer to the `BenchmarkOptions` struct.
+ * @param   name            The name of the benchmark.
+ * @param   parameter       The benchmark parameter.
+ * @param   result          A pointer to the `BenchmarkResult` struct.
+ * @param   ticks_per_ns    The number of timer ticks per nanosecond.
+ * @param   first           `ZYAN_TRUE`, if this is the first result.
+ */
+ZYAN_INLINE void BenchmarkPrintResult(const BenchmarkOptions* options, const char* name,
+    ZyanUSize parameter, const BenchmarkResult* result, double ticks_per_ns, ZyanBool first)
+{
+    switch (options->format)
+    {
+    case BENCHMARK_FORMAT_TEXT:
+        printf("%-32s %10zu %12.2f %12.2f %12.2f %12.2f %12.2f\n", name, parameter, result->min,
+            result->median, result->p99, result->mean, result->median / ticks_per_ns);
+        break;
+    case BENCHMARK_FORMAT_CSV:
+        printf("%s,%zu,%zu,%zu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n", name, parameter,
+            result->operations, result->samples, result->min, result->median, result->p99,
+            result->mean, result->median / ticks_per_ns, result->p99 / ticks_per_ns);
+        break;
+    case BENCHMARK_FORMAT_JSON:
+        printf("%s\n    {\"name\": \"%s\", \"param\": %zu, \"operations\": %zu, "
+            "\"samples\": %zu, \"min_ticks\": %.3f, \"median_ticks\": %.3f, "
+            "\"p99_ticks\": %.3f, \"mean_ticks\": %.3f, \"median_ns\": %.3f, \"p99_ns\": %.3f}",
+            first ? "" : ",", name, parameter, result->operations, result->samples, result->min,
+            result->median, result->p99, result->mean, result->median / ticks_per_ns,
+            result->p99 / ticks_per_ns);
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * @brief   Parses the command line arguments.
+ *
+ * @param   argc    The number of arguments.
+ * @param   argv    The arguments.
+ * @param   options Receives the options.
+ *
+ * @return  `ZYAN_TRUE`, if all arguments are valid or `ZYAN_FALSE`, if not.
+ */
+ZYAN_INLINE ZyanBool BenchmarkParseArguments(int argc, char** argv, BenchmarkOptions* options)
+{
+    options->format        = BENCHMARK_FORMAT_TEXT;
+    options->filter        = NULL;
+    options->samples       = 101;
+    options->warmup        = 10;
+    options->max_parameter = (ZyanU64)-1;
+    options->max_time      = 2000;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* const arg = argv[i];
+        if (!strcmp(arg, "--format=text"))
+        {
+            options->format = BENCHMARK_FORMAT_TEXT;
+        } else if (!strcmp(arg, "--format=csv"))
+        {
+            options->format = BENCHMARK_FORMAT_CSV;
+        } else if (!strcmp(arg, "--format=json"))
+        {
+            options->format = BENCHMARK_FORMAT_JSON;
+        } else if (!strncmp(arg, "--filter=", 9))
+        {
+            options->filter = arg + 9;
+        } else if (!strncmp(arg, "--samples=", 10) && (strtoul(arg + 10, NULL, 10) > 0))
+        {
+            options->samples = (ZyanUSize)strtoul(arg + 10, NULL, 10);
+        } else if (!strncmp(arg, "--warmup=", 9))
+        {
+            options->warmup = (ZyanUSize)strtoul(arg + 9, NULL, 10);
+        } else if (!strncmp(arg, "--max-param=", 12))
+        {
+            options->max_parameter = (ZyanU64)strtoull(arg + 12, NULL, 10);
+        } else if (!strncmp(arg, "--max-time=", 11))
+        {
+            options->max_time = (ZyanU64)strtoull(arg + 11, NULL, 10);
+        } else
+        {
+            printf("Usage: %s [--format=text|csv|json] [--filter=<substring>] [--samples=<n>] "
+                "[--warmup=<n>] [--max-param=<n>] [--max-time=<ms>]\n", argv[0]);
+            return ZYAN_FALSE;
+        }
+    }
+
+    return ZYAN_TRUE;
+}
+
+/**
+ * @brief   Executes all given benchmarks and prints the report.
+ *
+ * @param   argc        The number of command line arguments.
+ * @param   argv        The command line arguments.
+ * @param   benchmarks  The benchmark definitions.
+ * @param   count       The number of benchmark definitions.
+ *
+ * @return  The exit code of the program.
+ */
+ZYAN_INLINE int BenchmarkMain(int argc, char** argv, const BenchmarkDefinition* benchmarks,
+    ZyanUSize count)
+{
+    BenchmarkOptions options;
+    if (!BenchmarkParseArguments(argc, argv, &options))
+    {
+        return EXIT_FAILURE;
+    }
+
+    double* const samples = (double*)malloc(options.samples * sizeof(double));
+    if (!samples)
+    {
+        return EXIT_FAILURE;
+    }
+
+    const double ticks_per_ns = BenchmarkCalibrateTicks();
+    BenchmarkPrintHeader(&options, ticks_per_ns);
+
+    ZyanBool first = ZYAN_TRUE;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        const BenchmarkDefinition* const definition = &benchmarks[i];
+        if (options.filter && !strstr(definition->name, options.filter))
+        {
+            continue;
+        }
+
+        for (ZyanUSize j = 0; j < definition->parameter_count; ++j)
+        {
+            const ZyanUSize parameter = definition->parameters[j];
+            if (parameter > options.max_parameter)
+            {
+                continue;
+            }
+
+            BenchmarkResult result;
+            const ZyanStatus status =
+                BenchmarkRun(definition->function, parameter, &options, samples, &result);
+            if (status == ZYAN_STATUS_NOT_ENOUGH_MEMORY)
+            {
+                fprintf(stderr, "%s/%zu skipped: not enough memory\n", definition->name,
+                    parameter);
+                continue;
+            }
+            if (!ZYAN_SUCCESS(status))
+            {
+                fprintf(stderr, "%s/%zu failed with status 0x%08X\n", definition->name,
+                    parameter, status);
+                free(samples);
+                return EXIT_FAILURE;
+            }
+            BenchmarkPrintResult(&options, definition->name, parameter, &result, ticks_per_ns,
+                first);
+            fflush(stdout);
+            first = ZYAN_FALSE;
+        }
+    }
+
+    if (options.format == BENCHMARK_FORMAT_JSON)
+    {
+        puts("\n  ]\n}");
+    }
+
+    free(samples);
+    return EXIT_SUCCESS;
+}
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_BENCHMARK_H */
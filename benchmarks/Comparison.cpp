@@ -0,0 +1,807 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Compares Zycore containers and the `ZYCORE_NO_LIBC` fallbacks against the C++ standard
+ *          library, raw arrays and the C library.
+ *
+ * The parameter of every benchmark is the size of the processed data in bytes. Results are
+ * reported per element, bit or byte, so rows with the same parameter are directly comparable.
+ */
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <bitset>
+#include <new>
+#include <vector>
+
+extern "C"
+{
+#include <Zycore/Bitset.h>
+#include <Zycore/Vector.h>
+
+void* FallbackMemcpy(void* dst, const void* src, ZyanUSize n);
+void* FallbackMemset(void* dst, int val, ZyanUSize n);
+ZyanUSize FallbackStrlen(const char* str);
+}
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Keeps the compiler from removing computations whose results are not used otherwise.
+ */
+static volatile ZyanUSize benchmark_sink;
+
+/**
+ * @brief   Returns how often an idempotent operation on `bytes` bytes is repeated per run to
+ *          amortize the timer overhead.
+ *
+ * @param   bytes   The number of bytes that are processed by a single repetition.
+ *
+ * @return  The number of repetitions.
+ */
+static ZyanUSize GetRepetitions(ZyanUSize bytes)
+{
+    return ZYAN_MAX(1, (1u << 20) / bytes);
+}
+
+/**
+ * @brief   Returns the number of 32 bit elements that fit into `bytes` bytes.
+ *
+ * @param   bytes   The number of bytes.
+ *
+ * @return  The number of elements.
+ */
+static ZyanUSize GetElementCount(ZyanUSize bytes)
+{
+    return ZYAN_MAX(1, bytes / sizeof(ZyanU32));
+}
+
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Vector push                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Measures `ZyanVectorPush` of 32 bit elements on a vector that starts with a single slot.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkPushZyanVector(BenchmarkContext* context)
+{
+    const ZyanUSize count = GetElementCount(context->parameter);
+
+    ZyanVector vector;
+    ZYAN_CHECK(ZyanVectorInit(&vector, sizeof(ZyanU32), 1));
+
+    BenchmarkStart(context);
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        const ZyanU32 value = (ZyanU32)i;
+        const ZyanStatus status = ZyanVectorPush(&vector, &value);
+        if (!ZYAN_SUCCESS(status))
+        {
+            ZyanVectorDestroy(&vector);
+            return status;
+        }
+    }
+    BenchmarkStop(context, count);
+
+    return ZyanVectorDestroy(&vector);
+}
+
+/**
+ * @brief   Measures `std::vector::push_back` of 32 bit elements on an empty vector.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkPushStdVector(BenchmarkContext* context)
+{
+    const ZyanUSize count = GetElementCount(context->parameter);
+
+    try
+    {
+        std::vector<ZyanU32> vector;
+
+        BenchmarkStart(context);
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            vector.push_back((ZyanU32)i);
+        }
+        BenchmarkStop(context, count);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Measures stores of 32 bit elements into a preallocated raw array as the lower bound.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkPushArray(BenchmarkContext* context)
+{
+    const ZyanUSize count = GetElementCount(context->parameter);
+
+    ZyanU32* const array = (ZyanU32*)malloc(count * sizeof(ZyanU32));
+    if (!array)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    BenchmarkStart(context);
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        array[i] = (ZyanU32)i;
+    }
+    BenchmarkStop(context, count);
+
+    benchmark_sink = array[count - 1];
+    free(array);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Vector read                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Measures `ZyanVectorGetConst` by summing all 32 bit elements of a vector.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkReadZyanVector(BenchmarkContext* context)
+{
+    const ZyanUSize count = GetElementCount(context->parameter);
+    const ZyanUSize repetitions = GetRepetitions(context->parameter);
+
+    ZyanVector vector;
+    ZYAN_CHECK(ZyanVectorInit(&vector, sizeof(ZyanU32), count));
+    ZyanStatus status = ZyanVectorResize(&vector, count);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanVectorDestroy(&vector);
+        return status;
+    }
+
+    BenchmarkStart(context);
+    ZyanUSize sum = 0;
+    for (ZyanUSize r = 0; r < repetitions; ++r)
+    {
+        BenchmarkEscape(vector.data);
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            const void* element;
+            ZYAN_CHECK(ZyanVectorGetConst(&vector, i, &element));
+            sum += *(const ZyanU32*)element;
+        }
+    }
+    BenchmarkStop(context, count * repetitions);
+
+    benchmark_sink = sum;
+    return ZyanVectorDestroy(&vector);
+}
+
+/**
+ * @brief   Measures `std::vector::operator[]` by summing all 32 bit elements of a vector.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkReadStdVector(BenchmarkContext* context)
+{
+    const ZyanUSize count = GetElementCount(context->parameter);
+    const ZyanUSize repetitions = GetRepetitions(context->parameter);
+
+    try
+    {
+        const std::vector<ZyanU32> vector(count);
+
+        BenchmarkStart(context);
+        ZyanUSize sum = 0;
+        for (ZyanUSize r = 0; r < repetitions; ++r)
+        {
+            BenchmarkEscape(vector.data());
+            for (ZyanUSize i = 0; i < count; ++i)
+            {
+                sum += vector[i];
+            }
+        }
+        BenchmarkStop(context, count * repetitions);
+
+        benchmark_sink = sum;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Measures summing all 32 bit elements of a raw array as the lower bound.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkReadArray(BenchmarkContext* context)
+{
+    const ZyanUSize count = GetElementCount(context->parameter);
+    const ZyanUSize repetitions = GetRepetitions(context->parameter);
+
+    ZyanU32* const array = (ZyanU32*)calloc(count, sizeof(ZyanU32));
+    if (!array)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    BenchmarkStart(context);
+    ZyanUSize sum = 0;
+    for (ZyanUSize r = 0; r < repetitions; ++r)
+    {
+        BenchmarkEscape(array);
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            sum += array[i];
+        }
+    }
+    BenchmarkStop(context, count * repetitions);
+
+    benchmark_sink = sum;
+    free(array);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Bitset set                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Measures `ZyanBitsetSet` by setting every bit of the bitset.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkSetZyanBitset(BenchmarkContext* context)
+{
+    const ZyanUSize bits = context->parameter * 8;
+
+    ZyanBitset bitset;
+    ZYAN_CHECK(ZyanBitsetInit(&bitset, bits));
+
+    BenchmarkStart(context);
+    for (ZyanUSize i = 0; i < bits; ++i)
+    {
+        ZYAN_CHECK(ZyanBitsetSet(&bitset, i));
+    }
+    BenchmarkStop(context, bits);
+
+    return ZyanBitsetDestroy(&bitset);
+}
+
+/**
+ * @brief   Measures setting every bit of a `std::vector<bool>`.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkSetStdVectorBool(BenchmarkContext* context)
+{
+    const ZyanUSize bits = context->parameter * 8;
+
+    try
+    {
+        std::vector<bool> bitset(bits);
+
+        BenchmarkStart(context);
+        for (ZyanUSize i = 0; i < bits; ++i)
+        {
+            bitset[i] = true;
+        }
+        BenchmarkStop(context, bits);
+
+        benchmark_sink = bitset[bits - 1];
+    }
+    catch (const std::bad_alloc&)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Measures `std::bitset::set` by setting every bit of a bitset with `Bits` bits.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ *
+ * The bitset is allocated on the heap, as the larger instantiations exceed the stack size.
+ */
+template <ZyanUSize Bits>
+static ZyanStatus BenchmarkSetStdBitsetN(BenchmarkContext* context)
+{
+    std::bitset<Bits>* const bitset = new (std::nothrow) std::bitset<Bits>();
+    if (!bitset)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    BenchmarkStart(context);
+    for (ZyanUSize i = 0; i < Bits; ++i)
+    {
+        bitset->set(i);
+    }
+    BenchmarkStop(context, Bits);
+
+    benchmark_sink = (*bitset)[Bits - 1];
+    delete bitset;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Dispatches to the `std::bitset` instantiation that matches `context->parameter`.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkSetStdBitset(BenchmarkContext* context)
+{
+    switch (context->parameter)
+    {
+    case        16: return BenchmarkSetStdBitsetN<       16 * 8>(context);
+    case       256: return BenchmarkSetStdBitsetN<      256 * 8>(context);
+    case      4096: return BenchmarkSetStdBitsetN<     4096 * 8>(context);
+    case     65536: return BenchmarkSetStdBitsetN<    65536 * 8>(context);
+    case   1048576: return BenchmarkSetStdBitsetN<  1048576 * 8>(context);
+    case  16777216: return BenchmarkSetStdBitsetN< 16777216 * 8>(context);
+    default:
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Bitset count                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Measures `ZyanBitsetCount` on a bitset with every third bit set.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkCountZyanBitset(BenchmarkContext* context)
+{
+    const ZyanUSize bits = context->parameter * 8;
+    const ZyanUSize repetitions = GetRepetitions(context->parameter);
+
+    ZyanBitset bitset;
+    ZYAN_CHECK(ZyanBitsetInit(&bitset, bits));
+    for (ZyanUSize i = 0; i < bits; i += 3)
+    {
+        ZYAN_CHECK(ZyanBitsetSet(&bitset, i));
+    }
+
+    BenchmarkStart(context);
+    for (ZyanUSize r = 0; r < repetitions; ++r)
+    {
+        ZyanUSize count;
+        ZYAN_CHECK(ZyanBitsetCount(&bitset, &count));
+        benchmark_sink = count;
+    }
+    BenchmarkStop(context, bits * repetitions);
+
+    return ZyanBitsetDestroy(&bitset);
+}
+
+/**
+ * @brief   Measures `std::count` on a `std::vector<bool>` with every third bit set.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkCountStdVectorBool(BenchmarkContext* context)
+{
+    const ZyanUSize bits = context->parameter * 8;
+    const ZyanUSize repetitions = GetRepetitions(context->parameter);
+
+    try
+    {
+        std::vector<bool> bitset(bits);
+        for (ZyanUSize i = 0; i < bits; i += 3)
+        {
+            bitset[i] = true;
+        }
+
+        BenchmarkStart(context);
+        for (ZyanUSize r = 0; r < repetitions; ++r)
+        {
+            BenchmarkEscape(&bitset);
+            benchmark_sink = (ZyanUSize)std::count(bitset.begin(), bitset.end(), true);
+        }
+        BenchmarkStop(context, bits * repetitions);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Measures `std::bitset::count` on a bitset with `Bits` bits and every third bit set.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+template <ZyanUSize Bits>
+static ZyanStatus BenchmarkCountStdBitsetN(BenchmarkContext* context)
+{
+    const ZyanUSize repetitions = GetRepetitions(Bits / 8);
+
+    std::bitset<Bits>* const bitset = new (std::nothrow) std::bitset<Bits>();
+    if (!bitset)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    for (ZyanUSize i = 0; i < Bits; i += 3)
+    {
+        bitset->set(i);
+    }
+
+    BenchmarkStart(context);
+    for (ZyanUSize r = 0; r < repetitions; ++r)
+    {
+        BenchmarkEscape(bitset);
+        benchmark_sink = bitset->count();
+    }
+    BenchmarkStop(context, Bits * repetitions);
+
+    delete bitset;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Dispatches to the `std::bitset` instantiation that matches `context->parameter`.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkCountStdBitset(BenchmarkContext* context)
+{
+    switch (context->parameter)
+    {
+    case        16: return BenchmarkCountStdBitsetN<       16 * 8>(context);
+    case       256: return BenchmarkCountStdBitsetN<      256 * 8>(context);
+    case      4096: return BenchmarkCountStdBitsetN<     4096 * 8>(context);
+    case     65536: return BenchmarkCountStdBitsetN<    65536 * 8>(context);
+    case   1048576: return BenchmarkCountStdBitsetN<  1048576 * 8>(context);
+    case  16777216: return BenchmarkCountStdBitsetN< 16777216 * 8>(context);
+    default:
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory and string functions                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Defines the `MemoryFunction` function prototype that wraps a `LibC.h` function.
+ *
+ * @param   dst     The destination buffer.
+ * @param   src     The source buffer (a zero terminated string of `n - 1` characters).
+ * @param   n       The size of both buffers in bytes.
+ */
+typedef void (*MemoryFunction)(void* dst, const void* src, ZyanUSize n);
+
+/**
+ * @brief   Copies `src` to `dst` using the C library `memcpy`.
+ *
+ * @param   dst     The destination buffer.
+ * @param   src     The source buffer.
+ * @param   n       The size of both buffers in bytes.
+ */
+static void MemcpyLibC(void* dst, const void* src, ZyanUSize n)
+{
+    memcpy(dst, src, n);
+}
+
+/**
+ * @brief   Copies `src` to `dst` using the `ZYCORE_NO_LIBC` fallback of `ZYAN_MEMCPY`.
+ *
+ * @param   dst     The destination buffer.
+ * @param   src     The source buffer.
+ * @param   n       The size of both buffers in bytes.
+ */
+static void MemcpyFallback(void* dst, const void* src, ZyanUSize n)
+{
+    FallbackMemcpy(dst, src, n);
+}
+
+/**
+ * @brief   Fills `dst` using the C library `memset`.
+ *
+ * @param   dst     The destination buffer.
+ * @param   src     The source buffer.
+ * @param   n       The size of both buffers in bytes.
+ */
+static void MemsetLibC(void* dst, const void* src, ZyanUSize n)
+{
+    ZYAN_UNUSED(src);
+    memset(dst, 0x5A, n);
+}
+
+/**
+ * @brief   Fills `dst` using the `ZYCORE_NO_LIBC` fallback of `ZYAN_MEMSET`.
+ *
+ * @param   dst     The destination buffer.
+ * @param   src     The source buffer.
+ * @param   n       The size of both buffers in bytes.
+ */
+static void MemsetFallback(void* dst, const void* src, ZyanUSize n)
+{
+    ZYAN_UNUSED(src);
+    FallbackMemset(dst, 0x5A, n);
+}
+
+/**
+ * @brief   Determines the length of `src` using the C library `strlen`.
+ *
+ * @param   dst     The destination buffer.
+ * @param   src     The source buffer.
+ * @param   n       The size of both buffers in bytes.
+ */
+static void StrlenLibC(void* dst, const void* src, ZyanUSize n)
+{
+    ZYAN_UNUSED(dst);
+    ZYAN_UNUSED(n);
+    benchmark_sink = strlen((const char*)src);
+}
+
+/**
+ * @brief   Determines the length of `src` using the `ZYCORE_NO_LIBC` fallback of `ZYAN_STRLEN`.
+ *
+ * @param   dst     The destination buffer.
+ * @param   src     The source buffer.
+ * @param   n       The size of both buffers in bytes.
+ */
+static void StrlenFallback(void* dst, const void* src, ZyanUSize n)
+{
+    ZYAN_UNUSED(dst);
+    ZYAN_UNUSED(n);
+    benchmark_sink = FallbackStrlen((const char*)src);
+}
+
+/**
+ * @brief   Measures the given memory function on two buffers of `context->parameter` bytes.
+ *
+ * @param   context     A pointer to the `BenchmarkContext` struct.
+ * @param   function    The memory function.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkMemoryFunction(BenchmarkContext* context, MemoryFunction function)
+{
+    const ZyanUSize n = context->parameter;
+    const ZyanUSize repetitions = GetRepetitions(n);
+
+    char* const dst = (char*)malloc(n);
+    char* const src = (char*)malloc(n);
+    if (!dst || !src)
+    {
+        free(dst);
+        free(src);
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    memset(dst, 0, n);
+    memset(src, 'z', n - 1);
+    src[n - 1] = '\0';
+
+    BenchmarkStart(context);
+    for (ZyanUSize r = 0; r < repetitions; ++r)
+    {
+        BenchmarkEscape(dst);
+        function(dst, src, n);
+    }
+    BenchmarkStop(context, n * repetitions);
+
+    benchmark_sink = (ZyanUSize)dst[n - 1];
+    free(dst);
+    free(src);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Measures the C library `memcpy`.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkMemcpyLibC(BenchmarkContext* context)
+{
+    return BenchmarkMemoryFunction(context, &MemcpyLibC);
+}
+
+/**
+ * @brief   Measures the `ZYCORE_NO_LIBC` fallback of `ZYAN_MEMCPY`.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkMemcpyFallback(BenchmarkContext* context)
+{
+    return BenchmarkMemoryFunction(context, &MemcpyFallback);
+}
+
+/**
+ * @brief   Measures the C library `memset`.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkMemsetLibC(BenchmarkContext* context)
+{
+    return BenchmarkMemoryFunction(context, &MemsetLibC);
+}
+
+/**
+ * @brief   Measures the `ZYCORE_NO_LIBC` fallback of `ZYAN_MEMSET`.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkMemsetFallback(BenchmarkContext* context)
+{
+    return BenchmarkMemoryFunction(context, &MemsetFallback);
+}
+
+/**
+ * @brief   Measures the C library `strlen`.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkStrlenLibC(BenchmarkContext* context)
+{
+    return BenchmarkMemoryFunction(context, &StrlenLibC);
+}
+
+/**
+ * @brief   Measures the `ZYCORE_NO_LIBC` fallback of `ZYAN_STRLEN`.
+ *
+ * @param   context A pointer to the `BenchmarkContext` struct.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus BenchmarkStrlenFallback(BenchmarkContext* context)
+{
+    return BenchmarkMemoryFunction(context, &StrlenFallback);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Registry                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   The data sizes in bytes all benchmarks are executed with.
+ */
+static const ZyanUSize SIZES[] =
+{
+    16, 256, 4096, 65536, 1048576, 16777216, 268435456, 1073741824
+};
+
+/**
+ * @brief   The data sizes in bytes the `std::bitset` benchmarks are executed with.
+ *
+ * Larger instantiations of `std::bitset` bloat the executable without adding information.
+ */
+static const ZyanUSize STD_BITSET_SIZES[] =
+{
+    16, 256, 4096, 65536, 1048576, 16777216
+};
+
+#define BENCHMARK_DEFINE(name, function, sizes) \
+    { name, function, sizes, ZYAN_ARRAY_LENGTH(sizes) }
+
+/**
+ * @brief   Contains all benchmarks.
+ */
+static const BenchmarkDefinition BENCHMARKS[] =
+{
+    BENCHMARK_DEFINE("Push/ZyanVector"        , BenchmarkPushZyanVector    , SIZES           ),
+    BENCHMARK_DEFINE("Push/std::vector"       , BenchmarkPushStdVector     , SIZES           ),
+    BENCHMARK_DEFINE("Push/array"             , BenchmarkPushArray         , SIZES           ),
+    BENCHMARK_DEFINE("Read/ZyanVector"        , BenchmarkReadZyanVector    , SIZES           ),
+    BENCHMARK_DEFINE("Read/std::vector"       , BenchmarkReadStdVector     , SIZES           ),
+    BENCHMARK_DEFINE("Read/array"             , BenchmarkReadArray         , SIZES           ),
+    BENCHMARK_DEFINE("BitSet/ZyanBitset"      , BenchmarkSetZyanBitset     , SIZES           ),
+    BENCHMARK_DEFINE("BitSet/std::vector<bool>", BenchmarkSetStdVectorBool , SIZES           ),
+    BENCHMARK_DEFINE("BitSet/std::bitset"     , BenchmarkSetStdBitset      , STD_BITSET_SIZES),
+    BENCHMARK_DEFINE("BitCount/ZyanBitset"    , BenchmarkCountZyanBitset   , SIZES           ),
+    BENCHMARK_DEFINE("BitCount/std::vector<bool>", BenchmarkCountStdVectorBool, SIZES        ),
+    BENCHMARK_DEFINE("BitCount/std::bitset"   , BenchmarkCountStdBitset    , STD_BITSET_SIZES),
+    BENCHMARK_DEFINE("Memcpy/libc"            , BenchmarkMemcpyLibC        , SIZES           ),
+    BENCHMARK_DEFINE("Memcpy/fallback"        , BenchmarkMemcpyFallback    , SIZES           ),
+    BENCHMARK_DEFINE("Memset/libc"            , BenchmarkMemsetLibC        , SIZES           ),
+    BENCHMARK_DEFINE("Memset/fallback"        , BenchmarkMemsetFallback    , SIZES           ),
+    BENCHMARK_DEFINE("Strlen/libc"            , BenchmarkStrlenLibC        , SIZES           ),
+    BENCHMARK_DEFINE("Strlen/fallback"        , BenchmarkStrlenFallback    , SIZES           )
+};
+
+#undef BENCHMARK_DEFINE
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char** argv)
+{
+    return BenchmarkMain(argc, argv, BENCHMARKS, ZYAN_ARRAY_LENGTH(BENCHMARKS));
+}
+
+/* ============================================================================================== */
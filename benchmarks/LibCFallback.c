@@ -0,0 +1,85 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Exposes the `ZYCORE_NO_LIBC` fallbacks of `LibC.h` to the comparative benchmark.
+ *
+ * This translation unit is compiled without loop idiom recognition, as the fallbacks would be
+ * replaced by calls to the C library otherwise.
+ */
+
+#ifndef ZYCORE_NO_LIBC
+#   define ZYCORE_NO_LIBC
+#endif
+
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   Copies `n` bytes from `src` to `dst` using the fallback of `ZYAN_MEMCPY`.
+ *
+ * @param   dst     The destination buffer.
+ * @param   src     The source buffer.
+ * @param   n       The number of bytes to copy.
+ *
+ * @return  `dst`.
+ */
+void* FallbackMemcpy(void* dst, const void* src, ZyanUSize n)
+{
+    return ZYAN_MEMCPY(dst, src, n);
+}
+
+/**
+ * @brief   Fills `n` bytes of `dst` with `val` using the fallback of `ZYAN_MEMSET`.
+ *
+ * @param   dst     The destination buffer.
+ * @param   val     The fill value.
+ * @param   n       The number of bytes to fill.
+ *
+ * @return  `dst`.
+ */
+void* FallbackMemset(void* dst, int val, ZyanUSize n)
+{
+    return ZYAN_MEMSET(dst, val, n);
+}
+
+/**
+ * @brief   Returns the length of `str` using the fallback of `ZYAN_STRLEN`.
+ *
+ * @param   str     The zero terminated string.
+ *
+ * @return  The number of characters before the terminator.
+ */
+ZyanUSize FallbackStrlen(const char* str)
+{
+    return ZYAN_STRLEN(str);
+}
+
+/* ============================================================================================== */
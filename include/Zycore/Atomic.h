@@ -0,0 +1,884 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Provides portable atomic operations with explicit memory ordering.
+ *
+ * The operations map to the `__atomic` builtins on GCC and Clang, to the `Interlocked` intrinsics
+ * on MSVC and to C11 `<stdatomic.h>` on other compilers. None of the backends depends on the C
+ * runtime.
+ */
+
+#ifndef ZYCORE_ATOMIC_H
+#define ZYCORE_ATOMIC_H
+
+#include <Zycore/Defines.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Backend selection                                                                              */
+/* ============================================================================================== */
+
+#if defined(ZYAN_GNUC)
+#   define ZYAN_ATOMIC_GNUC
+#elif defined(ZYAN_MSVC)
+#   define ZYAN_ATOMIC_MSVC
+#   include <intrin.h>
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#   define ZYAN_ATOMIC_C11
+#   include <stdatomic.h>
+#else
+#   error "Atomic operations are not supported by this compiler"
+#endif
+
+#if defined(ZYAN_ATOMIC_C11)
+#   define ZYAN_ATOMIC_TYPE(type) _Atomic(type)
+#elif defined(ZYAN_ATOMIC_MSVC)
+#   define ZYAN_ATOMIC_TYPE(type) volatile type
+#else
+#   define ZYAN_ATOMIC_TYPE(type) type
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanMemoryOrder` enum.
+ *
+ * The values correspond to the C11 memory orders of the same name.
+ */
+typedef enum ZyanMemoryOrder_
+{
+    /**
+     * @brief   Only guarantees atomicity, but no ordering with respect to other memory accesses.
+     */
+    ZYAN_MEMORY_ORDER_RELAXED,
+    /**
+     * @brief   No memory access of the current thread can be reordered before this load.
+     */
+    ZYAN_MEMORY_ORDER_ACQUIRE,
+    /**
+     * @brief   No memory access of the current thread can be reordered after this store.
+     */
+    ZYAN_MEMORY_ORDER_RELEASE,
+    /**
+     * @brief   Combines `ZYAN_MEMORY_ORDER_ACQUIRE` and `ZYAN_MEMORY_ORDER_RELEASE` for
+     *          read-modify-write operations.
+     */
+    ZYAN_MEMORY_ORDER_ACQ_REL,
+    /**
+     * @brief   Like `ZYAN_MEMORY_ORDER_ACQ_REL`, plus a single total order of all sequentially
+     *          consistent operations.
+     */
+    ZYAN_MEMORY_ORDER_SEQ_CST,
+
+    /**
+     * @brief   Maximum value of this enum.
+     */
+    ZYAN_MEMORY_ORDER_MAX_VALUE = ZYAN_MEMORY_ORDER_SEQ_CST,
+    /**
+     * @brief   The minimum number of bits required to represent all values of this enum.
+     */
+    ZYAN_MEMORY_ORDER_REQUIRED_BITS = ZYAN_BITS_TO_REPRESENT(ZYAN_MEMORY_ORDER_MAX_VALUE)
+} ZyanMemoryOrder;
+
+/**
+ * @brief   Defines the `ZyanAtomic32` struct.
+ *
+ * The value should only be accessed by the `ZyanAtomic*32` functions.
+ */
+typedef struct ZyanAtomic32_
+{
+    /**
+     * @brief   The value.
+     */
+    ZYAN_ATOMIC_TYPE(ZyanU32) value;
+} ZyanAtomic32;
+
+/**
+ * @brief   Defines the `ZyanAtomic64` struct.
+ *
+ * The value should only be accessed by the `ZyanAtomic*64` functions. The struct is always
+ * aligned to 8 bytes, as some 32-bit ABIs would only align 64-bit integers to 4 bytes, which
+ * breaks atomicity.
+ */
+#if defined(ZYAN_ATOMIC_MSVC)
+typedef struct __declspec(align(8)) ZyanAtomic64_
+#else
+typedef struct ZyanAtomic64_
+#endif
+{
+    /**
+     * @brief   The value.
+     */
+#if defined(ZYAN_ATOMIC_GNUC)
+    ZYAN_ATOMIC_TYPE(ZyanU64) value __attribute__((aligned(8)));
+#else
+    ZYAN_ATOMIC_TYPE(ZyanU64) value;
+#endif
+} ZyanAtomic64;
+
+/**
+ * @brief   Defines the `ZyanAtomicPointer` struct.
+ *
+ * The value should only be accessed by the `ZyanAtomic*Pointer` functions.
+ */
+typedef struct ZyanAtomicPointer_
+{
+    /**
+     * @brief   The value.
+     */
+#if defined(ZYAN_ATOMIC_C11)
+    _Atomic(void*) value;
+#elif defined(ZYAN_ATOMIC_MSVC)
+    void* volatile value;
+#else
+    void* value;
+#endif
+} ZyanAtomicPointer;
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/**
+ * @brief   Statically initializes an atomic variable.
+ *
+ * @param   value   The initial value.
+ */
+#define ZYAN_ATOMIC_INIT(value) { (value) }
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+#if defined(ZYAN_ATOMIC_GNUC)
+
+/**
+ * @brief   Converts the given memory order to the corresponding `__ATOMIC_*` value.
+ *
+ * @param   order   The memory order.
+ *
+ * @return  The `__ATOMIC_*` value.
+ *
+ * Calls with constant arguments are folded at compile time.
+ */
+ZYAN_INLINE int ZyanAtomicMapOrder(ZyanMemoryOrder order)
+{
+    switch (order)
+    {
+    case ZYAN_MEMORY_ORDER_RELAXED:
+        return __ATOMIC_RELAXED;
+    case ZYAN_MEMORY_ORDER_ACQUIRE:
+        return __ATOMIC_ACQUIRE;
+    case ZYAN_MEMORY_ORDER_RELEASE:
+        return __ATOMIC_RELEASE;
+    case ZYAN_MEMORY_ORDER_ACQ_REL:
+        return __ATOMIC_ACQ_REL;
+    default:
+        return __ATOMIC_SEQ_CST;
+    }
+}
+
+#   define ZYAN_ATOMIC_IMPL_LOAD(p, o)         __atomic_load_n(p, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_STORE(p, v, o)     __atomic_store_n(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_EXCHANGE(p, v, o)  __atomic_exchange_n(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_CAS(p, e, d, s, f) \
+        __atomic_compare_exchange_n(p, e, d, 0, ZyanAtomicMapOrder(s), ZyanAtomicMapOrder(f))
+#   define ZYAN_ATOMIC_IMPL_FETCH_ADD(p, v, o) __atomic_fetch_add(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_FETCH_SUB(p, v, o) __atomic_fetch_sub(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_FETCH_AND(p, v, o) __atomic_fetch_and(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_FETCH_OR(p, v, o)  __atomic_fetch_or(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_FENCE(o)           __atomic_thread_fence(ZyanAtomicMapOrder(o))
+
+#elif defined(ZYAN_ATOMIC_C11)
+
+/**
+ * @brief   Converts the given memory order to the corresponding C11 `memory_order` value.
+ *
+ * @param   order   The memory order.
+ *
+ * @return  The `memory_order` value.
+ */
+ZYAN_INLINE memory_order ZyanAtomicMapOrder(ZyanMemoryOrder order)
+{
+    switch (order)
+    {
+    case ZYAN_MEMORY_ORDER_RELAXED:
+        return memory_order_relaxed;
+    case ZYAN_MEMORY_ORDER_ACQUIRE:
+        return memory_order_acquire;
+    case ZYAN_MEMORY_ORDER_RELEASE:
+        return memory_order_release;
+    case ZYAN_MEMORY_ORDER_ACQ_REL:
+        return memory_order_acq_rel;
+    default:
+        return memory_order_seq_cst;
+    }
+}
+
+#   define ZYAN_ATOMIC_IMPL_LOAD(p, o) \
+        atomic_load_explicit(p, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_STORE(p, v, o) \
+        atomic_store_explicit(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_EXCHANGE(p, v, o) \
+        atomic_exchange_explicit(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_CAS(p, e, d, s, f) \
+        atomic_compare_exchange_strong_explicit(p, e, d, ZyanAtomicMapOrder(s), \
+            ZyanAtomicMapOrder(f))
+#   define ZYAN_ATOMIC_IMPL_FETCH_ADD(p, v, o) \
+        atomic_fetch_add_explicit(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_FETCH_SUB(p, v, o) \
+        atomic_fetch_sub_explicit(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_FETCH_AND(p, v, o) \
+        atomic_fetch_and_explicit(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_FETCH_OR(p, v, o) \
+        atomic_fetch_or_explicit(p, v, ZyanAtomicMapOrder(o))
+#   define ZYAN_ATOMIC_IMPL_FENCE(o) \
+        atomic_thread_fence(ZyanAtomicMapOrder(o))
+
+#elif defined(ZYAN_ATOMIC_MSVC)
+
+/**
+ * @brief   Emits a memory barrier for the given memory order.
+ *
+ * @param   order   The memory order.
+ *
+ * x86 and x64 only reorder stores after later loads, so all orders but `ZYAN_MEMORY_ORDER_SEQ_CST`
+ * only require a compiler barrier. ARM requires a hardware barrier for every non-relaxed order.
+ */
+ZYAN_INLINE void ZyanAtomicMsvcFence(ZyanMemoryOrder order)
+{
+    if (order == ZYAN_MEMORY_ORDER_RELAXED)
+    {
+        return;
+    }
+#if defined(ZYAN_X86) || defined(ZYAN_X64)
+    if (order == ZYAN_MEMORY_ORDER_SEQ_CST)
+    {
+        _mm_mfence();
+    }
+    _ReadWriteBarrier();
+#elif defined(ZYAN_AARCH64)
+    __dmb(_ARM64_BARRIER_ISH);
+#else
+    __dmb(_ARM_BARRIER_ISH);
+#endif
+}
+
+#endif
+
+/* ============================================================================================== */
+/* Functions                                                                                      */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* 32-bit                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Atomically loads the value of the given variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic32` instance.
+ * @param   order   The memory order (`RELAXED`, `ACQUIRE` or `SEQ_CST`).
+ *
+ * @return  The value.
+ */
+ZYAN_INLINE ZyanU32 ZyanAtomicLoad32(const ZyanAtomic32* atomic, ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    const ZyanU32 value = atomic->value;
+    ZyanAtomicMsvcFence(order == ZYAN_MEMORY_ORDER_SEQ_CST ? ZYAN_MEMORY_ORDER_ACQUIRE : order);
+    return value;
+#elif defined(ZYAN_ATOMIC_C11)
+    return ZYAN_ATOMIC_IMPL_LOAD((ZYAN_ATOMIC_TYPE(ZyanU32)*)&atomic->value, order);
+#else
+    return ZYAN_ATOMIC_IMPL_LOAD(&atomic->value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically stores a value to the given variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic32` instance.
+ * @param   value   The value.
+ * @param   order   The memory order (`RELAXED`, `RELEASE` or `SEQ_CST`).
+ */
+ZYAN_INLINE void ZyanAtomicStore32(ZyanAtomic32* atomic, ZyanU32 value, ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    if (order == ZYAN_MEMORY_ORDER_SEQ_CST)
+    {
+        _InterlockedExchange((volatile long*)&atomic->value, (long)value);
+        return;
+    }
+    ZyanAtomicMsvcFence(order);
+    atomic->value = value;
+#else
+    ZYAN_ATOMIC_IMPL_STORE(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically replaces the value of the given variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic32` instance.
+ * @param   value   The new value.
+ * @param   order   The memory order.
+ *
+ * @return  The previous value.
+ */
+ZYAN_INLINE ZyanU32 ZyanAtomicExchange32(ZyanAtomic32* atomic, ZyanU32 value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(order);
+    return (ZyanU32)_InterlockedExchange((volatile long*)&atomic->value, (long)value);
+#else
+    return ZYAN_ATOMIC_IMPL_EXCHANGE(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically replaces the value of the given variable, if it equals `*expected`.
+ *
+ * @param   atomic          A pointer to the `ZyanAtomic32` instance.
+ * @param   expected        A pointer to the expected value. Receives the actual value, if the
+ *                          comparison fails.
+ * @param   desired         The new value.
+ * @param   success_order   The memory order, if the value was replaced.
+ * @param   failure_order   The memory order, if the value was not replaced (`RELAXED`, `ACQUIRE`
+ *                          or `SEQ_CST` and not stronger than `success_order`).
+ *
+ * @return  `ZYAN_TRUE`, if the value was replaced or `ZYAN_FALSE`, if not.
+ */
+ZYAN_INLINE ZyanBool ZyanAtomicCompareExchange32(ZyanAtomic32* atomic, ZyanU32* expected,
+    ZyanU32 desired, ZyanMemoryOrder success_order, ZyanMemoryOrder failure_order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(success_order);
+    ZYAN_UNUSED(failure_order);
+    const ZyanU32 previous = (ZyanU32)_InterlockedCompareExchange(
+        (volatile long*)&atomic->value, (long)desired, (long)*expected);
+    if (previous == *expected)
+    {
+        return ZYAN_TRUE;
+    }
+    *expected = previous;
+    return ZYAN_FALSE;
+#else
+    return ZYAN_ATOMIC_IMPL_CAS(&atomic->value, expected, desired, success_order, failure_order)
+        ? ZYAN_TRUE : ZYAN_FALSE;
+#endif
+}
+
+/**
+ * @brief   Atomically adds a value to the given variable (wrapping on overflow).
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic32` instance.
+ * @param   value   The value to add.
+ * @param   order   The memory order.
+ *
+ * @return  The previous value.
+ */
+ZYAN_INLINE ZyanU32 ZyanAtomicFetchAdd32(ZyanAtomic32* atomic, ZyanU32 value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(order);
+    return (ZyanU32)_InterlockedExchangeAdd((volatile long*)&atomic->value, (long)value);
+#else
+    return ZYAN_ATOMIC_IMPL_FETCH_ADD(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically subtracts a value from the given variable (wrapping on overflow).
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic32` instance.
+ * @param   value   The value to subtract.
+ * @param   order   The memory order.
+ *
+ * @return  The previous value.
+ */
+ZYAN_INLINE ZyanU32 ZyanAtomicFetchSub32(ZyanAtomic32* atomic, ZyanU32 value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(order);
+    return (ZyanU32)_InterlockedExchangeAdd((volatile long*)&atomic->value, -(long)value);
+#else
+    return ZYAN_ATOMIC_IMPL_FETCH_SUB(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically performs a bitwise AND on the given variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic32` instance.
+ * @param   value   The operand.
+ * @param   order   The memory order.
+ *
+ * @return  The previous value.
+ */
+ZYAN_INLINE ZyanU32 ZyanAtomicFetchAnd32(ZyanAtomic32* atomic, ZyanU32 value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(order);
+    return (ZyanU32)_InterlockedAnd((volatile long*)&atomic->value, (long)value);
+#else
+    return ZYAN_ATOMIC_IMPL_FETCH_AND(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically performs a bitwise OR on the given variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic32` instance.
+ * @param   value   The operand.
+ * @param   order   The memory order.
+ *
+ * @return  The previous value.
+ */
+ZYAN_INLINE ZyanU32 ZyanAtomicFetchOr32(ZyanAtomic32* atomic, ZyanU32 value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(order);
+    return (ZyanU32)_InterlockedOr((volatile long*)&atomic->value, (long)value);
+#else
+    return ZYAN_ATOMIC_IMPL_FETCH_OR(&atomic->value, value, order);
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* 64-bit                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+#if defined(ZYAN_ATOMIC_MSVC) && defined(ZYAN_X86)
+
+/**
+ * @brief   Atomically replaces the value of the given variable with the result of an operation.
+ *
+ * @param   atomic      A pointer to the `ZyanAtomic64` instance.
+ * @param   operation   The operation (`0` = exchange, `1` = add, `2` = and, `3` = or).
+ * @param   value       The operand.
+ *
+ * @return  The previous value.
+ *
+ * 32-bit x86 only provides a 64-bit compare-exchange, so all other 64-bit read-modify-write
+ * operations are emulated on top of it.
+ */
+ZYAN_INLINE ZyanU64 ZyanAtomicMsvcUpdate64(ZyanAtomic64* atomic, int operation, ZyanU64 value)
+{
+    ZyanU64 previous = (ZyanU64)_InterlockedCompareExchange64((volatile __int64*)&atomic->value,
+        0, 0);
+    for (;;)
+    {
+        ZyanU64 desired;
+        switch (operation)
+        {
+        case 1:
+            desired = previous + value;
+            break;
+        case 2:
+            desired = previous & value;
+            break;
+        case 3:
+            desired = previous | value;
+            break;
+        default:
+            desired = value;
+            break;
+        }
+        const ZyanU64 actual = (ZyanU64)_InterlockedCompareExchange64(
+            (volatile __int64*)&atomic->value, (__int64)desired, (__int64)previous);
+        if (actual == previous)
+        {
+            return previous;
+        }
+        previous = actual;
+    }
+}
+
+#endif
+
+/**
+ * @brief   Atomically loads the value of the given variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic64` instance.
+ * @param   order   The memory order (`RELAXED`, `ACQUIRE` or `SEQ_CST`).
+ *
+ * @return  The value.
+ */
+ZYAN_INLINE ZyanU64 ZyanAtomicLoad64(const ZyanAtomic64* atomic, ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC) && defined(ZYAN_X86)
+    ZYAN_UNUSED(order);
+    return (ZyanU64)_InterlockedCompareExchange64((volatile __int64*)&atomic->value, 0, 0);
+#elif defined(ZYAN_ATOMIC_MSVC)
+    const ZyanU64 value = atomic->value;
+    ZyanAtomicMsvcFence(order == ZYAN_MEMORY_ORDER_SEQ_CST ? ZYAN_MEMORY_ORDER_ACQUIRE : order);
+    return value;
+#elif defined(ZYAN_ATOMIC_C11)
+    return ZYAN_ATOMIC_IMPL_LOAD((ZYAN_ATOMIC_TYPE(ZyanU64)*)&atomic->value, order);
+#else
+    return ZYAN_ATOMIC_IMPL_LOAD(&atomic->value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically stores a value to the given variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic64` instance.
+ * @param   value   The value.
+ * @param   order   The memory order (`RELAXED`, `RELEASE` or `SEQ_CST`).
+ */
+ZYAN_INLINE void ZyanAtomicStore64(ZyanAtomic64* atomic, ZyanU64 value, ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC) && defined(ZYAN_X86)
+    ZYAN_UNUSED(order);
+    ZyanAtomicMsvcUpdate64(atomic, 0, value);
+#elif defined(ZYAN_ATOMIC_MSVC)
+    if (order == ZYAN_MEMORY_ORDER_SEQ_CST)
+    {
+        _InterlockedExchange64((volatile __int64*)&atomic->value, (__int64)value);
+        return;
+    }
+    ZyanAtomicMsvcFence(order);
+    atomic->value = value;
+#else
+    ZYAN_ATOMIC_IMPL_STORE(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically replaces the value of the given variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic64` instance.
+ * @param   value   The new value.
+ * @param   order   The memory order.
+ *
+ * @return  The previous value.
+ */
+ZYAN_INLINE ZyanU64 ZyanAtomicExchange64(ZyanAtomic64* atomic, ZyanU64 value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC) && defined(ZYAN_X86)
+    ZYAN_UNUSED(order);
+    return ZyanAtomicMsvcUpdate64(atomic, 0, value);
+#elif defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(order);
+    return (ZyanU64)_InterlockedExchange64((volatile __int64*)&atomic->value, (__int64)value);
+#else
+    return ZYAN_ATOMIC_IMPL_EXCHANGE(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically replaces the value of the given variable, if it equals `*expected`.
+ *
+ * @param   atomic          A pointer to the `ZyanAtomic64` instance.
+ * @param   expected        A pointer to the expected value. Receives the actual value, if the
+ *                          comparison fails.
+ * @param   desired         The new value.
+ * @param   success_order   The memory order, if the value was replaced.
+ * @param   failure_order   The memory order, if the value was not replaced (`RELAXED`, `ACQUIRE`
+ *                          or `SEQ_CST` and not stronger than `success_order`).
+ *
+ * @return  `ZYAN_TRUE`, if the value was replaced or `ZYAN_FALSE`, if not.
+ */
+ZYAN_INLINE ZyanBool ZyanAtomicCompareExchange64(ZyanAtomic64* atomic, ZyanU64* expected,
+    ZyanU64 desired, ZyanMemoryOrder success_order, ZyanMemoryOrder failure_order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(success_order);
+    ZYAN_UNUSED(failure_order);
+    const ZyanU64 previous = (ZyanU64)_InterlockedCompareExchange64(
+        (volatile __int64*)&atomic->value, (__int64)desired, (__int64)*expected);
+    if (previous == *expected)
+    {
+        return ZYAN_TRUE;
+    }
+    *expected = previous;
+    return ZYAN_FALSE;
+#else
+    return ZYAN_ATOMIC_IMPL_CAS(&atomic->value, expected, desired, success_order, failure_order)
+        ? ZYAN_TRUE : ZYAN_FALSE;
+#endif
+}
+
+/**
+ * @brief   Atomically adds a value to the given variable (wrapping on overflow).
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic64` instance.
+ * @param   value   The value to add.
+ * @param   order   The memory order.
+ *
+ * @return  The previous value.
+ */
+ZYAN_INLINE ZyanU64 ZyanAtomicFetchAdd64(ZyanAtomic64* atomic, ZyanU64 value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC) && defined(ZYAN_X86)
+    ZYAN_UNUSED(order);
+    return ZyanAtomicMsvcUpdate64(atomic, 1, value);
+#elif defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(order);
+    return (ZyanU64)_InterlockedExchangeAdd64((volatile __int64*)&atomic->value, (__int64)value);
+#else
+    return ZYAN_ATOMIC_IMPL_FETCH_ADD(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically subtracts a value from the given variable (wrapping on overflow).
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic64` instance.
+ * @param   value   The value to subtract.
+ * @param   order   The memory order.
+ *
+ * @return  The previous value.
+ */
+ZYAN_INLINE ZyanU64 ZyanAtomicFetchSub64(ZyanAtomic64* atomic, ZyanU64 value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    return ZyanAtomicFetchAdd64(atomic, (ZyanU64)0 - value, order);
+#else
+    return ZYAN_ATOMIC_IMPL_FETCH_SUB(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically performs a bitwise AND on the given variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic64` instance.
+ * @param   value   The operand.
+ * @param   order   The memory order.
+ *
+ * @return  The previous value.
+ */
+ZYAN_INLINE ZyanU64 ZyanAtomicFetchAnd64(ZyanAtomic64* atomic, ZyanU64 value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC) && defined(ZYAN_X86)
+    ZYAN_UNUSED(order);
+    return ZyanAtomicMsvcUpdate64(atomic, 2, value);
+#elif defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(order);
+    return (ZyanU64)_InterlockedAnd64((volatile __int64*)&atomic->value, (__int64)value);
+#else
+    return ZYAN_ATOMIC_IMPL_FETCH_AND(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically performs a bitwise OR on the given variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomic64` instance.
+ * @param   value   The operand.
+ * @param   order   The memory order.
+ *
+ * @return  The previous value.
+ */
+ZYAN_INLINE ZyanU64 ZyanAtomicFetchOr64(ZyanAtomic64* atomic, ZyanU64 value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC) && defined(ZYAN_X86)
+    ZYAN_UNUSED(order);
+    return ZyanAtomicMsvcUpdate64(atomic, 3, value);
+#elif defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(order);
+    return (ZyanU64)_InterlockedOr64((volatile __int64*)&atomic->value, (__int64)value);
+#else
+    return ZYAN_ATOMIC_IMPL_FETCH_OR(&atomic->value, value, order);
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Pointer                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Atomically loads the value of the given pointer variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomicPointer` instance.
+ * @param   order   The memory order (`RELAXED`, `ACQUIRE` or `SEQ_CST`).
+ *
+ * @return  The value.
+ */
+ZYAN_INLINE void* ZyanAtomicLoadPointer(const ZyanAtomicPointer* atomic, ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    void* const value = atomic->value;
+    ZyanAtomicMsvcFence(order == ZYAN_MEMORY_ORDER_SEQ_CST ? ZYAN_MEMORY_ORDER_ACQUIRE : order);
+    return value;
+#elif defined(ZYAN_ATOMIC_C11)
+    return ZYAN_ATOMIC_IMPL_LOAD((_Atomic(void*)*)&atomic->value, order);
+#else
+    return ZYAN_ATOMIC_IMPL_LOAD(&atomic->value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically stores a value to the given pointer variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomicPointer` instance.
+ * @param   value   The value.
+ * @param   order   The memory order (`RELAXED`, `RELEASE` or `SEQ_CST`).
+ */
+ZYAN_INLINE void ZyanAtomicStorePointer(ZyanAtomicPointer* atomic, void* value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    if (order == ZYAN_MEMORY_ORDER_SEQ_CST)
+    {
+        _InterlockedExchangePointer((void* volatile*)&atomic->value, value);
+        return;
+    }
+    ZyanAtomicMsvcFence(order);
+    atomic->value = value;
+#else
+    ZYAN_ATOMIC_IMPL_STORE(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically replaces the value of the given pointer variable.
+ *
+ * @param   atomic  A pointer to the `ZyanAtomicPointer` instance.
+ * @param   value   The new value.
+ * @param   order   The memory order.
+ *
+ * @return  The previous value.
+ */
+ZYAN_INLINE void* ZyanAtomicExchangePointer(ZyanAtomicPointer* atomic, void* value,
+    ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(order);
+    return _InterlockedExchangePointer((void* volatile*)&atomic->value, value);
+#else
+    return ZYAN_ATOMIC_IMPL_EXCHANGE(&atomic->value, value, order);
+#endif
+}
+
+/**
+ * @brief   Atomically replaces the value of the given pointer variable, if it equals
+ *          `*expected`.
+ *
+ * @param   atomic          A pointer to the `ZyanAtomicPointer` instance.
+ * @param   expected        A pointer to the expected value. Receives the actual value, if the
+ *                          comparison fails.
+ * @param   desired         The new value.
+ * @param   success_order   The memory order, if the value was replaced.
+ * @param   failure_order   The memory order, if the value was not replaced (`RELAXED`, `ACQUIRE`
+ *                          or `SEQ_CST` and not stronger than `success_order`).
+ *
+ * @return  `ZYAN_TRUE`, if the value was replaced or `ZYAN_FALSE`, if not.
+ */
+ZYAN_INLINE ZyanBool ZyanAtomicCompareExchangePointer(ZyanAtomicPointer* atomic, void** expected,
+    void* desired, ZyanMemoryOrder success_order, ZyanMemoryOrder failure_order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    ZYAN_UNUSED(success_order);
+    ZYAN_UNUSED(failure_order);
+    void* const previous = _InterlockedCompareExchangePointer((void* volatile*)&atomic->value,
+        desired, *expected);
+    if (previous == *expected)
+    {
+        return ZYAN_TRUE;
+    }
+    *expected = previous;
+    return ZYAN_FALSE;
+#else
+    return ZYAN_ATOMIC_IMPL_CAS(&atomic->value, expected, desired, success_order, failure_order)
+        ? ZYAN_TRUE : ZYAN_FALSE;
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Fences and hints                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Emits a memory fence.
+ *
+ * @param   order   The memory order.
+ */
+ZYAN_INLINE void ZyanAtomicThreadFence(ZyanMemoryOrder order)
+{
+#if defined(ZYAN_ATOMIC_MSVC)
+    ZyanAtomicMsvcFence(order);
+#else
+    ZYAN_ATOMIC_IMPL_FENCE(order);
+#endif
+}
+
+/**
+ * @brief   Signals the CPU that the current thread is spinning in a busy-wait loop.
+ *
+ * This reduces power consumption and frees execution resources for a sibling hyper-thread. It
+ * does not yield to the operating system scheduler.
+ */
+ZYAN_INLINE void ZyanAtomicPause(void)
+{
+#if defined(ZYAN_ATOMIC_MSVC) && (defined(ZYAN_X86) || defined(ZYAN_X64))
+    _mm_pause();
+#elif defined(ZYAN_ATOMIC_MSVC)
+    __yield();
+#elif defined(ZYAN_GNUC) && (defined(ZYAN_X86) || defined(ZYAN_X64))
+    __builtin_ia32_pause();
+#elif defined(ZYAN_GNUC) && (defined(ZYAN_AARCH64) || defined(ZYAN_ARM))
+    __asm__ __volatile__("yield" ::: "memory");
+#elif defined(ZYAN_GNUC)
+    __asm__ __volatile__("" ::: "memory");
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#undef ZYAN_ATOMIC_IMPL_LOAD
+#undef ZYAN_ATOMIC_IMPL_STORE
+#undef ZYAN_ATOMIC_IMPL_EXCHANGE
+#undef ZYAN_ATOMIC_IMPL_CAS
+#undef ZYAN_ATOMIC_IMPL_FETCH_ADD
+#undef ZYAN_ATOMIC_IMPL_FETCH_SUB
+#undef ZYAN_ATOMIC_IMPL_FETCH_AND
+#undef ZYAN_ATOMIC_IMPL_FETCH_OR
+#undef ZYAN_ATOMIC_IMPL_FENCE
+#undef ZYAN_ATOMIC_TYPE
+#undef ZYAN_ATOMIC_GNUC
+#undef ZYAN_ATOMIC_MSVC
+#undef ZYAN_ATOMIC_C11
+
+#endif /* ZYCORE_ATOMIC_H */
@@ -0,0 +1,347 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements the B+-tree ordered map container class.
+ */
+
+#ifndef ZYCORE_BTREE_H
+#define ZYCORE_BTREE_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Comparison.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanBTree` struct.
+ *
+ * The tree maps fixed-size keys to fixed-size values and keeps the keys ordered by a user defined
+ * `ZyanComparison` function. All entries are stored in leaf nodes that are linked together, which
+ * allows for efficient in-order iteration and range scans. The keys of every node are stored in a
+ * single contiguous array to keep in-node searches cache friendly.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanBTree_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The comparison function for the keys.
+     */
+    ZyanComparison comparison;
+    /**
+     * @brief   The size of a single key in bytes.
+     */
+    ZyanUSize key_size;
+    /**
+     * @brief   The size of a single value in bytes.
+     */
+    ZyanUSize value_size;
+    /**
+     * @brief   The size of a single node in bytes.
+     */
+    ZyanUSize node_size;
+    /**
+     * @brief   The maximum number of entries per leaf node.
+     */
+    ZyanUSize leaf_capacity;
+    /**
+     * @brief   The maximum number of keys per inner node.
+     */
+    ZyanUSize inner_capacity;
+    /**
+     * @brief   The offset of the value array inside a leaf node.
+     */
+    ZyanUSize leaf_values_offset;
+    /**
+     * @brief   The offset of the key array inside an inner node.
+     */
+    ZyanUSize inner_keys_offset;
+    /**
+     * @brief   The root node or `ZYAN_NULL`, if the tree is empty.
+     */
+    void* root;
+    /**
+     * @brief   The number of entries in the tree.
+     */
+    ZyanUSize size;
+} ZyanBTree;
+
+/**
+ * @brief   Defines the `ZyanBTreeIterator` struct.
+ *
+ * An iterator is invalidated by any modification of the tree.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanBTreeIterator_
+{
+    /**
+     * @brief   A pointer to the `ZyanBTree` instance.
+     */
+    const ZyanBTree* tree;
+    /**
+     * @brief   The current leaf node or `ZYAN_NULL`, if the iterator reached the end of the tree.
+     */
+    void* node;
+    /**
+     * @brief   The index of the current entry inside the leaf node.
+     */
+    ZyanUSize index;
+} ZyanBTreeIterator;
+
+/**
+ * @brief   Defines the `ZyanBTreeCallback` function.
+ *
+ * @param   key         A pointer to the key of the current entry.
+ * @param   value       A pointer to the value of the current entry.
+ * @param   user_data   The user data pointer.
+ *
+ * @return  A zycore status code. Return `ZYAN_STATUS_FALSE` to stop the iteration early or a
+ *          failure status code to abort it.
+ */
+typedef ZyanStatus (*ZyanBTreeCallback)(const void* key, void* value, void* user_data);
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanBTree` instance.
+ *
+ * @param   tree        A pointer to the `ZyanBTree` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes.
+ * @param   comparison  The comparison function for the keys.
+ *
+ * @return  A zycore status code.
+ *
+ * The nodes are allocated by the default allocator. The default node size of `512` bytes spans
+ * eight cache lines on most platforms. It is increased automatically, if required to fit at least
+ * four entries into each node.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeInit(ZyanBTree* tree, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanComparison comparison);
+
+/**
+ * @brief   Initializes the given `ZyanBTree` instance and sets a custom node size and
+ *          `allocator`.
+ *
+ * @param   tree        A pointer to the `ZyanBTree` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes.
+ * @param   comparison  The comparison function for the keys.
+ * @param   node_size   The size of a single node in bytes. Pass a multiple of the cache line size
+ *                      for in-memory workloads or the page size for huge trees.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeInitEx(ZyanBTree* tree, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanComparison comparison, ZyanUSize node_size,
+    ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanBTree` instance.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeDestroy(ZyanBTree* tree);
+
+/**
+ * @brief   Fills an empty `ZyanBTree` instance with the entries of a sorted `ZyanVector`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   entries A pointer to the `ZyanVector` instance. Every element consists of a key that is
+ *                  directly followed by its value. The keys must be sorted in strictly ascending
+ *                  order.
+ *
+ * @return  A zycore status code.
+ *
+ * The tree is built bottom-up in `O(n)` time, which is significantly faster than inserting the
+ * entries one by one. All nodes are filled to their capacity.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeBulkLoad(ZyanBTree* tree, const ZyanVector* entries);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Looks up the value for the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a pointer to the value, if the key was found.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the key was found or `ZYAN_STATUS_FALSE`, if not. Another zycore
+ *          status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeGet(const ZyanBTree* tree, const void* key, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Inserts or updates the entry for the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   A pointer to the value.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeInsert(ZyanBTree* tree, const void* key, const void* value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Removes the entry for the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the entry was removed or `ZYAN_STATUS_FALSE`, if the key was not
+ *          found. Another zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeRemove(ZyanBTree* tree, const void* key);
+
+/**
+ * @brief   Removes all entries of the given tree.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeClear(ZyanBTree* tree);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Positions the `iterator` at the entry with the smallest key.
+ *
+ * @param   tree        A pointer to the `ZyanBTree` instance.
+ * @param   iterator    A pointer to the `ZyanBTreeIterator` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the iterator points to an entry or `ZYAN_STATUS_FALSE`, if the
+ *          tree is empty. Another zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeBegin(const ZyanBTree* tree, ZyanBTreeIterator* iterator);
+
+/**
+ * @brief   Positions the `iterator` at the first entry whose key is not less than `key`.
+ *
+ * @param   tree        A pointer to the `ZyanBTree` instance.
+ * @param   key         A pointer to the key.
+ * @param   iterator    A pointer to the `ZyanBTreeIterator` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the iterator points to an entry or `ZYAN_STATUS_FALSE`, if no
+ *          such entry exists. Another zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeLowerBound(const ZyanBTree* tree, const void* key,
+    ZyanBTreeIterator* iterator);
+
+/**
+ * @brief   Advances the `iterator` to the next entry.
+ *
+ * @param   iterator    A pointer to the `ZyanBTreeIterator` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the iterator points to an entry or `ZYAN_STATUS_FALSE`, if the
+ *          end of the tree was reached. Another zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeIteratorNext(ZyanBTreeIterator* iterator);
+
+/**
+ * @brief   Returns the entry the `iterator` points to.
+ *
+ * @param   iterator    A pointer to the `ZyanBTreeIterator` instance.
+ * @param   key         Receives a pointer to the key. Pass `ZYAN_NULL`, if not needed.
+ * @param   value       Receives a pointer to the value. Pass `ZYAN_NULL`, if not needed.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeIteratorGet(const ZyanBTreeIterator* iterator, const void** key,
+    void** value);
+
+/**
+ * @brief   Invokes the `callback` for every entry whose key is in the range `[first, last)`.
+ *
+ * @param   tree        A pointer to the `ZyanBTree` instance.
+ * @param   first       A pointer to the inclusive lower bound.
+ * @param   last        A pointer to the exclusive upper bound.
+ * @param   callback    The callback function.
+ * @param   user_data   A user data pointer that is passed to the callback.
+ *
+ * @return  A zycore status code.
+ *
+ * The entries are visited in ascending key order. The tree must not be modified by the callback.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeForEachInRange(const ZyanBTree* tree, const void* first,
+    const void* last, ZyanBTreeCallback callback, void* user_data);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the current number of entries in the tree.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   size    Receives the number of entries.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeSize(const ZyanBTree* tree, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_BTREE_H */
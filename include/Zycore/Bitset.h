@@ -469,6 +469,101 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetAny(const ZyanBitset* bitset);
  */
 ZYCORE_EXPORT ZyanStatus ZyanBitsetNone(const ZyanBitset* bitset);
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Unchecked access                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/*
+ * Variants of the bit access and information functions for tight loops. They neither validate
+ * their arguments nor return a status code; the preconditions are asserted in debug builds only.
+ */
+
+/**
+ * @brief   Checks, if the bit at `index` is set without any checks.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   index   The bit index. Must be less than the size of the bitset.
+ *
+ * @return  `ZYAN_TRUE`, if the bit is set or `ZYAN_FALSE`, if not.
+ */
+ZYAN_INLINE ZyanBool ZyanBitsetTestUnchecked(const ZyanBitset* bitset, ZyanUSize index)
+{
+    ZYAN_ASSERT(bitset);
+    ZYAN_ASSERT(index < bitset->size);
+
+    const ZyanU8 byte = ((const ZyanU8*)bitset->bits.data)[index / 8];
+    return (byte & (0x80 >> (index % 8))) ? ZYAN_TRUE : ZYAN_FALSE;
+}
+
+/**
+ * @brief   Sets the bit at `index` without any checks.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   index   The bit index. Must be less than the size of the bitset.
+ */
+ZYAN_INLINE void ZyanBitsetSetUnchecked(ZyanBitset* bitset, ZyanUSize index)
+{
+    ZYAN_ASSERT(bitset);
+    ZYAN_ASSERT(index < bitset->size);
+
+    ((ZyanU8*)bitset->bits.data)[index / 8] |= (ZyanU8)(0x80 >> (index % 8));
+}
+
+/**
+ * @brief   Resets the bit at `index` without any checks.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   index   The bit index. Must be less than the size of the bitset.
+ */
+ZYAN_INLINE void ZyanBitsetResetUnchecked(ZyanBitset* bitset, ZyanUSize index)
+{
+    ZYAN_ASSERT(bitset);
+    ZYAN_ASSERT(index < bitset->size);
+
+    ((ZyanU8*)bitset->bits.data)[index / 8] &= (ZyanU8)~(0x80 >> (index % 8));
+}
+
+/**
+ * @brief   Sets or resets the bit at `index` without any checks.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   index   The bit index. Must be less than the size of the bitset.
+ * @param   value   The new value.
+ */
+ZYAN_INLINE void ZyanBitsetAssignUnchecked(ZyanBitset* bitset, ZyanUSize index, ZyanBool value)
+{
+    if (value)
+    {
+        ZyanBitsetSetUnchecked(bitset, index);
+    } else
+    {
+        ZyanBitsetResetUnchecked(bitset, index);
+    }
+}
+
+/**
+ * @brief   Returns the current size of the bitset in bits without any checks.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ *
+ * @return  The size of the bitset in bits.
+ */
+ZYAN_INLINE ZyanUSize ZyanBitsetSizeUnchecked(const ZyanBitset* bitset)
+{
+    ZYAN_ASSERT(bitset);
+
+    return bitset->size;
+}
+
+/**
+ * @brief   Returns the amount of bits set in the given bitset without any checks.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ *
+ * @return  The amount of bits set in the given bitset.
+ */
+ZYCORE_EXPORT ZyanUSize ZyanBitsetCountUnchecked(const ZyanBitset* bitset);
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -0,0 +1,327 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements a bloom filter on top of the `ZyanBitset` class.
+ */
+
+#ifndef ZYCORE_BLOOM_FILTER_H
+#define ZYCORE_BLOOM_FILTER_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Bitset.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanBloomFilterType` enum.
+ */
+typedef enum ZyanBloomFilterType_
+{
+    /**
+     * @brief   The probes of an element are spread over the whole bitset.
+     *
+     * This variant has the lowest false positive rate for a given amount of memory, but every
+     * probe usually touches a different cache line.
+     */
+    ZYAN_BLOOM_FILTER_TYPE_STANDARD,
+    /**
+     * @brief   The probes of an element all land in a single 64-byte block.
+     *
+     * Every insertion and query touches exactly one cache line. The false positive rate is
+     * slightly higher than the one of the standard variant with the same amount of memory.
+     */
+    ZYAN_BLOOM_FILTER_TYPE_BLOCKED,
+
+    /**
+     * @brief   Maximum value of this enum.
+     */
+    ZYAN_BLOOM_FILTER_TYPE_MAX_VALUE = ZYAN_BLOOM_FILTER_TYPE_BLOCKED,
+    /**
+     * @brief   The minimum number of bits required to represent all values of this enum.
+     */
+    ZYAN_BLOOM_FILTER_TYPE_REQUIRED_BITS =
+        ZYAN_BITS_TO_REPRESENT(ZYAN_BLOOM_FILTER_TYPE_MAX_VALUE)
+} ZyanBloomFilterType;
+
+/**
+ * @brief   Defines the `ZyanBloomFilter` struct.
+ *
+ * The bit storage is allocated once at initialization, aligned to 64 bytes and padded to a
+ * multiple of 64 bytes. The bits are exposed as a regular `ZyanBitset`.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanBloomFilter_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The filter type.
+     */
+    ZyanBloomFilterType type;
+    /**
+     * @brief   The number of probes per element.
+     */
+    ZyanU32 hash_count;
+    /**
+     * @brief   The number of 64-byte blocks.
+     */
+    ZyanUSize block_count;
+    /**
+     * @brief   The unaligned storage buffer, as returned by the allocator.
+     */
+    void* buffer;
+    /**
+     * @brief   The size of the unaligned storage buffer in bytes.
+     */
+    ZyanUSize buffer_size;
+    /**
+     * @brief   The bitset that wraps the aligned storage.
+     */
+    ZyanBitset bits;
+} ZyanBloomFilter;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanBloomFilter` instance.
+ *
+ * @param   filter              A pointer to the `ZyanBloomFilter` instance.
+ * @param   type                The filter type.
+ * @param   expected_count      The expected number of elements.
+ * @param   false_positive_rate The desired false positive rate (from `0.0f` to `1.0f`,
+ *                              exclusive).
+ *
+ * @return  A zycore status code.
+ *
+ * The number of bits and probes is derived from the expected number of elements and the desired
+ * false positive rate. The storage is allocated by the default allocator.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterInit(ZyanBloomFilter* filter, ZyanBloomFilterType type,
+    ZyanUSize expected_count, float false_positive_rate);
+
+/**
+ * @brief   Initializes the given `ZyanBloomFilter` instance with an explicit geometry and a
+ *          custom `allocator`.
+ *
+ * @param   filter      A pointer to the `ZyanBloomFilter` instance.
+ * @param   type        The filter type.
+ * @param   bit_count   The minimum number of bits. The value is rounded up to a multiple of `512`.
+ * @param   hash_count  The number of probes per element (from `1` to `32`).
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * Filters that should be combined using `ZyanBloomFilterUnion` have to be created with the same
+ * type, bit count and hash count.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterInitEx(ZyanBloomFilter* filter, ZyanBloomFilterType type,
+    ZyanUSize bit_count, ZyanU32 hash_count, ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanBloomFilter` instance.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterDestroy(ZyanBloomFilter* filter);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Adds an element to the filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   element A pointer to the element.
+ * @param   size    The size of the element in bytes.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterInsert(ZyanBloomFilter* filter, const void* element,
+    ZyanUSize size);
+
+/**
+ * @brief   Adds an element, given by its 64-bit hash value, to the filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   hash    The hash value of the element.
+ *
+ * @return  A zycore status code.
+ *
+ * This function allows callers to reuse hash values they already computed. The hash must be of
+ * good quality in all 64 bits.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterInsertHash(ZyanBloomFilter* filter, ZyanU64 hash);
+
+/**
+ * @brief   Adds multiple fixed-size elements to the filter.
+ *
+ * @param   filter          A pointer to the `ZyanBloomFilter` instance.
+ * @param   elements        A pointer to the first element.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   count           The number of elements.
+ *
+ * @return  A zycore status code.
+ *
+ * The elements are hashed in small batches before the bitset is touched, which allows the CPU to
+ * overlap the cache misses of independent elements.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterInsertElements(ZyanBloomFilter* filter,
+    const void* elements, ZyanUSize element_size, ZyanUSize count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Checks if the filter possibly contains the given element.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   element A pointer to the element.
+ * @param   size    The size of the element in bytes.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the element is possibly contained, `ZYAN_STATUS_FALSE`, if it is
+ *          definitely not contained, or another zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterContains(const ZyanBloomFilter* filter,
+    const void* element, ZyanUSize size);
+
+/**
+ * @brief   Checks if the filter possibly contains the element with the given 64-bit hash value.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   hash    The hash value of the element.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the element is possibly contained, `ZYAN_STATUS_FALSE`, if it is
+ *          definitely not contained, or another zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterContainsHash(const ZyanBloomFilter* filter, ZyanU64 hash);
+
+/**
+ * @brief   Checks multiple fixed-size elements against the filter.
+ *
+ * @param   filter          A pointer to the `ZyanBloomFilter` instance.
+ * @param   elements        A pointer to the first element.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   count           The number of elements.
+ * @param   results         Receives `ZYAN_TRUE` for every element that is possibly contained and
+ *                          `ZYAN_FALSE` for every element that is definitely not contained.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterContainsElements(const ZyanBloomFilter* filter,
+    const void* elements, ZyanUSize element_size, ZyanUSize count, ZyanBool* results);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Set operations                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Merges the `source` filter into the `destination` filter.
+ *
+ * @param   destination A pointer to the destination `ZyanBloomFilter` instance.
+ * @param   source      A pointer to the source `ZyanBloomFilter` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * Both filters must have the same type, bit count and hash count. Afterwards the destination
+ * filter reports every element that was added to either of the filters.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterUnion(ZyanBloomFilter* destination,
+    const ZyanBloomFilter* source);
+
+/**
+ * @brief   Removes all elements from the filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterClear(ZyanBloomFilter* filter);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Estimates the number of distinct elements that were added to the filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   count   Receives the estimated number of elements.
+ *
+ * @return  A zycore status code.
+ *
+ * The estimate is derived from the number of set bits. It is exact in expectation for the
+ * standard variant and slightly underestimates for the blocked variant under heavy load.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterEstimateCount(const ZyanBloomFilter* filter,
+    ZyanUSize* count);
+
+/**
+ * @brief   Returns the number of bits of the filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   size    Receives the number of bits.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterSize(const ZyanBloomFilter* filter, ZyanUSize* size);
+
+/**
+ * @brief   Returns the number of probes per element.
+ *
+ * @param   filter      A pointer to the `ZyanBloomFilter` instance.
+ * @param   hash_count  Receives the number of probes per element.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterHashCount(const ZyanBloomFilter* filter,
+    ZyanU32* hash_count);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_BLOOM_FILTER_H */
@@ -0,0 +1,253 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements runtime CPU feature detection and dispatching of optimized kernels.
+ *
+ * Zycore is compiled for the baseline ISA of the target architecture. Kernels that use newer
+ * instruction set extensions are compiled separately (e.g. using the `target` attribute) and
+ * selected at runtime with `ZyanCPUDispatch`, which picks the best function table the current
+ * CPU and operating system support on the first call and caches the choice afterwards.
+ */
+
+#ifndef ZYCORE_CPU_H
+#define ZYCORE_CPU_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Atomic.h>
+#include <Zycore/Defines.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanCPUFeatures` data-type, a combination of `ZYAN_CPU_FEATURE_*` flags.
+ */
+typedef ZyanU64 ZyanCPUFeatures;
+
+/**
+ * @brief   Defines the `ZyanCPUDispatchEntry` struct.
+ */
+typedef struct ZyanCPUDispatchEntry_
+{
+    /**
+     * @brief   The features the kernels in `table` require.
+     */
+    ZyanCPUFeatures features;
+    /**
+     * @brief   A pointer to a function table.
+     */
+    const void* table;
+} ZyanCPUDispatchEntry;
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Features                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   x86: Streaming SIMD Extensions 2.
+ */
+#define ZYAN_CPU_FEATURE_SSE2               (1ULL <<  0)
+
+/**
+ * @brief   x86: Streaming SIMD Extensions 3.
+ */
+#define ZYAN_CPU_FEATURE_SSE3               (1ULL <<  1)
+
+/**
+ * @brief   x86: Supplemental Streaming SIMD Extensions 3.
+ */
+#define ZYAN_CPU_FEATURE_SSSE3              (1ULL <<  2)
+
+/**
+ * @brief   x86: Streaming SIMD Extensions 4.1.
+ */
+#define ZYAN_CPU_FEATURE_SSE41              (1ULL <<  3)
+
+/**
+ * @brief   x86: Streaming SIMD Extensions 4.2.
+ */
+#define ZYAN_CPU_FEATURE_SSE42              (1ULL <<  4)
+
+/**
+ * @brief   x86: The `POPCNT` instruction.
+ */
+#define ZYAN_CPU_FEATURE_POPCNT             (1ULL <<  5)
+
+/**
+ * @brief   x86: Advanced Vector Extensions (including operating system support).
+ */
+#define ZYAN_CPU_FEATURE_AVX                (1ULL <<  6)
+
+/**
+ * @brief   x86: Advanced Vector Extensions 2.
+ */
+#define ZYAN_CPU_FEATURE_AVX2               (1ULL <<  7)
+
+/**
+ * @brief   x86: Bit Manipulation Instruction Set 1.
+ */
+#define ZYAN_CPU_FEATURE_BMI1               (1ULL <<  8)
+
+/**
+ * @brief   x86: Bit Manipulation Instruction Set 2.
+ */
+#define ZYAN_CPU_FEATURE_BMI2               (1ULL <<  9)
+
+/**
+ * @brief   x86: Fused multiply-add (FMA3).
+ */
+#define ZYAN_CPU_FEATURE_FMA                (1ULL << 10)
+
+/**
+ * @brief   x86: AVX-512 Foundation (including operating system support).
+ */
+#define ZYAN_CPU_FEATURE_AVX512F            (1ULL << 11)
+
+/**
+ * @brief   x86: AVX-512 Byte and Word Instructions.
+ */
+#define ZYAN_CPU_FEATURE_AVX512BW           (1ULL << 12)
+
+/**
+ * @brief   x86: AVX-512 Vector Length Extensions.
+ */
+#define ZYAN_CPU_FEATURE_AVX512VL           (1ULL << 13)
+
+/**
+ * @brief   x86: AVX-512 Vector Population Count (double- and quadword).
+ */
+#define ZYAN_CPU_FEATURE_AVX512VPOPCNTDQ    (1ULL << 14)
+
+/**
+ * @brief   ARM: Advanced SIMD (NEON).
+ */
+#define ZYAN_CPU_FEATURE_NEON               (1ULL << 32)
+
+/**
+ * @brief   ARM: CRC32 instructions.
+ */
+#define ZYAN_CPU_FEATURE_CRC32              (1ULL << 33)
+
+/**
+ * @brief   ARM: Scalable Vector Extension.
+ */
+#define ZYAN_CPU_FEATURE_SVE                (1ULL << 34)
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Feature detection                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the features supported by the current CPU and operating system.
+ *
+ * @return  A combination of `ZYAN_CPU_FEATURE_*` flags.
+ *
+ * The features are detected on the first call and cached afterwards.
+ */
+ZYCORE_EXPORT ZyanCPUFeatures ZyanCPUGetFeatures(void);
+
+/**
+ * @brief   Checks, if the current CPU and operating system support all of the given features.
+ *
+ * @param   features    A combination of `ZYAN_CPU_FEATURE_*` flags.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if all features are supported or `ZYAN_STATUS_FALSE`, if not.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCPUHasFeatures(ZyanCPUFeatures features);
+
+/**
+ * @brief   Hides the given features from all subsequent feature queries.
+ *
+ * @param   features    A combination of `ZYAN_CPU_FEATURE_*` flags.
+ *
+ * @return  A zycore status code.
+ *
+ * This is intended for testing and benchmarking the fallback kernels. Function tables that were
+ * already selected by `ZyanCPUDispatch` are not affected, so this function should be called
+ * before any other Zycore function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCPUDisableFeatures(ZyanCPUFeatures features);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Dispatching                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Selects the first entry whose required features are supported and caches the choice.
+ *
+ * @param   cache   A pointer to the `ZyanAtomicPointer` that caches the selected table. Must be
+ *                  initialized to `ZYAN_NULL`.
+ * @param   entries The candidate entries, ordered from the most to the least specialized one.
+ *                  The last entry should not require any features.
+ * @param   count   The number of entries.
+ *
+ * @return  A pointer to the selected function table or `ZYAN_NULL`, if no entry matches.
+ *
+ * Concurrent first calls may select the table multiple times, but always select the same one.
+ */
+ZYAN_INLINE const void* ZyanCPUDispatch(ZyanAtomicPointer* cache,
+    const ZyanCPUDispatchEntry* entries, ZyanUSize count)
+{
+    const void* table = ZyanAtomicLoadPointer(cache, ZYAN_MEMORY_ORDER_ACQUIRE);
+    if (table)
+    {
+        return table;
+    }
+
+    const ZyanCPUFeatures features = ZyanCPUGetFeatures();
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        if ((entries[i].features & features) == entries[i].features)
+        {
+            table = entries[i].table;
+            break;
+        }
+    }
+    ZyanAtomicStorePointer(cache, (void*)table, ZYAN_MEMORY_ORDER_RELEASE);
+
+    return table;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_CPU_H */
@@ -0,0 +1,301 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements a bounded key-value cache container class.
+ */
+
+#ifndef ZYCORE_CACHE_H
+#define ZYCORE_CACHE_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/IntrusiveList.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanCachePolicy` enum.
+ */
+typedef enum ZyanCachePolicy_
+{
+    /**
+     * @brief   Evicts the least recently used entry.
+     *
+     * Every hit moves the entry to the front of a linked list. The entry at the end of the list is
+     * evicted.
+     */
+    ZYAN_CACHE_POLICY_LRU,
+    /**
+     * @brief   Evicts entries using the CLOCK (second-chance) algorithm.
+     *
+     * Every hit only sets a reference bit. On eviction, a clock hand sweeps over the entries,
+     * clears set reference bits and evicts the first entry whose bit was already cleared. This
+     * approximates LRU while keeping hits free of any pointer updates.
+     */
+    ZYAN_CACHE_POLICY_CLOCK,
+
+    /**
+     * @brief   Maximum value of this enum.
+     */
+    ZYAN_CACHE_POLICY_MAX_VALUE = ZYAN_CACHE_POLICY_CLOCK,
+    /**
+     * @brief   The minimum number of bits required to represent all values of this enum.
+     */
+    ZYAN_CACHE_POLICY_REQUIRED_BITS = ZYAN_BITS_TO_REPRESENT(ZYAN_CACHE_POLICY_MAX_VALUE)
+} ZyanCachePolicy;
+
+/**
+ * @brief   Defines the `ZyanCacheEvictionCallback` function.
+ *
+ * @param   key         A pointer to the key of the evicted entry.
+ * @param   value       A pointer to the value of the evicted entry.
+ * @param   user_data   The user data pointer passed at initialization.
+ *
+ * @return  A zycore status code.
+ *
+ * This function is invoked whenever an entry has to be evicted to make room for a new one. The
+ * `key` and `value` pointers are only valid for the duration of the call. Returning a failure
+ * status aborts the pending insertion.
+ */
+typedef ZyanStatus (*ZyanCacheEvictionCallback)(const void* key, void* value, void* user_data);
+
+/**
+ * @brief   Defines the `ZyanCache` struct.
+ *
+ * The cache maps fixed-size keys to fixed-size values and holds at most `capacity` entries. All
+ * memory is allocated at initialization, so neither hits nor insertions allocate.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanCache_
+{
+    /**
+     * @brief   The eviction policy.
+     */
+    ZyanCachePolicy policy;
+    /**
+     * @brief   The size of a single key in bytes.
+     */
+    ZyanUSize key_size;
+    /**
+     * @brief   The size of a single value in bytes.
+     */
+    ZyanUSize value_size;
+    /**
+     * @brief   The offset of the key inside an entry.
+     */
+    ZyanUSize key_offset;
+    /**
+     * @brief   The offset of the value inside an entry.
+     */
+    ZyanUSize value_offset;
+    /**
+     * @brief   The maximum number of entries.
+     */
+    ZyanUSize capacity;
+    /**
+     * @brief   The entry storage.
+     */
+    ZyanVector entries;
+    /**
+     * @brief   The hash table that maps keys to entry indices.
+     */
+    ZyanVector slots;
+    /**
+     * @brief   The list of entries in use, ordered from the most to the least recently used one.
+     */
+    ZyanIntrusiveList used;
+    /**
+     * @brief   The list of unused entries.
+     */
+    ZyanIntrusiveList unused;
+    /**
+     * @brief   The index of the entry the clock hand currently points to.
+     */
+    ZyanUSize clock_hand;
+    /**
+     * @brief   The eviction callback or `ZYAN_NULL`.
+     */
+    ZyanCacheEvictionCallback callback;
+    /**
+     * @brief   The user data pointer that is passed to the eviction callback.
+     */
+    void* user_data;
+} ZyanCache;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanCache` instance.
+ *
+ * @param   cache       A pointer to the `ZyanCache` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes.
+ * @param   capacity    The maximum number of entries.
+ * @param   policy      The eviction policy.
+ *
+ * @return  A zycore status code.
+ *
+ * The memory for the cache is allocated by the default allocator.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheInit(ZyanCache* cache, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanUSize capacity, ZyanCachePolicy policy);
+
+/**
+ * @brief   Initializes the given `ZyanCache` instance and sets an eviction `callback` and a custom
+ *          `allocator`.
+ *
+ * @param   cache       A pointer to the `ZyanCache` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes.
+ * @param   capacity    The maximum number of entries.
+ * @param   policy      The eviction policy.
+ * @param   callback    The eviction callback or `ZYAN_NULL`.
+ * @param   user_data   A user data pointer that is passed to the eviction callback.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheInitEx(ZyanCache* cache, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanUSize capacity, ZyanCachePolicy policy,
+    ZyanCacheEvictionCallback callback, void* user_data, ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanCache` instance.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * The eviction callback is not invoked for the remaining entries.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheDestroy(ZyanCache* cache);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Looks up the value for the given `key` and marks the entry as recently used.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a pointer to the cached value, if the key was found. The pointer stays
+ *                  valid until the entry is evicted or removed.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the key was found or `ZYAN_STATUS_FALSE`, if not. Another zycore
+ *          status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheGet(ZyanCache* cache, const void* key, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Inserts or updates the entry for the given `key`.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   A pointer to the value.
+ *
+ * @return  A zycore status code.
+ *
+ * If the cache is full, an entry is evicted according to the eviction policy.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCachePut(ZyanCache* cache, const void* key, const void* value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Removes the entry for the given `key`.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   key     A pointer to the key.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the entry was removed or `ZYAN_STATUS_FALSE`, if the key was not
+ *          found. Another zycore status code, if an error occured.
+ *
+ * The eviction callback is not invoked for removed entries.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheRemove(ZyanCache* cache, const void* key);
+
+/**
+ * @brief   Removes all entries of the given cache.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * The eviction callback is not invoked for removed entries.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheClear(ZyanCache* cache);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the current number of entries in the cache.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   size    Receives the number of entries.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheSize(const ZyanCache* cache, ZyanUSize* size);
+
+/**
+ * @brief   Returns the maximum number of entries in the cache.
+ *
+ * @param   cache       A pointer to the `ZyanCache` instance.
+ * @param   capacity    Receives the maximum number of entries.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheCapacity(const ZyanCache* cache, ZyanUSize* capacity);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_CACHE_H */
@@ -0,0 +1,256 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements a growable vector that supports lock-free appends from multiple threads.
+ *
+ * Producers reserve slots with a compare-and-swap on the size, after the segment that holds the
+ * slot was allocated, so a failed allocation never leaves a gap. Storage grows in segments that
+ * double in size and are never moved or released before the vector is destroyed, so pointers to
+ * elements stay valid while other threads keep appending. Elements can not be removed.
+ *
+ * An element is only visible to other threads after the producer published its index through
+ * some form of synchronization (e.g. by joining the producer thread or by an atomic store with
+ * release semantics). Reading a slot that is still being written results in undefined behavior.
+ */
+
+#ifndef ZYCORE_CONCURRENT_VECTOR_H
+#define ZYCORE_CONCURRENT_VECTOR_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Atomic.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * @brief   The maximum number of segments of a `ZyanConcurrentVector` instance.
+ */
+#define ZYAN_CONCURRENT_VECTOR_MAX_SEGMENTS     32
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanConcurrentVector` struct.
+ *
+ * Segment `n` holds `first_segment_capacity << n` elements.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanConcurrentVector_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The size of a single element in bytes.
+     */
+    ZyanUSize element_size;
+    /**
+     * @brief   The binary logarithm of the capacity of the first segment.
+     */
+    ZyanU8 first_segment_shift;
+    /**
+     * @brief   The number of segments that can be addressed without overflowing `ZyanUSize`.
+     */
+    ZyanU8 segment_count;
+    /**
+     * @brief   The maximum number of elements.
+     */
+    ZyanU64 max_size;
+    /**
+     * @brief   The number of reserved slots.
+     */
+    ZyanAtomic64 size;
+    /**
+     * @brief   The segment pointers.
+     */
+    ZyanAtomicPointer segments[ZYAN_CONCURRENT_VECTOR_MAX_SEGMENTS];
+} ZyanConcurrentVector;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanConcurrentVector` instance.
+ *
+ * @param   vector          A pointer to the `ZyanConcurrentVector` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   capacity        The capacity of the first segment (number of elements).
+ *
+ * @return  A zycore status code.
+ *
+ * The segments are dynamically allocated by the default allocator. The capacity is rounded up to
+ * the next power of two. The first segment is allocated lazily on the first append.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentVectorInit(ZyanConcurrentVector* vector,
+    ZyanUSize element_size, ZyanUSize capacity);
+
+/**
+ * @brief   Initializes the given `ZyanConcurrentVector` instance and sets a custom `allocator`.
+ *
+ * @param   vector          A pointer to the `ZyanConcurrentVector` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   capacity        The capacity of the first segment (number of elements).
+ * @param   allocator       A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * The allocator has to be thread-safe, as segments are allocated by the appending threads.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentVectorInitEx(ZyanConcurrentVector* vector,
+    ZyanUSize element_size, ZyanUSize capacity, ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanConcurrentVector` instance.
+ *
+ * @param   vector  A pointer to the `ZyanConcurrentVector` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * This function must not be called while other threads access the vector.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentVectorDestroy(ZyanConcurrentVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns a constant pointer to the element at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanConcurrentVector` instance.
+ * @param   index   The element index.
+ * @param   element Receives a constant pointer to the desired element in the vector.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentVectorGet(const ZyanConcurrentVector* vector,
+    ZyanUSize index, const void** element);
+
+/**
+ * @brief   Returns a mutable pointer to the element at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanConcurrentVector` instance.
+ * @param   index   The element index.
+ * @param   element Receives a pointer to the desired element in the vector.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentVectorGetMutable(ZyanConcurrentVector* vector,
+    ZyanUSize index, void** element);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Appends the given `element` to the end of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanConcurrentVector` instance.
+ * @param   element A pointer to the element to append.
+ * @param   index   Receives the index of the new element. This argument is optional.
+ *
+ * @return  A zycore status code.
+ *
+ * This function is safe to be called from multiple threads at the same time.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentVectorPush(ZyanConcurrentVector* vector,
+    const void* element, ZyanUSize* index);
+
+/**
+ * @brief   Reserves a new slot at the end of the vector and returns a pointer to it.
+ *
+ * @param   vector  A pointer to the `ZyanConcurrentVector` instance.
+ * @param   element Receives a pointer to the uninitialized slot.
+ * @param   index   Receives the index of the new slot. This argument is optional.
+ *
+ * @return  A zycore status code.
+ *
+ * This function is safe to be called from multiple threads at the same time. The caller is
+ * responsible for initializing the slot before its index is published to other threads.
+ *
+ * The size of the vector is only incremented after the storage of the slot was allocated. If the
+ * allocation fails, the size does not change.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentVectorEmplace(ZyanConcurrentVector* vector,
+    void** element, ZyanUSize* index);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Allocates all segments that are required to hold `capacity` elements.
+ *
+ * @param   vector      A pointer to the `ZyanConcurrentVector` instance.
+ * @param   capacity    The new minimum capacity of the vector.
+ *
+ * @return  A zycore status code.
+ *
+ * This function is safe to be called from multiple threads at the same time. Reserving the
+ * expected capacity up front removes the allocations from the append path.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentVectorReserve(ZyanConcurrentVector* vector,
+    ZyanUSize capacity);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the current size of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanConcurrentVector` instance.
+ * @param   size    Receives the size of the vector.
+ *
+ * @return  A zycore status code.
+ *
+ * The size includes slots that were reserved by other threads, but might not be initialized yet.
+ * The storage of every counted slot is allocated.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentVectorSize(const ZyanConcurrentVector* vector,
+    ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_CONCURRENT_VECTOR_H */
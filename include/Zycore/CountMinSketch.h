@@ -0,0 +1,270 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements a count-min sketch for frequency estimation.
+ */
+
+#ifndef ZYCORE_COUNT_MIN_SKETCH_H
+#define ZYCORE_COUNT_MIN_SKETCH_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanCountMinSketch` struct.
+ *
+ * The sketch consists of `depth` rows of `width` counters. Every element increments one counter
+ * per row and the estimated frequency is the minimum of these counters. Estimates never undercount
+ * and overcount by at most `e / width * total` with probability `1 - e^-depth`.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanCountMinSketch_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The number of counters per row (always a power of two).
+     */
+    ZyanUSize width;
+    /**
+     * @brief   The number of rows.
+     */
+    ZyanUSize depth;
+    /**
+     * @brief   The sum of all added counts.
+     */
+    ZyanU64 total;
+    /**
+     * @brief   The counters, stored row by row.
+     */
+    ZyanU64* counters;
+} ZyanCountMinSketch;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanCountMinSketch` instance.
+ *
+ * @param   sketch      A pointer to the `ZyanCountMinSketch` instance.
+ * @param   epsilon     The maximum overcount relative to the total count (from `0.0f` to `1.0f`,
+ *                      exclusive).
+ * @param   delta       The probability of exceeding the maximum overcount (from `0.0f` to
+ *                      `1.0f`, exclusive).
+ *
+ * @return  A zycore status code.
+ *
+ * The counters are allocated by the default allocator.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchInit(ZyanCountMinSketch* sketch, float epsilon,
+    float delta);
+
+/**
+ * @brief   Initializes the given `ZyanCountMinSketch` instance with an explicit geometry and a
+ *          custom `allocator`.
+ *
+ * @param   sketch      A pointer to the `ZyanCountMinSketch` instance.
+ * @param   width       The minimum number of counters per row. The value is rounded up to a power
+ *                      of two.
+ * @param   depth       The number of rows (from `1` to `32`).
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * Sketches that should be combined using `ZyanCountMinSketchMerge` have to be created with the
+ * same width and depth.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchInitEx(ZyanCountMinSketch* sketch, ZyanUSize width,
+    ZyanUSize depth, ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanCountMinSketch` instance.
+ *
+ * @param   sketch  A pointer to the `ZyanCountMinSketch` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchDestroy(ZyanCountMinSketch* sketch);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Adds `count` occurrences of an element to the sketch.
+ *
+ * @param   sketch  A pointer to the `ZyanCountMinSketch` instance.
+ * @param   element A pointer to the element.
+ * @param   size    The size of the element in bytes.
+ * @param   count   The number of occurrences.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchAdd(ZyanCountMinSketch* sketch, const void* element,
+    ZyanUSize size, ZyanU64 count);
+
+/**
+ * @brief   Adds `count` occurrences of an element, given by its 64-bit hash value, to the sketch.
+ *
+ * @param   sketch  A pointer to the `ZyanCountMinSketch` instance.
+ * @param   hash    The hash value of the element.
+ * @param   count   The number of occurrences.
+ *
+ * @return  A zycore status code.
+ *
+ * The hash must be of good quality in all 64 bits.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchAddHash(ZyanCountMinSketch* sketch, ZyanU64 hash,
+    ZyanU64 count);
+
+/**
+ * @brief   Merges the `source` sketch into the `destination` sketch.
+ *
+ * @param   destination A pointer to the destination `ZyanCountMinSketch` instance.
+ * @param   source      A pointer to the source `ZyanCountMinSketch` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * Both sketches must have the same width and depth.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchMerge(ZyanCountMinSketch* destination,
+    const ZyanCountMinSketch* source);
+
+/**
+ * @brief   Resets all counters of the sketch.
+ *
+ * @param   sketch  A pointer to the `ZyanCountMinSketch` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchClear(ZyanCountMinSketch* sketch);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Estimation                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Estimates the number of occurrences of an element.
+ *
+ * @param   sketch  A pointer to the `ZyanCountMinSketch` instance.
+ * @param   element A pointer to the element.
+ * @param   size    The size of the element in bytes.
+ * @param   count   Receives the estimated number of occurrences.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchEstimate(const ZyanCountMinSketch* sketch,
+    const void* element, ZyanUSize size, ZyanU64* count);
+
+/**
+ * @brief   Estimates the number of occurrences of an element, given by its 64-bit hash value.
+ *
+ * @param   sketch  A pointer to the `ZyanCountMinSketch` instance.
+ * @param   hash    The hash value of the element.
+ * @param   count   Receives the estimated number of occurrences.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchEstimateHash(const ZyanCountMinSketch* sketch,
+    ZyanU64 hash, ZyanU64* count);
+
+/**
+ * @brief   Returns the sum of all added counts.
+ *
+ * @param   sketch  A pointer to the `ZyanCountMinSketch` instance.
+ * @param   total   Receives the sum of all added counts.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchTotal(const ZyanCountMinSketch* sketch,
+    ZyanU64* total);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Serialization                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the number of bytes required to serialize the sketch.
+ *
+ * @param   sketch  A pointer to the `ZyanCountMinSketch` instance.
+ * @param   size    Receives the number of bytes.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchSerializedSize(const ZyanCountMinSketch* sketch,
+    ZyanUSize* size);
+
+/**
+ * @brief   Serializes the sketch into the given buffer.
+ *
+ * @param   sketch      A pointer to the `ZyanCountMinSketch` instance.
+ * @param   buffer      A pointer to the buffer.
+ * @param   capacity    The size of the buffer in bytes.
+ *
+ * @return  A zycore status code.
+ *
+ * The serialized format is independent of the host byte order.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchSerialize(const ZyanCountMinSketch* sketch,
+    void* buffer, ZyanUSize capacity);
+
+/**
+ * @brief   Initializes the given `ZyanCountMinSketch` instance from serialized data.
+ *
+ * @param   sketch      A pointer to the `ZyanCountMinSketch` instance.
+ * @param   buffer      A pointer to the serialized data.
+ * @param   size        The size of the serialized data in bytes.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * Returns `ZYAN_STATUS_INVALID_ARGUMENT`, if the data is malformed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCountMinSketchDeserialize(ZyanCountMinSketch* sketch,
+    const void* buffer, ZyanUSize size, ZyanAllocator* allocator);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_COUNT_MIN_SKETCH_H */
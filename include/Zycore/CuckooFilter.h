@@ -0,0 +1,262 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements a cuckoo filter for approximate set membership with deletion support.
+ */
+
+#ifndef ZYCORE_CUCKOO_FILTER_H
+#define ZYCORE_CUCKOO_FILTER_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanCuckooFilter` struct.
+ *
+ * The filter stores a 16-bit fingerprint per element in a table of buckets. Every bucket holds
+ * four fingerprints packed into a single 64-bit word, so a bucket is compared against a
+ * fingerprint with a handful of integer instructions. Every element has two candidate buckets;
+ * if both are full, resident fingerprints are relocated to their alternate bucket.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanCuckooFilter_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The bucket table.
+     */
+    ZyanU64* buckets;
+    /**
+     * @brief   The number of buckets (always a power of two).
+     */
+    ZyanUSize bucket_count;
+    /**
+     * @brief   The number of stored fingerprints.
+     */
+    ZyanUSize size;
+    /**
+     * @brief   The state of the random number generator that selects relocation victims.
+     */
+    ZyanU64 random;
+    /**
+     * @brief   A fingerprint that could not be placed after the maximum number of relocations,
+     *          or `0`, if none.
+     */
+    ZyanU16 victim_fingerprint;
+    /**
+     * @brief   The bucket index of the victim fingerprint.
+     */
+    ZyanUSize victim_index;
+} ZyanCuckooFilter;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanCuckooFilter` instance.
+ *
+ * @param   filter      A pointer to the `ZyanCuckooFilter` instance.
+ * @param   capacity    The number of elements the filter should be able to hold.
+ *
+ * @return  A zycore status code.
+ *
+ * The bucket table is allocated by the default allocator.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterInit(ZyanCuckooFilter* filter, ZyanUSize capacity);
+
+/**
+ * @brief   Initializes the given `ZyanCuckooFilter` instance and sets a custom `allocator`.
+ *
+ * @param   filter      A pointer to the `ZyanCuckooFilter` instance.
+ * @param   capacity    The number of elements the filter should be able to hold.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * The number of buckets is rounded up to a power of two and chosen so that `capacity` elements
+ * occupy at most 95% of the slots.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterInitEx(ZyanCuckooFilter* filter, ZyanUSize capacity,
+    ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanCuckooFilter` instance.
+ *
+ * @param   filter  A pointer to the `ZyanCuckooFilter` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterDestroy(ZyanCuckooFilter* filter);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Adds an element to the filter.
+ *
+ * @param   filter  A pointer to the `ZyanCuckooFilter` instance.
+ * @param   element A pointer to the element.
+ * @param   size    The size of the element in bytes.
+ *
+ * @return  A zycore status code.
+ *
+ * Adding the same element multiple times stores multiple copies of its fingerprint. This function
+ * returns `ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE`, if the filter is full. In this case, the filter
+ * is not modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterInsert(ZyanCuckooFilter* filter, const void* element,
+    ZyanUSize size);
+
+/**
+ * @brief   Adds an element, given by its 64-bit hash value, to the filter.
+ *
+ * @param   filter  A pointer to the `ZyanCuckooFilter` instance.
+ * @param   hash    The hash value of the element.
+ *
+ * @return  A zycore status code.
+ *
+ * The hash must be of good quality in all 64 bits.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterInsertHash(ZyanCuckooFilter* filter, ZyanU64 hash);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Checks if the filter possibly contains the given element.
+ *
+ * @param   filter  A pointer to the `ZyanCuckooFilter` instance.
+ * @param   element A pointer to the element.
+ * @param   size    The size of the element in bytes.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the element is possibly contained, `ZYAN_STATUS_FALSE`, if it is
+ *          definitely not contained, or another zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterContains(const ZyanCuckooFilter* filter,
+    const void* element, ZyanUSize size);
+
+/**
+ * @brief   Checks if the filter possibly contains the element with the given 64-bit hash value.
+ *
+ * @param   filter  A pointer to the `ZyanCuckooFilter` instance.
+ * @param   hash    The hash value of the element.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the element is possibly contained, `ZYAN_STATUS_FALSE`, if it is
+ *          definitely not contained, or another zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterContainsHash(const ZyanCuckooFilter* filter,
+    ZyanU64 hash);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Removes an element from the filter.
+ *
+ * @param   filter  A pointer to the `ZyanCuckooFilter` instance.
+ * @param   element A pointer to the element.
+ * @param   size    The size of the element in bytes.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if a matching fingerprint was removed, `ZYAN_STATUS_FALSE`, if not,
+ *          or another zycore status code, if an error occured.
+ *
+ * Only elements that were previously added may be removed. Removing any other element might
+ * remove the fingerprint of a different element that shares the same fingerprint and bucket.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterRemove(ZyanCuckooFilter* filter, const void* element,
+    ZyanUSize size);
+
+/**
+ * @brief   Removes an element, given by its 64-bit hash value, from the filter.
+ *
+ * @param   filter  A pointer to the `ZyanCuckooFilter` instance.
+ * @param   hash    The hash value of the element.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if a matching fingerprint was removed, `ZYAN_STATUS_FALSE`, if not,
+ *          or another zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterRemoveHash(ZyanCuckooFilter* filter, ZyanU64 hash);
+
+/**
+ * @brief   Removes all elements from the filter.
+ *
+ * @param   filter  A pointer to the `ZyanCuckooFilter` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterClear(ZyanCuckooFilter* filter);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the number of stored elements.
+ *
+ * @param   filter  A pointer to the `ZyanCuckooFilter` instance.
+ * @param   size    Receives the number of stored elements.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterSize(const ZyanCuckooFilter* filter, ZyanUSize* size);
+
+/**
+ * @brief   Returns the total number of fingerprint slots.
+ *
+ * @param   filter      A pointer to the `ZyanCuckooFilter` instance.
+ * @param   capacity    Receives the number of fingerprint slots.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCuckooFilterCapacity(const ZyanCuckooFilter* filter,
+    ZyanUSize* capacity);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_CUCKOO_FILTER_H */
@@ -93,6 +93,24 @@
 #   error "Unsupported architecture detected"
 #endif
 
+/* ============================================================================================== */
+/* Architecture properties                                                                        */
+/* ============================================================================================== */
+
+/**
+ * @brief   The assumed size of a cache line in bytes.
+ *
+ * Data that is written by different threads should be placed at least this far apart to avoid
+ * false sharing. Define this macro before including any Zycore header to override the default.
+ */
+#ifndef ZYAN_CACHE_LINE_SIZE
+#   if defined(ZYAN_AARCH64) && defined(ZYAN_APPLE)
+#       define ZYAN_CACHE_LINE_SIZE 128
+#   else
+#       define ZYAN_CACHE_LINE_SIZE 64
+#   endif
+#endif
+
 /* ============================================================================================== */
 /* Debug/Release detection                                                                        */
 /* ============================================================================================== */
@@ -168,6 +186,135 @@
 #   define ZYAN_UNREACHABLE { assert(0); abort(); }
 #endif
 
+/**
+ * @brief   Tells the compiler that `condition` is expected to be true.
+ *
+ * @param   condition   The condition.
+ *
+ * @return  The truth value of `condition`.
+ *
+ * The compiler lays out the code, so that the expected path falls through without taking a branch.
+ */
+#if defined(ZYAN_GNUC) || defined(ZYAN_ICC)
+#   define ZYAN_LIKELY(condition) __builtin_expect(!!(condition), 1)
+#else
+#   define ZYAN_LIKELY(condition) (condition)
+#endif
+
+/**
+ * @brief   Tells the compiler that `condition` is expected to be false.
+ *
+ * @param   condition   The condition.
+ *
+ * @return  The truth value of `condition`.
+ *
+ * Used for argument checks and other error paths, which the compiler then moves out of the hot
+ * code.
+ */
+#if defined(ZYAN_GNUC) || defined(ZYAN_ICC)
+#   define ZYAN_UNLIKELY(condition) __builtin_expect(!!(condition), 0)
+#else
+#   define ZYAN_UNLIKELY(condition) (condition)
+#endif
+
+/**
+ * @brief   Tells the compiler that `condition` is always true.
+ *
+ * @param   condition   The condition. Must not have side effects.
+ *
+ * Checked by an assertion in debug builds. Violating the assumption in release builds results in
+ * undefined behavior.
+ */
+#if defined(ZYAN_DEBUG)
+#   define ZYAN_ASSUME(condition) ZYAN_ASSERT(condition)
+#elif defined(ZYAN_CLANG) // Nested for the same reason as in `ZYAN_UNREACHABLE`
+#   if __has_builtin(__builtin_assume)
+#       define ZYAN_ASSUME(condition) __builtin_assume(condition)
+#   else
+#       define ZYAN_ASSUME(condition) ((void)0)
+#   endif
+#elif defined(ZYAN_GCC) && ((__GNUC__ == 4 && __GNUC_MINOR__ > 4) || __GNUC__ > 4)
+#   define ZYAN_ASSUME(condition) \
+        do { if (!(condition)) { __builtin_unreachable(); } } while (0)
+#elif defined(ZYAN_MSVC) || defined(ZYAN_ICC)
+#   define ZYAN_ASSUME(condition) __assume(condition)
+#else
+#   define ZYAN_ASSUME(condition) ((void)0)
+#endif
+
+/**
+ * @brief   Prevents the compiler from inlining the following function.
+ */
+#if defined(ZYAN_GNUC) || defined(ZYAN_ICC)
+#   define ZYAN_NOINLINE __attribute__((noinline))
+#elif defined(ZYAN_MSVC)
+#   define ZYAN_NOINLINE __declspec(noinline)
+#else
+#   define ZYAN_NOINLINE
+#endif
+
+/**
+ * @brief   Marks the following function as frequently executed.
+ *
+ * The function is optimized more aggressively and grouped with other hot functions.
+ */
+#if defined(ZYAN_GNUC)
+#   define ZYAN_HOT __attribute__((hot))
+#else
+#   define ZYAN_HOT
+#endif
+
+/**
+ * @brief   Marks the following function as rarely executed.
+ *
+ * The function is optimized for size and placed apart from the hot code. Branches that lead to a
+ * call of the function are treated as unlikely.
+ */
+#if defined(ZYAN_GNUC)
+#   define ZYAN_COLD __attribute__((cold))
+#else
+#   define ZYAN_COLD
+#endif
+
+/**
+ * @brief   Declares that the memory accessed through the qualified pointer is not accessed through
+ *          any other pointer (C99 `restrict`).
+ */
+#if defined(__cplusplus) || !defined(__STDC_VERSION__) || (__STDC_VERSION__ < 199901L)
+#   if defined(ZYAN_GNUC) || defined(ZYAN_MSVC) || defined(ZYAN_ICC)
+#       define ZYAN_RESTRICT __restrict
+#   else
+#       define ZYAN_RESTRICT
+#   endif
+#else
+#   define ZYAN_RESTRICT restrict
+#endif
+
+/**
+ * @brief   Hints the CPU to fetch the cache line at the given address for reading.
+ *
+ * @param   address The address. Does not need to be valid.
+ */
+#if defined(ZYAN_GNUC)
+#   define ZYAN_PREFETCH(address) __builtin_prefetch((address), 0, 3)
+#elif defined(ZYAN_MSVC) && (defined(ZYAN_X86) || defined(ZYAN_X64))
+#   include <xmmintrin.h>
+#   define ZYAN_PREFETCH(address) _mm_prefetch((const char*)(address), _MM_HINT_T0)
+#else
+#   define ZYAN_PREFETCH(address) ((void)(address))
+#endif
+
+/**
+ * @brief   Hints the CPU to fetch the cache line at the given address for writing.
+ *
+ * @param   address The address. Does not need to be valid.
+ */
+#if defined(ZYAN_GNUC)
+#   define ZYAN_PREFETCH_WRITE(address) __builtin_prefetch((address), 1, 3)
+#else
+#   define ZYAN_PREFETCH_WRITE(address) ZYAN_PREFETCH(address)
+#endif
+
 /* ============================================================================================== */
 /* Utils                                                                                          */
 /* ============================================================================================== */
@@ -208,6 +355,36 @@
  */
 #define ZYAN_ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Structs                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the offset (in bytes) of a member inside a struct.
+ *
+ * @param   type    The type of the struct.
+ * @param   member  The name of the member.
+ *
+ * @return  The offset of the member inside the struct.
+ */
+#if defined(ZYAN_GNUC)
+#   define ZYAN_OFFSETOF(type, member) __builtin_offsetof(type, member)
+#else
+#   define ZYAN_OFFSETOF(type, member) ((char*)&(((type*)0)->member) - (char*)0)
+#endif
+
+/**
+ * @brief   Returns a pointer to the struct that contains the given member.
+ *
+ * @param   ptr     A pointer to the member.
+ * @param   type    The type of the containing struct.
+ * @param   member  The name of the member.
+ *
+ * @return  A pointer to the containing struct.
+ */
+#define ZYAN_CONTAINER_OF(ptr, type, member) \
+    ((type*)((char*)(ptr) - ZYAN_OFFSETOF(type, member)))
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Arithmetic                                                                                     */
 /* ---------------------------------------------------------------------------------------------- */
@@ -0,0 +1,260 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements the double-ended queue container class.
+ */
+
+#ifndef ZYCORE_DEQUE_H
+#define ZYCORE_DEQUE_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanDeque` struct.
+ *
+ * The elements are stored in fixed-size blocks that are referenced by a block map. Growing the
+ * deque at either end only ever allocates a new block and occasionally reallocates the block map,
+ * but never moves any element. Pointers to elements stay valid until the element is removed.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanDeque_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The size of a single element in bytes.
+     */
+    ZyanUSize element_size;
+    /**
+     * @brief   The binary logarithm of the number of elements per block.
+     */
+    ZyanUSize block_shift;
+    /**
+     * @brief   The block map.
+     */
+    void** map;
+    /**
+     * @brief   The capacity of the block map (number of block pointers).
+     */
+    ZyanUSize map_capacity;
+    /**
+     * @brief   The index of the first used entry in the block map.
+     */
+    ZyanUSize map_begin;
+    /**
+     * @brief   The number of used entries in the block map.
+     */
+    ZyanUSize block_count;
+    /**
+     * @brief   The index of the first element inside the first block.
+     */
+    ZyanUSize offset;
+    /**
+     * @brief   The current number of elements in the deque.
+     */
+    ZyanUSize size;
+    /**
+     * @brief   An unused block that is kept to avoid repeated allocations at block boundaries.
+     */
+    void* spare;
+} ZyanDeque;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanDeque` instance.
+ *
+ * @param   deque           A pointer to the `ZyanDeque` instance.
+ * @param   element_size    The size of a single element in bytes.
+ *
+ * @return  A zycore status code.
+ *
+ * The blocks are dynamically allocated by the default allocator. The number of elements per block
+ * is chosen to make a block roughly fill a single memory page.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeInit(ZyanDeque* deque, ZyanUSize element_size);
+
+/**
+ * @brief   Initializes the given `ZyanDeque` instance and sets a custom `allocator` and block
+ *          size.
+ *
+ * @param   deque           A pointer to the `ZyanDeque` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   block_capacity  The number of elements per block. This value is rounded up to the next
+ *                          power of two.
+ * @param   allocator       A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeInitEx(ZyanDeque* deque, ZyanUSize element_size,
+    ZyanUSize block_capacity, ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanDeque` instance.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeDestroy(ZyanDeque* deque);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns a pointer to the element at the given `index`.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   index   The element index.
+ * @param   element Receives a pointer to the desired element in the deque.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeGet(const ZyanDeque* deque, ZyanUSize index, void** element);
+
+/**
+ * @brief   Returns a constant pointer to the element at the given `index`.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   index   The element index.
+ * @param   element Receives a constant pointer to the desired element in the deque.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeGetConst(const ZyanDeque* deque, ZyanUSize index,
+    const void** element);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Assignment                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Assigns a value to the element at the given `index`.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   index   The element index.
+ * @param   element The value to assign.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeAssign(ZyanDeque* deque, ZyanUSize index, const void* element);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Adds a new `element` at the end of the deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   element A pointer to the element to add.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequePushBack(ZyanDeque* deque, const void* element);
+
+/**
+ * @brief   Adds a new `element` at the beginning of the deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   element A pointer to the element to add.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequePushFront(ZyanDeque* deque, const void* element);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Removes the last element of the deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   element Receives a copy of the removed element. Pass `ZYAN_NULL` to discard it.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequePopBack(ZyanDeque* deque, void* element);
+
+/**
+ * @brief   Removes the first element of the deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   element Receives a copy of the removed element. Pass `ZYAN_NULL` to discard it.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequePopFront(ZyanDeque* deque, void* element);
+
+/**
+ * @brief   Erases all elements of the given deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeClear(ZyanDeque* deque);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the current size of the deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   size    Receives the size of the deque.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeSize(const ZyanDeque* deque, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_DEQUE_H */
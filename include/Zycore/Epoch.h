@@ -0,0 +1,254 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements epoch-based memory reclamation for lock-free data structures.
+ *
+ * Threads that access a lock-free data structure register as participants of an epoch domain and
+ * enclose every access in `ZyanEpochEnter` and `ZyanEpochLeave`. Blocks that were unlinked from
+ * the data structure are passed to `ZyanEpochRetire` instead of being released right away. They
+ * are returned to their allocator once the global epoch advanced twice, as this guarantees that
+ * every thread that might still have observed them has left its critical section.
+ */
+
+#ifndef ZYCORE_EPOCH_H
+#define ZYCORE_EPOCH_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Atomic.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanEpochParticipant` struct.
+ *
+ * Every participant must only be used by a single thread at a time.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanEpochParticipant_
+{
+    /**
+     * @brief   The epoch the participant observed when it entered its critical section, shifted
+     *          left by one and combined with the active bit (`0` if the participant is inactive).
+     */
+    ZyanAtomic64 local_epoch;
+    /**
+     * @brief   Set to `1`, if the participant record is owned by a thread.
+     */
+    ZyanAtomic32 in_use;
+    /**
+     * @brief   The nesting depth of the critical sections.
+     */
+    ZyanU32 nesting;
+    /**
+     * @brief   The domain.
+     */
+    struct ZyanEpochDomain_* domain;
+    /**
+     * @brief   The next participant of the domain.
+     */
+    struct ZyanEpochParticipant_* next;
+    /**
+     * @brief   The blocks that were retired during the last three epochs.
+     */
+    ZyanVector retired[3];
+    /**
+     * @brief   The epoch of the blocks in each of the `retired` vectors.
+     */
+    ZyanU64 retired_epoch[3];
+    /**
+     * @brief   The total number of retired blocks that were not released yet.
+     */
+    ZyanUSize retired_count;
+} ZyanEpochParticipant;
+
+/**
+ * @brief   Defines the `ZyanEpochDomain` struct.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanEpochDomain_
+{
+    /**
+     * @brief   The memory allocator for the participant records.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The global epoch.
+     */
+    ZyanAtomic64 epoch;
+    /**
+     * @brief   The first participant record. Records are only released by
+     *          `ZyanEpochDomainDestroy`.
+     */
+    ZyanAtomicPointer participants;
+} ZyanEpochDomain;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanEpochDomain` instance.
+ *
+ * @param   domain  A pointer to the `ZyanEpochDomain` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * The participant records are allocated by the default allocator.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEpochDomainInit(ZyanEpochDomain* domain);
+
+/**
+ * @brief   Initializes the given `ZyanEpochDomain` instance and sets a custom `allocator`.
+ *
+ * @param   domain      A pointer to the `ZyanEpochDomain` instance.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance. It is used concurrently by all
+ *                      participants.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEpochDomainInitEx(ZyanEpochDomain* domain, ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanEpochDomain` instance and releases all retired blocks.
+ *
+ * @param   domain  A pointer to the `ZyanEpochDomain` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * No thread must access the domain or any of its participants anymore.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEpochDomainDestroy(ZyanEpochDomain* domain);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Participants                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Registers the calling thread as a participant of the given domain.
+ *
+ * @param   domain      A pointer to the `ZyanEpochDomain` instance.
+ * @param   participant Receives a pointer to the `ZyanEpochParticipant` record.
+ *
+ * @return  A zycore status code.
+ *
+ * Records of unregistered participants are reused, before new records are allocated.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEpochDomainRegister(ZyanEpochDomain* domain,
+    ZyanEpochParticipant** participant);
+
+/**
+ * @brief   Unregisters the given participant.
+ *
+ * @param   participant A pointer to the `ZyanEpochParticipant` record.
+ *
+ * @return  A zycore status code.
+ *
+ * Retired blocks that can not be released yet are kept in the record and released by the next
+ * thread that reuses the record or by `ZyanEpochDomainDestroy`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEpochDomainUnregister(ZyanEpochParticipant* participant);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Critical sections                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Enters a critical section.
+ *
+ * @param   participant A pointer to the `ZyanEpochParticipant` record.
+ *
+ * @return  A zycore status code.
+ *
+ * Pointers to shared blocks must only be dereferenced within a critical section. Critical sections
+ * can be nested.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEpochEnter(ZyanEpochParticipant* participant);
+
+/**
+ * @brief   Leaves a critical section.
+ *
+ * @param   participant A pointer to the `ZyanEpochParticipant` record.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEpochLeave(ZyanEpochParticipant* participant);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Reclamation                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Retires a block that is no longer reachable by new readers.
+ *
+ * @param   participant     A pointer to the `ZyanEpochParticipant` record.
+ * @param   allocator       A pointer to the `ZyanAllocator` instance that owns the block.
+ * @param   p               A pointer to the block.
+ * @param   element_size    The size of a single element of the block.
+ * @param   n               The number of elements of the block.
+ *
+ * @return  A zycore status code.
+ *
+ * The block is passed to the `deallocate` function of the allocator, once no thread can observe
+ * it anymore. The participant occasionally tries to advance the global epoch and to release its
+ * retired blocks.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEpochRetire(ZyanEpochParticipant* participant,
+    ZyanAllocator* allocator, void* p, ZyanUSize element_size, ZyanUSize n);
+
+/**
+ * @brief   Tries to advance the global epoch and releases all retired blocks of the given
+ *          participant that are no longer observable.
+ *
+ * @param   participant A pointer to the `ZyanEpochParticipant` record.
+ *
+ * @return  A zycore status code.
+ *
+ * The global epoch can only advance, if all participants that are inside a critical section have
+ * observed the current epoch.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEpochCollect(ZyanEpochParticipant* participant);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_EPOCH_H */
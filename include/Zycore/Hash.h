@@ -0,0 +1,200 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Provides fast non-cryptographic hash functions.
+ */
+
+#ifndef ZYCORE_HASH_H
+#define ZYCORE_HASH_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Defines.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanHashState` struct.
+ *
+ * The state of a streaming hash computation. Feeding the input in multiple chunks produces the
+ * same hash as hashing it at once.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanHashState_
+{
+    /**
+     * @brief   The seed.
+     */
+    ZyanU64 seed;
+    /**
+     * @brief   The total number of bytes processed so far.
+     */
+    ZyanU64 length;
+    /**
+     * @brief   The four accumulator lanes.
+     */
+    ZyanU64 lanes[4];
+    /**
+     * @brief   Input bytes that do not yet form a complete 32-byte stripe.
+     */
+    ZyanU8 buffer[32];
+    /**
+     * @brief   The number of bytes in `buffer`.
+     */
+    ZyanU32 buffer_size;
+} ZyanHashState;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Byte strings                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Calculates the 64-bit hash of the given data.
+ *
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ * @param   seed    The seed.
+ * @param   hash    Receives the hash value.
+ *
+ * @return  A zycore status code.
+ *
+ * The result is identical to `XXH64` and does not depend on the host byte order.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashBytes(const void* data, ZyanUSize size, ZyanU64 seed,
+    ZyanU64* hash);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Streaming                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanHashState` instance.
+ *
+ * @param   state   A pointer to the `ZyanHashState` instance.
+ * @param   seed    The seed.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashInit(ZyanHashState* state, ZyanU64 seed);
+
+/**
+ * @brief   Feeds data into the given hash state.
+ *
+ * @param   state   A pointer to the `ZyanHashState` instance.
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashUpdate(ZyanHashState* state, const void* data, ZyanUSize size);
+
+/**
+ * @brief   Returns the hash of all data fed into the given hash state.
+ *
+ * @param   state   A pointer to the `ZyanHashState` instance.
+ * @param   hash    Receives the hash value.
+ *
+ * @return  A zycore status code.
+ *
+ * The state is not modified, so more data may be fed afterwards.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashFinal(const ZyanHashState* state, ZyanU64* hash);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Integer mixers                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Mixes all bits of the given 32-bit value.
+ *
+ * @param   value   The value.
+ *
+ * @return  The mixed value.
+ *
+ * The function is a bijection, so distinct inputs never collide.
+ */
+ZYAN_INLINE ZyanU32 ZyanHashU32(ZyanU32 value)
+{
+    value ^= value >> 16;
+    value *= 0x85EBCA6B;
+    value ^= value >> 13;
+    value *= 0xC2B2AE35;
+    value ^= value >> 16;
+
+    return value;
+}
+
+/**
+ * @brief   Mixes all bits of the given 64-bit value.
+ *
+ * @param   value   The value.
+ *
+ * @return  The mixed value.
+ *
+ * The function is a bijection, so distinct inputs never collide.
+ */
+ZYAN_INLINE ZyanU64 ZyanHashU64(ZyanU64 value)
+{
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCD;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53;
+    value ^= value >> 33;
+
+    return value;
+}
+
+/**
+ * @brief   Combines two hash values.
+ *
+ * @param   hash    The running hash value.
+ * @param   value   The hash value to combine with.
+ *
+ * @return  The combined hash value.
+ *
+ * The result depends on the order of the arguments.
+ */
+ZYAN_INLINE ZyanU64 ZyanHashCombine(ZyanU64 hash, ZyanU64 value)
+{
+    return ZyanHashU64(hash ^ (value + 0x9E3779B97F4A7C15 + (hash << 6) + (hash >> 2)));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_HASH_H */
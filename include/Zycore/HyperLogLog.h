@@ -0,0 +1,253 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements a HyperLogLog sketch for distinct count estimation.
+ */
+
+#ifndef ZYCORE_HYPER_LOG_LOG_H
+#define ZYCORE_HYPER_LOG_LOG_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * @brief   The minimum precision of a `ZyanHyperLogLog` sketch.
+ */
+#define ZYAN_HYPER_LOG_LOG_MIN_PRECISION 4
+
+/**
+ * @brief   The maximum precision of a `ZyanHyperLogLog` sketch.
+ */
+#define ZYAN_HYPER_LOG_LOG_MAX_PRECISION 18
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanHyperLogLog` struct.
+ *
+ * A sketch with precision `p` uses `2^p` registers and estimates the number of distinct elements
+ * with a standard error of about `1.04 / sqrt(2^p)`.
+ *
+ * Sketches start in a sparse representation that only stores the registers that are not zero and
+ * switch to the dense representation (one byte per register) once the sparse one would use more
+ * memory.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanHyperLogLog_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The precision (number of index bits).
+     */
+    ZyanU8 precision;
+    /**
+     * @brief   Signals, if the sketch uses the sparse representation.
+     */
+    ZyanBool is_sparse;
+    /**
+     * @brief   The registers.
+     *
+     * In the sparse representation, this vector contains `ZyanU32` entries that are sorted by
+     * register index and encode the register index in the upper and the value in the lowest 8
+     * bits. In the dense representation, it contains one `ZyanU8` per register.
+     */
+    ZyanVector registers;
+} ZyanHyperLogLog;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanHyperLogLog` instance.
+ *
+ * @param   hll         A pointer to the `ZyanHyperLogLog` instance.
+ * @param   precision   The precision (from `ZYAN_HYPER_LOG_LOG_MIN_PRECISION` to
+ *                      `ZYAN_HYPER_LOG_LOG_MAX_PRECISION`).
+ *
+ * @return  A zycore status code.
+ *
+ * The registers are allocated by the default allocator.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHyperLogLogInit(ZyanHyperLogLog* hll, ZyanU8 precision);
+
+/**
+ * @brief   Initializes the given `ZyanHyperLogLog` instance and sets a custom `allocator`.
+ *
+ * @param   hll         A pointer to the `ZyanHyperLogLog` instance.
+ * @param   precision   The precision (from `ZYAN_HYPER_LOG_LOG_MIN_PRECISION` to
+ *                      `ZYAN_HYPER_LOG_LOG_MAX_PRECISION`).
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHyperLogLogInitEx(ZyanHyperLogLog* hll, ZyanU8 precision,
+    ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanHyperLogLog` instance.
+ *
+ * @param   hll A pointer to the `ZyanHyperLogLog` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHyperLogLogDestroy(ZyanHyperLogLog* hll);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Adds an element to the sketch.
+ *
+ * @param   hll     A pointer to the `ZyanHyperLogLog` instance.
+ * @param   element A pointer to the element.
+ * @param   size    The size of the element in bytes.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHyperLogLogAdd(ZyanHyperLogLog* hll, const void* element,
+    ZyanUSize size);
+
+/**
+ * @brief   Adds an element, given by its 64-bit hash value, to the sketch.
+ *
+ * @param   hll     A pointer to the `ZyanHyperLogLog` instance.
+ * @param   hash    The hash value of the element.
+ *
+ * @return  A zycore status code.
+ *
+ * The hash must be of good quality in all 64 bits.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHyperLogLogAddHash(ZyanHyperLogLog* hll, ZyanU64 hash);
+
+/**
+ * @brief   Merges the `source` sketch into the `destination` sketch.
+ *
+ * @param   destination A pointer to the destination `ZyanHyperLogLog` instance.
+ * @param   source      A pointer to the source `ZyanHyperLogLog` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * Both sketches must have the same precision. Afterwards the destination sketch estimates the
+ * number of distinct elements of the union of both streams.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHyperLogLogMerge(ZyanHyperLogLog* destination,
+    const ZyanHyperLogLog* source);
+
+/**
+ * @brief   Resets the sketch to the empty state.
+ *
+ * @param   hll A pointer to the `ZyanHyperLogLog` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHyperLogLogClear(ZyanHyperLogLog* hll);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Estimation                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Estimates the number of distinct elements that were added to the sketch.
+ *
+ * @param   hll     A pointer to the `ZyanHyperLogLog` instance.
+ * @param   count   Receives the estimated number of distinct elements.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHyperLogLogEstimate(const ZyanHyperLogLog* hll, ZyanU64* count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Serialization                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the number of bytes required to serialize the sketch.
+ *
+ * @param   hll     A pointer to the `ZyanHyperLogLog` instance.
+ * @param   size    Receives the number of bytes.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHyperLogLogSerializedSize(const ZyanHyperLogLog* hll,
+    ZyanUSize* size);
+
+/**
+ * @brief   Serializes the sketch into the given buffer.
+ *
+ * @param   hll         A pointer to the `ZyanHyperLogLog` instance.
+ * @param   buffer      A pointer to the buffer.
+ * @param   capacity    The size of the buffer in bytes.
+ *
+ * @return  A zycore status code.
+ *
+ * The serialized format is independent of the host byte order and keeps the current
+ * representation of the sketch.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHyperLogLogSerialize(const ZyanHyperLogLog* hll, void* buffer,
+    ZyanUSize capacity);
+
+/**
+ * @brief   Initializes the given `ZyanHyperLogLog` instance from serialized data.
+ *
+ * @param   hll         A pointer to the `ZyanHyperLogLog` instance.
+ * @param   buffer      A pointer to the serialized data.
+ * @param   size        The size of the serialized data in bytes.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * Returns `ZYAN_STATUS_INVALID_ARGUMENT`, if the data is malformed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHyperLogLogDeserialize(ZyanHyperLogLog* hll, const void* buffer,
+    ZyanUSize size, ZyanAllocator* allocator);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_HYPER_LOG_LOG_H */
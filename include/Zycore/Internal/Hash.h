@@ -0,0 +1,67 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Provides internal hashing helpers that are shared by the hash based containers.
+ */
+
+#ifndef ZYCORE_INTERNAL_HASH_H
+#define ZYCORE_INTERNAL_HASH_H
+
+#include <Zycore/Defines.h>
+#include <Zycore/Hash.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the hash value of the given byte string, using the default seed.
+ *
+ * @param   data    A pointer to the data. May only be `ZYAN_NULL`, if `size` is `0`.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  The hash value.
+ *
+ * `ZyanHashBytes` only fails for invalid arguments, which the callers rule out up front.
+ */
+ZYAN_INLINE ZyanU64 ZyanHashBytesValue(const void* data, ZyanUSize size)
+{
+    ZYAN_ASSERT(data || !size);
+
+    ZyanU64 hash = 0;
+    const ZyanStatus status = ZyanHashBytes(data, size, 0, &hash);
+    ZYAN_ASSERT(ZYAN_SUCCESS(status));
+    ZYAN_UNUSED(status);
+
+    return hash;
+}
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_INTERNAL_HASH_H */
@@ -0,0 +1,83 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Provides internal math helper functions that do not depend on the C runtime.
+ */
+
+#ifndef ZYCORE_INTERNAL_MATH_H
+#define ZYCORE_INTERNAL_MATH_H
+
+#include <Zycore/Defines.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   Computes the natural logarithm of `x`.
+ *
+ * @param   x   The value (must be greater than zero).
+ *
+ * @return  The natural logarithm of `x`.
+ *
+ * The value is reduced to the interval `[1, 2)` and the logarithm of the mantissa is computed by
+ * the `atanh` series, which converges to double precision in less than 20 iterations.
+ */
+ZYAN_INLINE double ZyanMathLog(double x)
+{
+    ZYAN_ASSERT(x > 0.0);
+
+    ZyanI32 exponent = 0;
+    while (x >= 2.0)
+    {
+        x *= 0.5;
+        ++exponent;
+    }
+    while (x < 1.0)
+    {
+        x *= 2.0;
+        --exponent;
+    }
+
+    const double y = (x - 1.0) / (x + 1.0);
+    const double y2 = y * y;
+    double term = y;
+    double sum = 0.0;
+    for (ZyanU32 i = 1; i < 40; i += 2)
+    {
+        sum += term / i;
+        term *= y2;
+    }
+
+    return 2.0 * sum + exponent * 0.69314718055994530942;
+}
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_INTERNAL_MATH_H */
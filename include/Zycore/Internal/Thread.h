@@ -0,0 +1,385 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Provides internal wrappers around the threading primitives of the operating system.
+ *
+ * This header includes the system headers of the respective platform and must therefore only be
+ * included by translation units, but never by public headers.
+ */
+
+#ifndef ZYCORE_INTERNAL_THREAD_H
+#define ZYCORE_INTERNAL_THREAD_H
+
+#include <Zycore/Atomic.h>
+#include <Zycore/Defines.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#if defined(ZYAN_WINDOWS)
+#   include <windows.h>
+#elif defined(ZYAN_POSIX)
+#   include <pthread.h>
+#   include <sched.h>
+#   include <unistd.h>
+#   if defined(ZYAN_LINUX)
+#       include <linux/futex.h>
+#       include <sys/syscall.h>
+#   endif
+#else
+#   error "Unsupported platform detected"
+#endif
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Declares a variable with thread storage duration.
+ */
+#if defined(ZYAN_MSVC)
+#   define ZYAN_THREAD_LOCAL __declspec(thread)
+#elif defined(ZYAN_GNUC) || defined(ZYAN_ICC)
+#   define ZYAN_THREAD_LOCAL __thread
+#else
+#   define ZYAN_THREAD_LOCAL _Thread_local
+#endif
+
+/**
+ * @brief   Defines a thread entry point with the signature expected by the operating system.
+ *
+ * @param   name        The name of the function.
+ * @param   argument    The name of the `void*` argument.
+ *
+ * The function body has to end with `ZYAN_THREAD_ROUTINE_RETURN;`.
+ */
+#if defined(ZYAN_WINDOWS)
+#   define ZYAN_THREAD_ROUTINE(name, argument) static DWORD WINAPI name(LPVOID argument)
+#   define ZYAN_THREAD_ROUTINE_RETURN return 0
+#else
+#   define ZYAN_THREAD_ROUTINE(name, argument) static void* name(void* argument)
+#   define ZYAN_THREAD_ROUTINE_RETURN return ZYAN_NULL
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+#if defined(ZYAN_WINDOWS)
+
+typedef HANDLE ZyanThread;
+typedef LPTHREAD_START_ROUTINE ZyanThreadRoutine;
+typedef CRITICAL_SECTION ZyanMutex;
+typedef CONDITION_VARIABLE ZyanCondition;
+
+#else
+
+typedef pthread_t ZyanThread;
+typedef void* (*ZyanThreadRoutine)(void*);
+typedef pthread_mutex_t ZyanMutex;
+typedef pthread_cond_t ZyanCondition;
+
+#endif
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Thread                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Starts a new thread.
+ *
+ * @param   thread      Receives the handle of the new thread.
+ * @param   routine     The entry point (see `ZYAN_THREAD_ROUTINE`).
+ * @param   argument    The argument that is passed to the entry point.
+ *
+ * @return  A zycore status code.
+ */
+ZYAN_INLINE ZyanStatus ZyanThreadCreate(ZyanThread* thread, ZyanThreadRoutine routine,
+    void* argument)
+{
+#if defined(ZYAN_WINDOWS)
+    *thread = CreateThread(ZYAN_NULL, 0, routine, argument, 0, ZYAN_NULL);
+    return *thread ? ZYAN_STATUS_SUCCESS : ZYAN_STATUS_BAD_SYSTEMCALL;
+#else
+    return pthread_create(thread, ZYAN_NULL, routine, argument)
+        ? ZYAN_STATUS_BAD_SYSTEMCALL : ZYAN_STATUS_SUCCESS;
+#endif
+}
+
+/**
+ * @brief   Waits for the given thread to exit and releases its handle.
+ *
+ * @param   thread  The thread handle.
+ *
+ * @return  A zycore status code.
+ */
+ZYAN_INLINE ZyanStatus ZyanThreadJoin(ZyanThread thread)
+{
+#if defined(ZYAN_WINDOWS)
+    const DWORD result = WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+    return (result == WAIT_OBJECT_0) ? ZYAN_STATUS_SUCCESS : ZYAN_STATUS_BAD_SYSTEMCALL;
+#else
+    return pthread_join(thread, ZYAN_NULL) ? ZYAN_STATUS_BAD_SYSTEMCALL : ZYAN_STATUS_SUCCESS;
+#endif
+}
+
+/**
+ * @brief   Yields the remaining time slice of the calling thread to the operating system.
+ */
+ZYAN_INLINE void ZyanThreadYield(void)
+{
+#if defined(ZYAN_WINDOWS)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+/**
+ * @brief   Returns the number of logical processors that are available to the process.
+ *
+ * @return  The number of logical processors or `1`, if the number could not be determined.
+ */
+ZYAN_INLINE ZyanUSize ZyanThreadGetHardwareConcurrency(void)
+{
+#if defined(ZYAN_WINDOWS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors ? (ZyanUSize)info.dwNumberOfProcessors : 1;
+#else
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (ZyanUSize)count : 1;
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Mutex                                                                                          */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given mutex.
+ *
+ * @param   mutex   A pointer to the mutex.
+ *
+ * @return  A zycore status code.
+ */
+ZYAN_INLINE ZyanStatus ZyanMutexInit(ZyanMutex* mutex)
+{
+#if defined(ZYAN_WINDOWS)
+    InitializeCriticalSection(mutex);
+    return ZYAN_STATUS_SUCCESS;
+#else
+    return pthread_mutex_init(mutex, ZYAN_NULL) ? ZYAN_STATUS_BAD_SYSTEMCALL : ZYAN_STATUS_SUCCESS;
+#endif
+}
+
+/**
+ * @brief   Destroys the given mutex.
+ *
+ * @param   mutex   A pointer to the mutex.
+ */
+ZYAN_INLINE void ZyanMutexDestroy(ZyanMutex* mutex)
+{
+#if defined(ZYAN_WINDOWS)
+    DeleteCriticalSection(mutex);
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+/**
+ * @brief   Acquires the given mutex.
+ *
+ * @param   mutex   A pointer to the mutex.
+ */
+ZYAN_INLINE void ZyanMutexLock(ZyanMutex* mutex)
+{
+#if defined(ZYAN_WINDOWS)
+    EnterCriticalSection(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+/**
+ * @brief   Releases the given mutex.
+ *
+ * @param   mutex   A pointer to the mutex.
+ */
+ZYAN_INLINE void ZyanMutexUnlock(ZyanMutex* mutex)
+{
+#if defined(ZYAN_WINDOWS)
+    LeaveCriticalSection(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Condition variable                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given condition variable.
+ *
+ * @param   condition   A pointer to the condition variable.
+ *
+ * @return  A zycore status code.
+ */
+ZYAN_INLINE ZyanStatus ZyanConditionInit(ZyanCondition* condition)
+{
+#if defined(ZYAN_WINDOWS)
+    InitializeConditionVariable(condition);
+    return ZYAN_STATUS_SUCCESS;
+#else
+    return pthread_cond_init(condition, ZYAN_NULL)
+        ? ZYAN_STATUS_BAD_SYSTEMCALL : ZYAN_STATUS_SUCCESS;
+#endif
+}
+
+/**
+ * @brief   Destroys the given condition variable.
+ *
+ * @param   condition   A pointer to the condition variable.
+ */
+ZYAN_INLINE void ZyanConditionDestroy(ZyanCondition* condition)
+{
+#if defined(ZYAN_WINDOWS)
+    ZYAN_UNUSED(condition);
+#else
+    pthread_cond_destroy(condition);
+#endif
+}
+
+/**
+ * @brief   Atomically releases the given mutex and blocks until the condition variable is
+ *          signaled. The mutex is reacquired before the function returns.
+ *
+ * @param   condition   A pointer to the condition variable.
+ * @param   mutex       A pointer to the mutex (must be owned by the calling thread).
+ *
+ * Spurious wakeups are possible.
+ */
+ZYAN_INLINE void ZyanConditionWait(ZyanCondition* condition, ZyanMutex* mutex)
+{
+#if defined(ZYAN_WINDOWS)
+    SleepConditionVariableCS(condition, mutex, INFINITE);
+#else
+    pthread_cond_wait(condition, mutex);
+#endif
+}
+
+/**
+ * @brief   Wakes up one thread that waits on the given condition variable.
+ *
+ * @param   condition   A pointer to the condition variable.
+ */
+ZYAN_INLINE void ZyanConditionSignal(ZyanCondition* condition)
+{
+#if defined(ZYAN_WINDOWS)
+    WakeConditionVariable(condition);
+#else
+    pthread_cond_signal(condition);
+#endif
+}
+
+/**
+ * @brief   Wakes up all threads that wait on the given condition variable.
+ *
+ * @param   condition   A pointer to the condition variable.
+ */
+ZYAN_INLINE void ZyanConditionBroadcast(ZyanCondition* condition)
+{
+#if defined(ZYAN_WINDOWS)
+    WakeAllConditionVariable(condition);
+#else
+    pthread_cond_broadcast(condition);
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Futex                                                                                          */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Blocks the calling thread as long as the given variable contains the `expected` value.
+ *
+ * @param   address     A pointer to the `ZyanAtomic32` instance.
+ * @param   expected    The expected value.
+ *
+ * Spurious wakeups are possible. Platforms that do not provide a futex-like system call (e.g.
+ * macOS) yield the remaining time slice instead of blocking.
+ */
+ZYAN_INLINE void ZyanFutexWait(ZyanAtomic32* address, ZyanU32 expected)
+{
+#if defined(ZYAN_WINDOWS)
+    WaitOnAddress((volatile VOID*)&address->value, &expected, sizeof(expected), INFINITE);
+#elif defined(ZYAN_LINUX)
+    syscall(SYS_futex, &address->value, FUTEX_WAIT_PRIVATE, expected, ZYAN_NULL, ZYAN_NULL, 0);
+#else
+    ZYAN_UNUSED(address);
+    ZYAN_UNUSED(expected);
+    ZyanThreadYield();
+#endif
+}
+
+/**
+ * @brief   Wakes up threads that are blocked in `ZyanFutexWait` on the given variable.
+ *
+ * @param   address     A pointer to the `ZyanAtomic32` instance.
+ * @param   all         `ZYAN_TRUE` to wake up all waiting threads or `ZYAN_FALSE` to wake up a
+ *                      single one.
+ */
+ZYAN_INLINE void ZyanFutexWake(ZyanAtomic32* address, ZyanBool all)
+{
+#if defined(ZYAN_WINDOWS)
+    if (all)
+    {
+        WakeByAddressAll((PVOID)&address->value);
+    } else
+    {
+        WakeByAddressSingle((PVOID)&address->value);
+    }
+#elif defined(ZYAN_LINUX)
+    syscall(SYS_futex, &address->value, FUTEX_WAKE_PRIVATE, all ? 0x7FFFFFFF : 1, ZYAN_NULL,
+        ZYAN_NULL, 0);
+#else
+    ZYAN_UNUSED(address);
+    ZYAN_UNUSED(all);
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_INTERNAL_THREAD_H */
@@ -0,0 +1,426 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements an intrusive doubly linked list.
+ *
+ * The list does not own any memory. Instead, a `ZyanIntrusiveListNode` is embedded into the user
+ * defined struct and `ZYAN_INTRUSIVE_LIST_ENTRY` is used to get back from a node to the containing
+ * struct. All operations are `O(1)` and can't fail, which is why they are implemented inline and
+ * don't return status codes.
+ */
+
+#ifndef ZYCORE_INTRUSIVE_LIST_H
+#define ZYCORE_INTRUSIVE_LIST_H
+
+#include <Zycore/Defines.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanIntrusiveListNode` struct.
+ *
+ * Embed this struct into your own struct to make it linkable.
+ */
+typedef struct ZyanIntrusiveListNode_
+{
+    /**
+     * @brief   A pointer to the previous node or `ZYAN_NULL`, if this is the first node.
+     */
+    struct ZyanIntrusiveListNode_* prev;
+    /**
+     * @brief   A pointer to the next node or `ZYAN_NULL`, if this is the last node.
+     */
+    struct ZyanIntrusiveListNode_* next;
+} ZyanIntrusiveListNode;
+
+/**
+ * @brief   Defines the `ZyanIntrusiveList` struct.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanIntrusiveList_
+{
+    /**
+     * @brief   A pointer to the first node.
+     */
+    ZyanIntrusiveListNode* head;
+    /**
+     * @brief   A pointer to the last node.
+     */
+    ZyanIntrusiveListNode* tail;
+    /**
+     * @brief   The number of nodes in the list.
+     */
+    ZyanUSize size;
+} ZyanIntrusiveList;
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns a pointer to the struct that contains the given list node.
+ *
+ * @param   node    A pointer to the `ZyanIntrusiveListNode` instance.
+ * @param   type    The type of the containing struct.
+ * @param   member  The name of the `ZyanIntrusiveListNode` member inside the containing struct.
+ *
+ * @return  A pointer to the containing struct.
+ */
+#define ZYAN_INTRUSIVE_LIST_ENTRY(node, type, member) \
+    ZYAN_CONTAINER_OF(node, type, member)
+
+/* ============================================================================================== */
+/* Functions                                                                                      */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanIntrusiveList` instance.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ */
+ZYAN_INLINE void ZyanIntrusiveListInit(ZyanIntrusiveList* list)
+{
+    ZYAN_ASSERT(list);
+
+    list->head = ZYAN_NULL;
+    list->tail = ZYAN_NULL;
+    list->size = 0;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the first node of the given list.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ *
+ * @return  A pointer to the first node or `ZYAN_NULL`, if the list is empty.
+ */
+ZYAN_INLINE ZyanIntrusiveListNode* ZyanIntrusiveListHead(const ZyanIntrusiveList* list)
+{
+    ZYAN_ASSERT(list);
+
+    return list->head;
+}
+
+/**
+ * @brief   Returns the last node of the given list.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ *
+ * @return  A pointer to the last node or `ZYAN_NULL`, if the list is empty.
+ */
+ZYAN_INLINE ZyanIntrusiveListNode* ZyanIntrusiveListTail(const ZyanIntrusiveList* list)
+{
+    ZYAN_ASSERT(list);
+
+    return list->tail;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Inserts a `node` before the given `position`.
+ *
+ * @param   list        A pointer to the `ZyanIntrusiveList` instance.
+ * @param   position    A pointer to a node of the list or `ZYAN_NULL` to append the node to the
+ *                      end of the list.
+ * @param   node        A pointer to the node to insert. The node must not be linked into any list.
+ */
+ZYAN_INLINE void ZyanIntrusiveListInsertBefore(ZyanIntrusiveList* list,
+    ZyanIntrusiveListNode* position, ZyanIntrusiveListNode* node)
+{
+    ZYAN_ASSERT(list);
+    ZYAN_ASSERT(node);
+
+    node->next = position;
+    node->prev = position ? position->prev : list->tail;
+    if (node->prev)
+    {
+        node->prev->next = node;
+    } else
+    {
+        list->head = node;
+    }
+    if (position)
+    {
+        position->prev = node;
+    } else
+    {
+        list->tail = node;
+    }
+    ++list->size;
+}
+
+/**
+ * @brief   Inserts a `node` after the given `position`.
+ *
+ * @param   list        A pointer to the `ZyanIntrusiveList` instance.
+ * @param   position    A pointer to a node of the list or `ZYAN_NULL` to prepend the node to the
+ *                      beginning of the list.
+ * @param   node        A pointer to the node to insert. The node must not be linked into any list.
+ */
+ZYAN_INLINE void ZyanIntrusiveListInsertAfter(ZyanIntrusiveList* list,
+    ZyanIntrusiveListNode* position, ZyanIntrusiveListNode* node)
+{
+    ZYAN_ASSERT(list);
+
+    ZyanIntrusiveListInsertBefore(list, position ? position->next : list->head, node);
+}
+
+/**
+ * @brief   Adds a `node` at the beginning of the list.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ * @param   node    A pointer to the node to insert. The node must not be linked into any list.
+ */
+ZYAN_INLINE void ZyanIntrusiveListPushFront(ZyanIntrusiveList* list, ZyanIntrusiveListNode* node)
+{
+    ZYAN_ASSERT(list);
+
+    ZyanIntrusiveListInsertBefore(list, list->head, node);
+}
+
+/**
+ * @brief   Adds a `node` at the end of the list.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ * @param   node    A pointer to the node to insert. The node must not be linked into any list.
+ */
+ZYAN_INLINE void ZyanIntrusiveListPushBack(ZyanIntrusiveList* list, ZyanIntrusiveListNode* node)
+{
+    ZyanIntrusiveListInsertBefore(list, ZYAN_NULL, node);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Unlinks the given `node` from the list.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ * @param   node    A pointer to a node of the list.
+ */
+ZYAN_INLINE void ZyanIntrusiveListRemove(ZyanIntrusiveList* list, ZyanIntrusiveListNode* node)
+{
+    ZYAN_ASSERT(list);
+    ZYAN_ASSERT(node);
+    ZYAN_ASSERT(list->size);
+
+    if (node->prev)
+    {
+        node->prev->next = node->next;
+    } else
+    {
+        list->head = node->next;
+    }
+    if (node->next)
+    {
+        node->next->prev = node->prev;
+    } else
+    {
+        list->tail = node->prev;
+    }
+    node->prev = ZYAN_NULL;
+    node->next = ZYAN_NULL;
+    --list->size;
+}
+
+/**
+ * @brief   Unlinks and returns the first node of the list.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ *
+ * @return  A pointer to the unlinked node or `ZYAN_NULL`, if the list is empty.
+ */
+ZYAN_INLINE ZyanIntrusiveListNode* ZyanIntrusiveListPopFront(ZyanIntrusiveList* list)
+{
+    ZYAN_ASSERT(list);
+
+    ZyanIntrusiveListNode* const node = list->head;
+    if (node)
+    {
+        ZyanIntrusiveListRemove(list, node);
+    }
+    return node;
+}
+
+/**
+ * @brief   Unlinks and returns the last node of the list.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ *
+ * @return  A pointer to the unlinked node or `ZYAN_NULL`, if the list is empty.
+ */
+ZYAN_INLINE ZyanIntrusiveListNode* ZyanIntrusiveListPopBack(ZyanIntrusiveList* list)
+{
+    ZYAN_ASSERT(list);
+
+    ZyanIntrusiveListNode* const node = list->tail;
+    if (node)
+    {
+        ZyanIntrusiveListRemove(list, node);
+    }
+    return node;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Reordering                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Moves the given `node` to the beginning of the list.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ * @param   node    A pointer to a node of the list.
+ */
+ZYAN_INLINE void ZyanIntrusiveListMoveToFront(ZyanIntrusiveList* list, ZyanIntrusiveListNode* node)
+{
+    ZYAN_ASSERT(list);
+    ZYAN_ASSERT(node);
+
+    if (list->head != node)
+    {
+        ZyanIntrusiveListRemove(list, node);
+        ZyanIntrusiveListPushFront(list, node);
+    }
+}
+
+/**
+ * @brief   Moves the given `node` to the end of the list.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ * @param   node    A pointer to a node of the list.
+ */
+ZYAN_INLINE void ZyanIntrusiveListMoveToBack(ZyanIntrusiveList* list, ZyanIntrusiveListNode* node)
+{
+    ZYAN_ASSERT(list);
+    ZYAN_ASSERT(node);
+
+    if (list->tail != node)
+    {
+        ZyanIntrusiveListRemove(list, node);
+        ZyanIntrusiveListPushBack(list, node);
+    }
+}
+
+/**
+ * @brief   Moves all nodes of the `source` list before the given `position` of the `destination`
+ *          list.
+ *
+ * @param   destination A pointer to the destination `ZyanIntrusiveList` instance.
+ * @param   position    A pointer to a node of the destination list or `ZYAN_NULL` to append the
+ *                      nodes to the end of the destination list.
+ * @param   source      A pointer to the source `ZyanIntrusiveList` instance. The source list is
+ *                      empty after this operation.
+ */
+ZYAN_INLINE void ZyanIntrusiveListSplice(ZyanIntrusiveList* destination,
+    ZyanIntrusiveListNode* position, ZyanIntrusiveList* source)
+{
+    ZYAN_ASSERT(destination);
+    ZYAN_ASSERT(source);
+    ZYAN_ASSERT(destination != source);
+
+    if (!source->head)
+    {
+        return;
+    }
+
+    ZyanIntrusiveListNode* const prev = position ? position->prev : destination->tail;
+    source->head->prev = prev;
+    source->tail->next = position;
+    if (prev)
+    {
+        prev->next = source->head;
+    } else
+    {
+        destination->head = source->head;
+    }
+    if (position)
+    {
+        position->prev = source->tail;
+    } else
+    {
+        destination->tail = source->tail;
+    }
+    destination->size += source->size;
+
+    ZyanIntrusiveListInit(source);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the number of nodes in the given list.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ *
+ * @return  The number of nodes in the list.
+ */
+ZYAN_INLINE ZyanUSize ZyanIntrusiveListSize(const ZyanIntrusiveList* list)
+{
+    ZYAN_ASSERT(list);
+
+    return list->size;
+}
+
+/**
+ * @brief   Checks, if the given list is empty.
+ *
+ * @param   list    A pointer to the `ZyanIntrusiveList` instance.
+ *
+ * @return  `ZYAN_TRUE`, if the list is empty or `ZYAN_FALSE`, if not.
+ */
+ZYAN_INLINE ZyanBool ZyanIntrusiveListIsEmpty(const ZyanIntrusiveList* list)
+{
+    ZYAN_ASSERT(list);
+
+    return list->head == ZYAN_NULL;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_INTRUSIVE_LIST_H */
@@ -152,7 +152,7 @@ ZYAN_INLINE void* ZYAN_MEMCHR(const void* str, int c, ZyanUSize n)
 
 ZYAN_INLINE int ZYAN_MEMCMP(const void* s1, const void* s2,ZyanUSize n)
 {
-    const ZyanU8* p1 = s1, *p2 = s2;
+    const ZyanU8* p1 = (const ZyanU8*)s1, *p2 = (const ZyanU8*)s2;
     while (n--)
     {
         if (*p1 != *p2)
@@ -164,10 +164,10 @@ ZYAN_INLINE int ZYAN_MEMCMP(const void* s1, const void* s2,ZyanUSize n)
     return 0;
 }
 
-ZYAN_INLINE void* ZYAN_MEMCPY(void* dst, const void* src, ZyanUSize n)
+ZYAN_INLINE void* ZYAN_MEMCPY(void* ZYAN_RESTRICT dst, const void* ZYAN_RESTRICT src, ZyanUSize n)
 {
-    ZyanU8* dp = dst;
-    const ZyanU8* sp = src;
+    ZyanU8* ZYAN_RESTRICT dp = (ZyanU8*)dst;
+    const ZyanU8* ZYAN_RESTRICT sp = (const ZyanU8*)src;
     while (n--)
     {
         *dp++ = *sp++;
@@ -177,8 +177,8 @@ ZYAN_INLINE void* ZYAN_MEMCPY(void* dst, const void* src, ZyanUSize n)
 
 ZYAN_INLINE void* ZYAN_MEMMOVE(void* dst, const void* src, ZyanUSize n)
 {
-    ZyanU8* pd = dst;
-    const ZyanU8* ps = src;
+    ZyanU8* pd = (ZyanU8*)dst;
+    const ZyanU8* ps = (const ZyanU8*)src;
     if (ps < pd)
     {
         for (pd += n, ps += n; n--;)
@@ -197,7 +197,7 @@ ZYAN_INLINE void* ZYAN_MEMMOVE(void* dst, const void* src, ZyanUSize n)
 
 ZYAN_INLINE void* ZYAN_MEMSET(void* dst, int val, ZyanUSize n)
 {
-    ZyanU8* p = dst;
+    ZyanU8* p = (ZyanU8*)dst;
     while (n--)
     {
         *p++ = (unsigned char)val;
@@ -0,0 +1,374 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements the doubly linked list container class.
+ */
+
+#ifndef ZYCORE_LIST_H
+#define ZYCORE_LIST_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/IntrusiveList.h>
+#include <Zycore/Pool.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanListNode` struct.
+ *
+ * The element data is stored directly behind this struct.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanListNode_
+{
+    /**
+     * @brief   The list link.
+     */
+    ZyanIntrusiveListNode link;
+} ZyanListNode;
+
+/**
+ * @brief   Defines the `ZyanList` struct.
+ *
+ * The nodes of the list are allocated from a `ZyanPool` instance. The pool is either owned by the
+ * list or shared between multiple lists. Nodes can only be moved between lists that share the
+ * same pool.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanList_
+{
+    /**
+     * @brief   A pointer to the shared node pool or `ZYAN_NULL`, if the list owns its pool.
+     */
+    ZyanPool* shared_pool;
+    /**
+     * @brief   The node pool owned by this list (unused, if `shared_pool` is set).
+     */
+    ZyanPool pool;
+    /**
+     * @brief   The linked nodes.
+     */
+    ZyanIntrusiveList nodes;
+    /**
+     * @brief   The size of a single element in bytes.
+     */
+    ZyanUSize element_size;
+} ZyanList;
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the pool block size that is required to store a list node with an element of
+ *          the given size.
+ *
+ * @param   element_size    The size of a single element in bytes.
+ *
+ * @return  The required block size in bytes.
+ */
+#define ZYAN_LIST_NODE_SIZE(element_size) \
+    (sizeof(ZyanListNode) + (element_size))
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanList` instance.
+ *
+ * @param   list            A pointer to the `ZyanList` instance.
+ * @param   element_size    The size of a single element in bytes.
+ *
+ * @return  A zycore status code.
+ *
+ * The list nodes are allocated from a pool owned by the list that obtains its memory from the
+ * default allocator.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListInit(ZyanList* list, ZyanUSize element_size);
+
+/**
+ * @brief   Initializes the given `ZyanList` instance and sets a custom `allocator` and slab size
+ *          for the node pool owned by the list.
+ *
+ * @param   list            A pointer to the `ZyanList` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   slab_capacity   The number of nodes to allocate at once.
+ * @param   allocator       A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListInitEx(ZyanList* list, ZyanUSize element_size,
+    ZyanUSize slab_capacity, ZyanAllocator* allocator);
+
+/**
+ * @brief   Initializes the given `ZyanList` instance and configures it to allocate its nodes from
+ *          a shared `ZyanPool` instance.
+ *
+ * @param   list            A pointer to the `ZyanList` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   pool            A pointer to the `ZyanPool` instance. The block size of the pool must be
+ *                          at least `ZYAN_LIST_NODE_SIZE(element_size)`.
+ *
+ * @return  A zycore status code.
+ *
+ * The pool must outlive the list.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListInitPool(ZyanList* list, ZyanUSize element_size, ZyanPool* pool);
+
+/**
+ * @brief   Destroys the given `ZyanList` instance.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListDestroy(ZyanList* list);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Node access                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns a pointer to the first `ZyanListNode` struct of the given list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ * @param   node    Receives a pointer to the first `ZyanListNode` struct or `ZYAN_NULL`, if the
+ *                  list is empty.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListGetHeadNode(const ZyanList* list, ZyanListNode** node);
+
+/**
+ * @brief   Returns a pointer to the last `ZyanListNode` struct of the given list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ * @param   node    Receives a pointer to the last `ZyanListNode` struct or `ZYAN_NULL`, if the
+ *                  list is empty.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListGetTailNode(const ZyanList* list, ZyanListNode** node);
+
+/**
+ * @brief   Receives a pointer to the next `ZyanListNode` struct.
+ *
+ * @param   node    Receives a pointer to the next `ZyanListNode` struct or `ZYAN_NULL`, if the
+ *                  end of the list was reached.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListGetNextNode(ZyanListNode** node);
+
+/**
+ * @brief   Receives a pointer to the previous `ZyanListNode` struct.
+ *
+ * @param   node    Receives a pointer to the previous `ZyanListNode` struct or `ZYAN_NULL`, if
+ *                  the beginning of the list was reached.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListGetPrevNode(ZyanListNode** node);
+
+/**
+ * @brief   Returns a pointer to the data of the given `node`.
+ *
+ * @param   node    A pointer to the `ZyanListNode` struct.
+ * @param   value   Receives a pointer to the data of the node.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListGetNodeData(const ZyanListNode* node, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Adds a new `element` at the end of the list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ * @param   element A pointer to the element to add.
+ * @param   node    Receives a pointer to the new node. Pass `ZYAN_NULL`, if not needed.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListPushBack(ZyanList* list, const void* element,
+    ZyanListNode** node);
+
+/**
+ * @brief   Adds a new `element` at the beginning of the list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ * @param   element A pointer to the element to add.
+ * @param   node    Receives a pointer to the new node. Pass `ZYAN_NULL`, if not needed.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListPushFront(ZyanList* list, const void* element,
+    ZyanListNode** node);
+
+/**
+ * @brief   Adds multiple `elements` at the end of the list.
+ *
+ * @param   list        A pointer to the `ZyanList` instance.
+ * @param   elements    A pointer to the first element.
+ * @param   count       The number of elements to add.
+ *
+ * @return  A zycore status code.
+ *
+ * The list is not modified, if the allocation of any of the new nodes fails.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListPushBackElements(ZyanList* list, const void* elements,
+    ZyanUSize count);
+
+/**
+ * @brief   Inserts an `element` before the given `position`.
+ *
+ * @param   list        A pointer to the `ZyanList` instance.
+ * @param   position    A pointer to a node of the list or `ZYAN_NULL` to append the element to
+ *                      the end of the list.
+ * @param   element     A pointer to the element to insert.
+ * @param   node        Receives a pointer to the new node. Pass `ZYAN_NULL`, if not needed.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListInsertBefore(ZyanList* list, ZyanListNode* position,
+    const void* element, ZyanListNode** node);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Removes the given `node` from the list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ * @param   node    A pointer to a node of the list.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListRemove(ZyanList* list, ZyanListNode* node);
+
+/**
+ * @brief   Removes the last element of the list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListPopBack(ZyanList* list);
+
+/**
+ * @brief   Removes the first element of the list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListPopFront(ZyanList* list);
+
+/**
+ * @brief   Erases all elements of the given list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListClear(ZyanList* list);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Reordering                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Moves the given `node` to the beginning of the list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ * @param   node    A pointer to a node of the list.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListMoveToFront(ZyanList* list, ZyanListNode* node);
+
+/**
+ * @brief   Moves the given `node` to the end of the list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ * @param   node    A pointer to a node of the list.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListMoveToBack(ZyanList* list, ZyanListNode* node);
+
+/**
+ * @brief   Moves all nodes of the `source` list to the end of the `destination` list.
+ *
+ * @param   destination A pointer to the destination `ZyanList` instance.
+ * @param   source      A pointer to the source `ZyanList` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * Both lists must share the same node pool and element size. This operation does not copy any
+ * element and completes in `O(1)` time.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListSplice(ZyanList* destination, ZyanList* source);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the current size of the list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ * @param   size    Receives the size of the list.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListSize(const ZyanList* list, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_LIST_H */
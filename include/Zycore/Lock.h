@@ -0,0 +1,402 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements lightweight lock primitives.
+ *
+ * All locks in this file spin for a short amount of time before they block the calling thread, as
+ * most critical sections that guard Zycore containers are much shorter than a system call. None
+ * of the locks is recursive. Without the C runtime (`ZYCORE_NO_LIBC`), blocking is replaced by
+ * busy waiting.
+ */
+
+#ifndef ZYCORE_LOCK_H
+#define ZYCORE_LOCK_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Atomic.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanLock` struct.
+ *
+ * An adaptive mutex that spins for a short amount of time and then waits on a futex. Releasing an
+ * uncontended lock does not require a system call.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanLock_
+{
+    /**
+     * @brief   `0` = unlocked, `1` = locked, `2` = locked and there might be waiting threads.
+     */
+    ZyanAtomic32 state;
+} ZyanLock;
+
+/**
+ * @brief   Defines the `ZyanTicketLock` struct.
+ *
+ * A spinlock that grants the lock in FIFO order, which prevents starvation under contention.
+ * Waiting threads never block, so the lock should only guard very short critical sections.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanTicketLock_
+{
+    /**
+     * @brief   The next ticket to hand out.
+     */
+    ZyanAtomic32 next;
+    /**
+     * @brief   The ticket of the current owner.
+     */
+    ZyanAtomic32 owner;
+} ZyanTicketLock;
+
+/**
+ * @brief   Defines the `ZyanRWLock` struct.
+ *
+ * A reader-writer lock that allows either multiple readers or a single writer. Waiting writers
+ * block new readers to prevent writer starvation.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanRWLock_
+{
+    /**
+     * @brief   The number of readers, the writer bit and the waiting bit.
+     */
+    ZyanAtomic32 state;
+} ZyanRWLock;
+
+/**
+ * @brief   Defines the `ZyanDistributedRWLock` struct.
+ *
+ * A reader-writer lock for read-mostly data. Every reader only modifies one of multiple counters,
+ * each in its own cache line, so readers on different cores do not contend with each other. In
+ * exchange, writers have to check all counters.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanDistributedRWLock_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   Serializes the writers.
+     */
+    ZyanLock writer_lock;
+    /**
+     * @brief   `0` = no writer, `1` = a writer holds or waits for the lock, `2` = same as `1`,
+     *          but there might be waiting readers.
+     */
+    ZyanAtomic32 writer;
+    /**
+     * @brief   The number of reader slots (a power of two).
+     */
+    ZyanUSize slot_count;
+    /**
+     * @brief   The reader slots (aligned to `ZYAN_CACHE_LINE_SIZE`).
+     */
+    void* slots;
+    /**
+     * @brief   The allocation that holds the reader slots.
+     */
+    void* buffer;
+} ZyanDistributedRWLock;
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/**
+ * @brief   Statically initializes a `ZyanLock` instance.
+ */
+#define ZYAN_LOCK_INIT { ZYAN_ATOMIC_INIT(0) }
+
+/**
+ * @brief   Statically initializes a `ZyanTicketLock` instance.
+ */
+#define ZYAN_TICKET_LOCK_INIT { ZYAN_ATOMIC_INIT(0), ZYAN_ATOMIC_INIT(0) }
+
+/**
+ * @brief   Statically initializes a `ZyanRWLock` instance.
+ */
+#define ZYAN_RW_LOCK_INIT { ZYAN_ATOMIC_INIT(0) }
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lock                                                                                           */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanLock` instance.
+ *
+ * @param   lock    A pointer to the `ZyanLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanLockInit(ZyanLock* lock);
+
+/**
+ * @brief   Acquires the given lock and blocks, if it is owned by another thread.
+ *
+ * @param   lock    A pointer to the `ZyanLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanLockAcquire(ZyanLock* lock);
+
+/**
+ * @brief   Tries to acquire the given lock without blocking.
+ *
+ * @param   lock    A pointer to the `ZyanLock` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the lock was acquired, `ZYAN_STATUS_FALSE`, if not, or another
+ *          zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanLockTryAcquire(ZyanLock* lock);
+
+/**
+ * @brief   Releases the given lock.
+ *
+ * @param   lock    A pointer to the `ZyanLock` instance (owned by the calling thread).
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanLockRelease(ZyanLock* lock);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Ticket lock                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanTicketLock` instance.
+ *
+ * @param   lock    A pointer to the `ZyanTicketLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanTicketLockInit(ZyanTicketLock* lock);
+
+/**
+ * @brief   Acquires the given ticket lock and spins, until it is the turn of the calling thread.
+ *
+ * @param   lock    A pointer to the `ZyanTicketLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanTicketLockAcquire(ZyanTicketLock* lock);
+
+/**
+ * @brief   Tries to acquire the given ticket lock without waiting.
+ *
+ * @param   lock    A pointer to the `ZyanTicketLock` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the lock was acquired, `ZYAN_STATUS_FALSE`, if not, or another
+ *          zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanTicketLockTryAcquire(ZyanTicketLock* lock);
+
+/**
+ * @brief   Releases the given ticket lock.
+ *
+ * @param   lock    A pointer to the `ZyanTicketLock` instance (owned by the calling thread).
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanTicketLockRelease(ZyanTicketLock* lock);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Reader-writer lock                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanRWLock` instance.
+ *
+ * @param   lock    A pointer to the `ZyanRWLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRWLockInit(ZyanRWLock* lock);
+
+/**
+ * @brief   Acquires shared (read) access to the given lock.
+ *
+ * @param   lock    A pointer to the `ZyanRWLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRWLockAcquireRead(ZyanRWLock* lock);
+
+/**
+ * @brief   Tries to acquire shared (read) access to the given lock without blocking.
+ *
+ * @param   lock    A pointer to the `ZyanRWLock` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the lock was acquired, `ZYAN_STATUS_FALSE`, if not, or another
+ *          zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRWLockTryAcquireRead(ZyanRWLock* lock);
+
+/**
+ * @brief   Releases shared (read) access to the given lock.
+ *
+ * @param   lock    A pointer to the `ZyanRWLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRWLockReleaseRead(ZyanRWLock* lock);
+
+/**
+ * @brief   Acquires exclusive (write) access to the given lock.
+ *
+ * @param   lock    A pointer to the `ZyanRWLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRWLockAcquireWrite(ZyanRWLock* lock);
+
+/**
+ * @brief   Tries to acquire exclusive (write) access to the given lock without blocking.
+ *
+ * @param   lock    A pointer to the `ZyanRWLock` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the lock was acquired, `ZYAN_STATUS_FALSE`, if not, or another
+ *          zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRWLockTryAcquireWrite(ZyanRWLock* lock);
+
+/**
+ * @brief   Releases exclusive (write) access to the given lock.
+ *
+ * @param   lock    A pointer to the `ZyanRWLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRWLockReleaseWrite(ZyanRWLock* lock);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Distributed reader-writer lock                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanDistributedRWLock` instance.
+ *
+ * @param   lock    A pointer to the `ZyanDistributedRWLock` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * The number of reader slots is derived from the number of logical processors. The slots are
+ * allocated by the default allocator.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDistributedRWLockInit(ZyanDistributedRWLock* lock);
+
+/**
+ * @brief   Initializes the given `ZyanDistributedRWLock` instance and sets a custom
+ *          `slot_count` and `allocator`.
+ *
+ * @param   lock        A pointer to the `ZyanDistributedRWLock` instance.
+ * @param   slot_count  The number of reader slots (rounded up to the next power of two).
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDistributedRWLockInitEx(ZyanDistributedRWLock* lock,
+    ZyanUSize slot_count, ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanDistributedRWLock` instance.
+ *
+ * @param   lock    A pointer to the `ZyanDistributedRWLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDistributedRWLockDestroy(ZyanDistributedRWLock* lock);
+
+/**
+ * @brief   Acquires shared (read) access to the given lock.
+ *
+ * @param   lock    A pointer to the `ZyanDistributedRWLock` instance.
+ * @param   slot    Receives the index of the reader slot, which has to be passed to
+ *                  `ZyanDistributedRWLockReleaseRead`.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDistributedRWLockAcquireRead(ZyanDistributedRWLock* lock,
+    ZyanUSize* slot);
+
+/**
+ * @brief   Releases shared (read) access to the given lock.
+ *
+ * @param   lock    A pointer to the `ZyanDistributedRWLock` instance.
+ * @param   slot    The index of the reader slot that was returned by
+ *                  `ZyanDistributedRWLockAcquireRead`.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDistributedRWLockReleaseRead(ZyanDistributedRWLock* lock,
+    ZyanUSize slot);
+
+/**
+ * @brief   Acquires exclusive (write) access to the given lock.
+ *
+ * @param   lock    A pointer to the `ZyanDistributedRWLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDistributedRWLockAcquireWrite(ZyanDistributedRWLock* lock);
+
+/**
+ * @brief   Releases exclusive (write) access to the given lock.
+ *
+ * @param   lock    A pointer to the `ZyanDistributedRWLock` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDistributedRWLockReleaseWrite(ZyanDistributedRWLock* lock);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_LOCK_H */
@@ -0,0 +1,193 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements a fixed-size memory block pool.
+ */
+
+#ifndef ZYCORE_POOL_H
+#define ZYCORE_POOL_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanPool` struct.
+ *
+ * The pool hands out memory blocks of a fixed size. Blocks are carved from larger slabs obtained
+ * from a `ZyanAllocator` instance and released blocks are kept in a free-list, which makes both
+ * allocation and deallocation `O(1)` operations that don't touch the underlying allocator in most
+ * cases. Slabs are only returned to the allocator when the pool is destroyed.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanPool_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The size of a single block in bytes.
+     */
+    ZyanUSize block_size;
+    /**
+     * @brief   The number of blocks per slab.
+     */
+    ZyanUSize slab_capacity;
+    /**
+     * @brief   The head of the singly linked list of allocated slabs.
+     */
+    void* slabs;
+    /**
+     * @brief   The head of the singly linked list of released blocks.
+     */
+    void* free_list;
+    /**
+     * @brief   The next unused block in the most recently allocated slab.
+     */
+    ZyanU8* unused;
+    /**
+     * @brief   The end of the most recently allocated slab.
+     */
+    ZyanU8* unused_end;
+    /**
+     * @brief   The number of blocks currently in use.
+     */
+    ZyanUSize size;
+} ZyanPool;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanPool` instance.
+ *
+ * @param   pool        A pointer to the `ZyanPool` instance.
+ * @param   block_size  The size of a single block in bytes.
+ *
+ * @return  A zycore status code.
+ *
+ * The slabs are allocated by the default allocator. The number of blocks per slab is chosen to
+ * make a slab roughly fill a single memory page.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolInit(ZyanPool* pool, ZyanUSize block_size);
+
+/**
+ * @brief   Initializes the given `ZyanPool` instance and sets a custom `allocator` and slab size.
+ *
+ * @param   pool            A pointer to the `ZyanPool` instance.
+ * @param   block_size      The size of a single block in bytes.
+ * @param   slab_capacity   The number of blocks per slab.
+ * @param   allocator       A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * The block size is rounded up to a multiple of the pointer size. All blocks are aligned to the
+ * pointer size.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolInitEx(ZyanPool* pool, ZyanUSize block_size,
+    ZyanUSize slab_capacity, ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanPool` instance.
+ *
+ * @param   pool    A pointer to the `ZyanPool` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * All blocks obtained from the pool are invalidated by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolDestroy(ZyanPool* pool);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocation                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Allocates a new block from the given pool.
+ *
+ * @param   pool    A pointer to the `ZyanPool` instance.
+ * @param   block   Receives a pointer to the new block.
+ *
+ * @return  A zycore status code.
+ *
+ * The contents of the returned block are undefined.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolAllocate(ZyanPool* pool, void** block);
+
+/**
+ * @brief   Returns a block to the given pool.
+ *
+ * @param   pool    A pointer to the `ZyanPool` instance.
+ * @param   block   A pointer to a block previously obtained from the same pool.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolFree(ZyanPool* pool, void* block);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the size of a single block of the given pool.
+ *
+ * @param   pool        A pointer to the `ZyanPool` instance.
+ * @param   block_size  Receives the size of a single block in bytes.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolBlockSize(const ZyanPool* pool, ZyanUSize* block_size);
+
+/**
+ * @brief   Returns the number of blocks currently in use.
+ *
+ * @param   pool    A pointer to the `ZyanPool` instance.
+ * @param   size    Receives the number of blocks currently in use.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolSize(const ZyanPool* pool, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_POOL_H */
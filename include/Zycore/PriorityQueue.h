@@ -0,0 +1,300 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements the priority queue container class.
+ */
+
+#ifndef ZYCORE_PRIORITY_QUEUE_H
+#define ZYCORE_PRIORITY_QUEUE_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Comparison.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanPriorityQueue` struct.
+ *
+ * The priority queue is implemented as an implicit `d`-ary min-heap on top of a `ZyanVector`. The
+ * element that compares as the smallest one is always located at the top of the queue. Invert the
+ * `comparison` function to obtain a max-heap.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanPriorityQueue_
+{
+    /**
+     * @brief   The vector that is used as storage for the heap.
+     */
+    ZyanVector vector;
+    /**
+     * @brief   The comparison function.
+     */
+    ZyanComparison comparison;
+    /**
+     * @brief   The number of children per node.
+     */
+    ZyanUSize arity;
+} ZyanPriorityQueue;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanPriorityQueue` instance.
+ *
+ * @param   queue           A pointer to the `ZyanPriorityQueue` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   capacity        The initial capacity (number of elements).
+ * @param   comparison      The comparison function that defines the element priorities.
+ *
+ * @return  A zycore status code.
+ *
+ * The queue uses a 4-ary heap layout. The space for the elements is dynamically allocated by the
+ * default allocator using the default growth factor of `2.0f` and the default shrink threshold of
+ * `0.25f`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueInit(ZyanPriorityQueue* queue, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanComparison comparison);
+
+/**
+ * @brief   Initializes the given `ZyanPriorityQueue` instance and sets a custom `arity`,
+ *          `allocator` and memory allocation/deallocation parameters.
+ *
+ * @param   queue               A pointer to the `ZyanPriorityQueue` instance.
+ * @param   element_size        The size of a single element in bytes.
+ * @param   capacity            The initial capacity (number of elements).
+ * @param   comparison          The comparison function that defines the element priorities.
+ * @param   arity               The number of children per heap node (`2` for a binary heap, `4`
+ *                              for a 4-ary heap, ...).
+ * @param   allocator           A pointer to a `ZyanAllocator` instance.
+ * @param   growth_factor       The growth factor (from `1.0f` to `x.xf`).
+ * @param   shrink_threshold    The shrink threshold (from `0.0f` to `1.0f`).
+ *
+ * @return  A zycore status code.
+ *
+ * Higher arities reduce the height of the heap and keep all children of a node in adjacent memory,
+ * which results in fewer cache misses during `pop` operations at the cost of more comparisons.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueInitEx(ZyanPriorityQueue* queue, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanComparison comparison, ZyanUSize arity, ZyanAllocator* allocator,
+    float growth_factor, float shrink_threshold);
+
+/**
+ * @brief   Initializes the given `ZyanPriorityQueue` instance and configures it to use a custom
+ *          user defined buffer with a fixed size.
+ *
+ * @param   queue           A pointer to the `ZyanPriorityQueue` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   buffer          A pointer to the buffer that is used as storage for the elements.
+ * @param   capacity        The maximum capacity (number of elements) of the buffer.
+ * @param   comparison      The comparison function that defines the element priorities.
+ * @param   arity           The number of children per heap node.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueInitBuffer(ZyanPriorityQueue* queue,
+    ZyanUSize element_size, void* buffer, ZyanUSize capacity, ZyanComparison comparison,
+    ZyanUSize arity);
+
+/**
+ * @brief   Initializes the given `ZyanPriorityQueue` instance by taking over the storage of an
+ *          existing `ZyanVector` instance.
+ *
+ * @param   queue       A pointer to the `ZyanPriorityQueue` instance.
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   comparison  The comparison function that defines the element priorities.
+ * @param   arity       The number of children per heap node.
+ *
+ * @return  A zycore status code.
+ *
+ * The elements of the vector are rearranged to satisfy the heap property in `O(n)` time.
+ *
+ * The queue takes ownership of the vector. The passed `ZyanVector` instance must not be used or
+ * destroyed after this function succeeded.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueInitVector(ZyanPriorityQueue* queue, ZyanVector* vector,
+    ZyanComparison comparison, ZyanUSize arity);
+
+/**
+ * @brief   Destroys the given `ZyanPriorityQueue` instance.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueDestroy(ZyanPriorityQueue* queue);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns a constant pointer to the element with the highest priority.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ * @param   element Receives a constant pointer to the top element.
+ *
+ * @return  A zycore status code.
+ *
+ * The returned pointer is only valid until the next modification of the queue.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueTop(const ZyanPriorityQueue* queue,
+    const void** element);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Adds a new `element` to the queue.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ * @param   element A pointer to the element to add.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueuePush(ZyanPriorityQueue* queue, const void* element);
+
+/**
+ * @brief   Adds multiple `elements` to the queue.
+ *
+ * @param   queue       A pointer to the `ZyanPriorityQueue` instance.
+ * @param   elements    A pointer to the first element.
+ * @param   count       The number of elements to add.
+ *
+ * @return  A zycore status code.
+ *
+ * If the number of new elements is large compared to the current size of the queue, the whole heap
+ * is rebuilt in `O(n)` time instead of inserting the elements one by one.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueuePushElements(ZyanPriorityQueue* queue,
+    const void* elements, ZyanUSize count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Removes the element with the highest priority from the queue.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ * @param   element Receives a copy of the removed element. Pass `ZYAN_NULL` to discard it.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueuePop(ZyanPriorityQueue* queue, void* element);
+
+/**
+ * @brief   Replaces the element with the highest priority by a new `element`.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ * @param   element A pointer to the new element.
+ *
+ * @return  A zycore status code.
+ *
+ * This function is equivalent to a `pop` followed by a `push`, but restores the heap property with
+ * a single pass. It is especially useful for bounded top-k selections.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueReplaceTop(ZyanPriorityQueue* queue,
+    const void* element);
+
+/**
+ * @brief   Erases all elements of the given queue.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueClear(ZyanPriorityQueue* queue);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Changes the capacity of the given `ZyanPriorityQueue` instance.
+ *
+ * @param   queue       A pointer to the `ZyanPriorityQueue` instance.
+ * @param   capacity    The new minimum capacity of the queue.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueReserve(ZyanPriorityQueue* queue, ZyanUSize capacity);
+
+/**
+ * @brief   Shrinks the capacity of the given queue to match it's size.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueShrinkToFit(ZyanPriorityQueue* queue);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the current size of the queue.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ * @param   size    Receives the size of the queue.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueSize(const ZyanPriorityQueue* queue, ZyanUSize* size);
+
+/**
+ * @brief   Returns the current capacity of the queue.
+ *
+ * @param   queue       A pointer to the `ZyanPriorityQueue` instance.
+ * @param   capacity    Receives the capacity of the queue.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPriorityQueueCapacity(const ZyanPriorityQueue* queue,
+    ZyanUSize* capacity);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_PRIORITY_QUEUE_H */
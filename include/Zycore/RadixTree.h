@@ -0,0 +1,245 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements the adaptive radix tree container class.
+ */
+
+#ifndef ZYCORE_RADIXTREE_H
+#define ZYCORE_RADIXTREE_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanRadixTree` struct.
+ *
+ * The tree maps variable-length byte-string keys to fixed-size values. Inner nodes adapt their
+ * layout to the number of children (4, 16, 48 or 256) and common key prefixes are compressed into
+ * a single node. Keys may be prefixes of other keys.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanRadixTree_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The size of a single value in bytes.
+     */
+    ZyanUSize value_size;
+    /**
+     * @brief   The root node or `ZYAN_NULL`, if the tree is empty.
+     */
+    void* root;
+    /**
+     * @brief   The number of entries in the tree.
+     */
+    ZyanUSize size;
+} ZyanRadixTree;
+
+/**
+ * @brief   Defines the `ZyanRadixTreeCallback` function.
+ *
+ * @param   key         A pointer to the key of the current entry.
+ * @param   length      The length of the key in bytes.
+ * @param   value       A pointer to the value of the current entry.
+ * @param   user_data   The user data pointer.
+ *
+ * @return  A zycore status code. Return `ZYAN_STATUS_FALSE` to stop the iteration early or a
+ *          failure status code to abort it.
+ */
+typedef ZyanStatus (*ZyanRadixTreeCallback)(const void* key, ZyanUSize length, void* value,
+    void* user_data);
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanRadixTree` instance.
+ *
+ * @param   tree        A pointer to the `ZyanRadixTree` instance.
+ * @param   value_size  The size of a single value in bytes.
+ *
+ * @return  A zycore status code.
+ *
+ * The nodes are allocated by the default allocator.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeInit(ZyanRadixTree* tree, ZyanUSize value_size);
+
+/**
+ * @brief   Initializes the given `ZyanRadixTree` instance and sets a custom `allocator`.
+ *
+ * @param   tree        A pointer to the `ZyanRadixTree` instance.
+ * @param   value_size  The size of a single value in bytes.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeInitEx(ZyanRadixTree* tree, ZyanUSize value_size,
+    ZyanAllocator* allocator);
+
+/**
+ * @brief   Destroys the given `ZyanRadixTree` instance.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeDestroy(ZyanRadixTree* tree);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Looks up the value for the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key in bytes.
+ * @param   value   Receives a pointer to the value, if the key was found.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the key was found or `ZYAN_STATUS_FALSE`, if not. Another zycore
+ *          status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeGet(const ZyanRadixTree* tree, const void* key,
+    ZyanUSize length, void** value);
+
+/**
+ * @brief   Looks up the longest key in the tree that is a prefix of the given `key`.
+ *
+ * @param   tree            A pointer to the `ZyanRadixTree` instance.
+ * @param   key             A pointer to the key.
+ * @param   length          The length of the key in bytes.
+ * @param   match_length    Receives the length of the matching key. Pass `ZYAN_NULL`, if not
+ *                          needed.
+ * @param   value           Receives a pointer to the value of the matching key.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if a matching key was found or `ZYAN_STATUS_FALSE`, if not. Another
+ *          zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeLongestPrefixMatch(const ZyanRadixTree* tree,
+    const void* key, ZyanUSize length, ZyanUSize* match_length, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Inserts or updates the entry for the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key in bytes.
+ * @param   value   A pointer to the value.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeInsert(ZyanRadixTree* tree, const void* key,
+    ZyanUSize length, const void* value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Removes the entry for the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key in bytes.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the entry was removed or `ZYAN_STATUS_FALSE`, if the key was not
+ *          found. Another zycore status code, if an error occured.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeRemove(ZyanRadixTree* tree, const void* key,
+    ZyanUSize length);
+
+/**
+ * @brief   Removes all entries of the given tree.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeClear(ZyanRadixTree* tree);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Invokes the `callback` for every entry whose key starts with the given `prefix`.
+ *
+ * @param   tree        A pointer to the `ZyanRadixTree` instance.
+ * @param   prefix      A pointer to the prefix.
+ * @param   length      The length of the prefix in bytes. Pass `0` to visit all entries.
+ * @param   callback    The callback function.
+ * @param   user_data   A user data pointer that is passed to the callback.
+ *
+ * @return  A zycore status code.
+ *
+ * The entries are visited in lexicographical key order. The tree must not be modified by the
+ * callback.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeForEachPrefix(const ZyanRadixTree* tree, const void* prefix,
+    ZyanUSize length, ZyanRadixTreeCallback callback, void* user_data);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the current number of entries in the tree.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   size    Receives the number of entries.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeSize(const ZyanRadixTree* tree, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_RADIXTREE_H */
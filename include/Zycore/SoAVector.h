@@ -0,0 +1,447 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements a vector that stores every field of its rows in a separate column
+ *          (struct-of-arrays layout).
+ *
+ * Rows are pushed and read as regular structs, but each field is scattered into its own column.
+ * A scan over a single field only touches the memory of that column instead of every row. All
+ * columns start at a `ZYAN_CACHE_LINE_SIZE` boundary, so they can be processed with aligned vector
+ * loads.
+ */
+
+#ifndef ZYCORE_SOA_VECTOR_H
+#define ZYCORE_SOA_VECTOR_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Defines.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * @brief   The maximum number of fields (columns) of a `ZyanSoAVector` instance.
+ */
+#define ZYAN_SOA_VECTOR_MAX_FIELDS  16
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanSoAVectorField` struct that describes a single field of a row.
+ */
+typedef struct ZyanSoAVectorField_
+{
+    /**
+     * @brief   The offset of the field inside the row struct in bytes.
+     */
+    ZyanUSize offset;
+    /**
+     * @brief   The size of the field in bytes.
+     */
+    ZyanUSize size;
+} ZyanSoAVectorField;
+
+/**
+ * @brief   Defines the `ZyanSoAVector` struct.
+ *
+ * All columns live in a single allocation. Column `n` holds `capacity` values of
+ * `fields[n].size` bytes each.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanSoAVector_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The growth factor.
+     */
+    float growth_factor;
+    /**
+     * @brief   The shrink threshold.
+     */
+    float shrink_threshold;
+    /**
+     * @brief   The current number of rows in the vector.
+     */
+    ZyanUSize size;
+    /**
+     * @brief   The maximum capacity (number of rows).
+     */
+    ZyanUSize capacity;
+    /**
+     * @brief   The size of a row struct in bytes.
+     */
+    ZyanUSize row_size;
+    /**
+     * @brief   The number of fields.
+     */
+    ZyanUSize field_count;
+    /**
+     * @brief   The field descriptors.
+     */
+    ZyanSoAVectorField fields[ZYAN_SOA_VECTOR_MAX_FIELDS];
+    /**
+     * @brief   The aligned column pointers.
+     */
+    ZyanU8* columns[ZYAN_SOA_VECTOR_MAX_FIELDS];
+    /**
+     * @brief   The allocation that backs all columns.
+     */
+    void* data;
+    /**
+     * @brief   The size of the allocation in bytes.
+     */
+    ZyanUSize data_size;
+} ZyanSoAVector;
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/**
+ * @brief   Initializes a `ZyanSoAVectorField` struct from a member of a row struct.
+ *
+ * @param   type    The type of the row struct.
+ * @param   member  The name of the member.
+ */
+#define ZYAN_SOA_VECTOR_FIELD(type, member) \
+    { ZYAN_OFFSETOF(type, member), sizeof(((type*)0)->member) }
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanSoAVector` instance.
+ *
+ * @param   vector      A pointer to the `ZyanSoAVector` instance.
+ * @param   fields      The field descriptors (see `ZYAN_SOA_VECTOR_FIELD`).
+ * @param   field_count The number of fields (from `1` to `ZYAN_SOA_VECTOR_MAX_FIELDS`).
+ * @param   row_size    The size of the row struct in bytes. All fields have to fit into it.
+ * @param   capacity    The initial capacity (number of rows).
+ *
+ * @return  A zycore status code.
+ *
+ * The columns are dynamically allocated by the default allocator using the default growth factor
+ * of `2.0f` and the default shrink threshold of `0.25f`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorInit(ZyanSoAVector* vector, const ZyanSoAVectorField* fields,
+    ZyanUSize field_count, ZyanUSize row_size, ZyanUSize capacity);
+
+/**
+ * @brief   Initializes the given `ZyanSoAVector` instance and sets a custom `allocator` and memory
+ *          allocation/deallocation parameters.
+ *
+ * @param   vector              A pointer to the `ZyanSoAVector` instance.
+ * @param   fields              The field descriptors (see `ZYAN_SOA_VECTOR_FIELD`).
+ * @param   field_count         The number of fields (from `1` to `ZYAN_SOA_VECTOR_MAX_FIELDS`).
+ * @param   row_size            The size of the row struct in bytes. All fields have to fit into
+ *                              it.
+ * @param   capacity            The initial capacity (number of rows).
+ * @param   allocator           A pointer to a `ZyanAllocator` instance.
+ * @param   growth_factor       The growth factor (from `1.0f` to `x.xf`).
+ * @param   shrink_threshold    The shrink threshold (from `0.0f` to `1.0f`).
+ *
+ * @return  A zycore status code.
+ *
+ * A growth factor of `1.0f` disables overallocation and a shrink threshold of `0.0f` disables
+ * dynamic shrinking.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorInitEx(ZyanSoAVector* vector,
+    const ZyanSoAVectorField* fields, ZyanUSize field_count, ZyanUSize row_size,
+    ZyanUSize capacity, ZyanAllocator* allocator, float growth_factor, float shrink_threshold);
+
+/**
+ * @brief   Destroys the given `ZyanSoAVector` instance.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorDestroy(ZyanSoAVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Gathers the fields of the row at the given `index` into a row struct.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   index   The row index.
+ * @param   row     Receives the row. Bytes that do not belong to any field are left untouched.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorGet(const ZyanSoAVector* vector, ZyanUSize index,
+    void* row);
+
+/**
+ * @brief   Returns a pointer to a single field of the row at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   index   The row index.
+ * @param   field   The field index.
+ * @param   element Receives a pointer to the field value.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorGetField(ZyanSoAVector* vector, ZyanUSize index,
+    ZyanUSize field, void** element);
+
+/**
+ * @brief   Returns a constant pointer to a single field of the row at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   index   The row index.
+ * @param   field   The field index.
+ * @param   element Receives a constant pointer to the field value.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorGetFieldConst(const ZyanSoAVector* vector,
+    ZyanUSize index, ZyanUSize field, const void** element);
+
+/**
+ * @brief   Returns a pointer to the first value of the given column.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   field   The field index.
+ * @param   column  Receives a pointer to the column. The pointer is aligned to
+ *                  `ZYAN_CACHE_LINE_SIZE` bytes.
+ *
+ * @return  A zycore status code.
+ *
+ * The column holds `size` consecutive values. The pointer is invalidated by every function that
+ * changes the capacity of the vector.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorGetColumn(ZyanSoAVector* vector, ZyanUSize field,
+    void** column);
+
+/**
+ * @brief   Returns a constant pointer to the first value of the given column.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   field   The field index.
+ * @param   column  Receives a constant pointer to the column. The pointer is aligned to
+ *                  `ZYAN_CACHE_LINE_SIZE` bytes.
+ *
+ * @return  A zycore status code.
+ *
+ * The column holds `size` consecutive values. The pointer is invalidated by every function that
+ * changes the capacity of the vector.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorGetColumnConst(const ZyanSoAVector* vector,
+    ZyanUSize field, const void** column);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Assignment                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Scatters the fields of a row struct into the row at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   index   The row index.
+ * @param   row     A pointer to the row struct.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorAssign(ZyanSoAVector* vector, ZyanUSize index,
+    const void* row);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Scatters the fields of a row struct into a new row at the end of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   row     A pointer to the row struct.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorPush(ZyanSoAVector* vector, const void* row);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Removes the last row of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorPop(ZyanSoAVector* vector);
+
+/**
+ * @brief   Erases all rows of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorClear(ZyanSoAVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Resizes the vector to the given number of rows.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   size    The new size of the vector.
+ *
+ * @return  A zycore status code.
+ *
+ * The fields of new rows are uninitialized.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorResize(ZyanSoAVector* vector, ZyanUSize size);
+
+/**
+ * @brief   Changes the capacity of the vector.
+ *
+ * @param   vector      A pointer to the `ZyanSoAVector` instance.
+ * @param   capacity    The new minimum capacity of the vector.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorReserve(ZyanSoAVector* vector, ZyanUSize capacity);
+
+/**
+ * @brief   Shrinks the capacity of the vector to its size.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorShrinkToFit(ZyanSoAVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the current number of rows of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   size    Receives the number of rows.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorSize(const ZyanSoAVector* vector, ZyanUSize* size);
+
+/**
+ * @brief   Returns the current capacity of the vector.
+ *
+ * @param   vector      A pointer to the `ZyanSoAVector` instance.
+ * @param   capacity    Receives the capacity (number of rows).
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorCapacity(const ZyanSoAVector* vector, ZyanUSize* capacity);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Unchecked access                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/*
+ * Inlinable accessors for scan loops, analogous to the unchecked `ZyanVector` functions. Their
+ * preconditions are only asserted in debug builds.
+ */
+
+/**
+ * @brief   Returns a pointer to the first value of the given column without any checks.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   field   The field index. Must be less than the number of fields.
+ *
+ * @return  A pointer to the column, aligned to `ZYAN_CACHE_LINE_SIZE` bytes.
+ */
+ZYAN_INLINE void* ZyanSoAVectorGetColumnUnchecked(ZyanSoAVector* vector, ZyanUSize field)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(field < vector->field_count);
+
+    return vector->columns[field];
+}
+
+/**
+ * @brief   Returns a constant pointer to the first value of the given column without any checks.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   field   The field index. Must be less than the number of fields.
+ *
+ * @return  A constant pointer to the column, aligned to `ZYAN_CACHE_LINE_SIZE` bytes.
+ */
+ZYAN_INLINE const void* ZyanSoAVectorGetColumnConstUnchecked(const ZyanSoAVector* vector,
+    ZyanUSize field)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(field < vector->field_count);
+
+    return vector->columns[field];
+}
+
+/**
+ * @brief   Returns the current number of rows of the vector without any checks.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ *
+ * @return  The number of rows.
+ */
+ZYAN_INLINE ZyanUSize ZyanSoAVectorSizeUnchecked(const ZyanSoAVector* vector)
+{
+    ZYAN_ASSERT(vector);
+
+    return vector->size;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_SOA_VECTOR_H */
@@ -200,6 +200,12 @@ typedef ZyanU32 ZyanStatus;
 #define ZYAN_STATUS_NOT_ENOUGH_MEMORY \
     ZYAN_MAKE_STATUS(1, ZYAN_MODULE_ZYCORE, 0x07)
 
+/**
+ * @brief   An error occurred during a system call.
+ */
+#define ZYAN_STATUS_BAD_SYSTEMCALL \
+    ZYAN_MAKE_STATUS(1, ZYAN_MODULE_ZYCORE, 0x08)
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -0,0 +1,293 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements a work-stealing thread pool.
+ */
+
+#ifndef ZYCORE_THREAD_POOL_H
+#define ZYCORE_THREAD_POOL_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Atomic.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+// The thread pool depends on the threading primitives of the operating system
+#ifndef ZYCORE_NO_LIBC
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanTaskFunction` function prototype.
+ *
+ * @param   user_data   The user data pointer of the task.
+ */
+typedef void (*ZyanTaskFunction)(void* user_data);
+
+/**
+ * @brief   Defines the `ZyanTaskRangeFunction` function prototype.
+ *
+ * @param   begin       The index of the first element of the chunk.
+ * @param   end         The index after the last element of the chunk.
+ * @param   user_data   The user data pointer that was passed to `ZyanThreadPoolParallelFor`.
+ */
+typedef void (*ZyanTaskRangeFunction)(ZyanUSize begin, ZyanUSize end, void* user_data);
+
+/**
+ * @brief   Defines the `ZyanTaskGroup` struct.
+ *
+ * A task group tracks the number of submitted tasks that did not finish yet. It has to be
+ * initialized by `ZyanTaskGroupInit` or `ZYAN_TASK_GROUP_INIT`.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanTaskGroup_
+{
+    /**
+     * @brief   The number of pending tasks.
+     */
+    ZyanAtomic64 pending;
+} ZyanTaskGroup;
+
+/**
+ * @brief   Defines the `ZyanTask` struct.
+ *
+ * The task storage is owned by the caller and has to stay valid until the task group it was
+ * submitted to has been waited for. The thread pool never allocates memory for tasks.
+ */
+typedef struct ZyanTask_
+{
+    /**
+     * @brief   The function to execute.
+     */
+    ZyanTaskFunction function;
+    /**
+     * @brief   The user data pointer that is passed to `function`.
+     */
+    void* user_data;
+    /**
+     * @brief   The task group (private).
+     */
+    ZyanTaskGroup* group;
+    /**
+     * @brief   The next task in the global queue (private).
+     */
+    struct ZyanTask_* next;
+} ZyanTask;
+
+/**
+ * @brief   Defines the `ZyanThreadPool` struct.
+ *
+ * Every worker thread owns a fixed-size Chase-Lev deque. Tasks that are submitted by a worker are
+ * pushed to the bottom of its own deque, tasks that are submitted by any other thread are appended
+ * to a shared queue. Idle workers steal from the top of the deques of other workers and go to
+ * sleep on a condition variable once no more work is found.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanThreadPool_
+{
+    /**
+     * @brief   The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   The number of worker threads.
+     */
+    ZyanUSize thread_count;
+    /**
+     * @brief   The internal state (workers, deques and the shared queue).
+     */
+    struct ZyanThreadPoolState_* state;
+} ZyanThreadPool;
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/**
+ * @brief   Statically initializes a `ZyanTaskGroup` instance.
+ */
+#define ZYAN_TASK_GROUP_INIT { ZYAN_ATOMIC_INIT(0) }
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanThreadPool` instance and starts the worker threads.
+ *
+ * @param   pool            A pointer to the `ZyanThreadPool` instance.
+ * @param   thread_count    The number of worker threads or `0` to start one thread per logical
+ *                          processor.
+ *
+ * @return  A zycore status code.
+ *
+ * The internal state is allocated by the default allocator.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolInit(ZyanThreadPool* pool, ZyanUSize thread_count);
+
+/**
+ * @brief   Initializes the given `ZyanThreadPool` instance, sets a custom `allocator` and starts
+ *          the worker threads.
+ *
+ * @param   pool            A pointer to the `ZyanThreadPool` instance.
+ * @param   thread_count    The number of worker threads or `0` to start one thread per logical
+ *                          processor.
+ * @param   allocator       A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * `ZyanThreadPoolParallelFor` might use the allocator concurrently from multiple threads.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolInitEx(ZyanThreadPool* pool, ZyanUSize thread_count,
+    ZyanAllocator* allocator);
+
+/**
+ * @brief   Stops all worker threads and destroys the given `ZyanThreadPool` instance.
+ *
+ * @param   pool    A pointer to the `ZyanThreadPool` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * All submitted tasks have to be finished before the pool is destroyed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolDestroy(ZyanThreadPool* pool);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Tasks                                                                                          */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Initializes the given `ZyanTaskGroup` instance.
+ *
+ * @param   group   A pointer to the `ZyanTaskGroup` instance.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanTaskGroupInit(ZyanTaskGroup* group);
+
+/**
+ * @brief   Submits a single task to the thread pool.
+ *
+ * @param   pool    A pointer to the `ZyanThreadPool` instance.
+ * @param   group   A pointer to the `ZyanTaskGroup` instance that tracks the task.
+ * @param   task    A pointer to the `ZyanTask` instance. The `function` and `user_data` fields
+ *                  have to be set by the caller.
+ *
+ * @return  A zycore status code.
+ *
+ * Tasks are allowed to submit and wait for further tasks themselves.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolSubmit(ZyanThreadPool* pool, ZyanTaskGroup* group,
+    ZyanTask* task);
+
+/**
+ * @brief   Submits multiple tasks to the thread pool at once.
+ *
+ * @param   pool    A pointer to the `ZyanThreadPool` instance.
+ * @param   group   A pointer to the `ZyanTaskGroup` instance that tracks the tasks.
+ * @param   tasks   A pointer to an array of `ZyanTask` instances.
+ * @param   count   The number of tasks.
+ *
+ * @return  A zycore status code.
+ *
+ * Compared to multiple calls to `ZyanThreadPoolSubmit`, the shared queue is locked and the
+ * sleeping workers are woken up only once for the whole batch.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolSubmitBatch(ZyanThreadPool* pool, ZyanTaskGroup* group,
+    ZyanTask* tasks, ZyanUSize count);
+
+/**
+ * @brief   Waits for all tasks of the given task group to finish.
+ *
+ * @param   pool    A pointer to the `ZyanThreadPool` instance.
+ * @param   group   A pointer to the `ZyanTaskGroup` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * The calling thread executes pending tasks while it waits and only goes to sleep, if there is no
+ * more work to steal. This allows to wait from within a task without risking a deadlock.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolWait(ZyanThreadPool* pool, ZyanTaskGroup* group);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Parallel algorithms                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Invokes the given function for disjoint chunks of the index range `[begin, end)` in
+ *          parallel and waits for all of them to finish.
+ *
+ * @param   pool        A pointer to the `ZyanThreadPool` instance.
+ * @param   begin       The first index.
+ * @param   end         The index after the last index.
+ * @param   grain_size  The minimum number of indices per chunk or `0` to let the pool decide.
+ * @param   function    The function to invoke for every chunk.
+ * @param   user_data   The user data pointer that is passed to `function`.
+ *
+ * @return  A zycore status code.
+ *
+ * The range is split into a few chunks per worker, so that idle workers are able to steal work
+ * from workers that got assigned more expensive chunks. Ranges that consist of a single chunk
+ * are processed on the calling thread.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolParallelFor(ZyanThreadPool* pool, ZyanUSize begin,
+    ZyanUSize end, ZyanUSize grain_size, ZyanTaskRangeFunction function, void* user_data);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the number of worker threads.
+ *
+ * @param   pool    A pointer to the `ZyanThreadPool` instance.
+ * @param   count   Receives the number of worker threads.
+ *
+ * @return  A zycore status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolGetThreadCount(const ZyanThreadPool* pool,
+    ZyanUSize* count);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_NO_LIBC */
+
+#endif /* ZYCORE_THREAD_POOL_H */
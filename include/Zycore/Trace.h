@@ -0,0 +1,222 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Implements tracing hooks for allocator and container events.
+ *
+ * Tracing is compiled out unless Zycore is built with `ZYCORE_TRACING`. If enabled, every event
+ * is passed to the installed `ZyanTraceHandler` and, on Linux systems that provide
+ * `<sys/sdt.h>`, additionally fires the USDT probe `zycore:event`, which can be attached to by
+ * `perf`, `bpftrace` and other eBPF-based tools without installing a handler.
+ *
+ * Only the default allocator emits allocator events. Custom allocators are expected to emit
+ * their own events, if required.
+ */
+
+#ifndef ZYCORE_TRACE_H
+#define ZYCORE_TRACE_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Defines.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanTraceEvent` enum.
+ */
+typedef enum ZyanTraceEvent_
+{
+    /**
+     * @brief   A block of `size` bytes was allocated at `address`.
+     */
+    ZYAN_TRACE_EVENT_ALLOCATE,
+    /**
+     * @brief   The block at `previous_address` was resized to `size` bytes and now lives at
+     *          `address`.
+     *
+     * The previous size is not part of this event, as allocators do not receive it. The
+     * `previous_size` field is always `0`. The matching `ZYAN_TRACE_EVENT_CONTAINER_GROW` or
+     * `ZYAN_TRACE_EVENT_CONTAINER_SHRINK` event of the container reports it.
+     */
+    ZYAN_TRACE_EVENT_REALLOCATE,
+    /**
+     * @brief   The block of `size` bytes at `address` was released.
+     */
+    ZYAN_TRACE_EVENT_DEALLOCATE,
+    /**
+     * @brief   The storage of a container grew from `previous_size` to `size` bytes.
+     */
+    ZYAN_TRACE_EVENT_CONTAINER_GROW,
+    /**
+     * @brief   The storage of a container shrunk from `previous_size` to `size` bytes.
+     */
+    ZYAN_TRACE_EVENT_CONTAINER_SHRINK,
+    /**
+     * @brief   A container moved `size` bytes from `previous_address` to `address`.
+     */
+    ZYAN_TRACE_EVENT_CONTAINER_COPY,
+
+    /**
+     * @brief   Maximum value of this enum.
+     */
+    ZYAN_TRACE_EVENT_MAX_VALUE = ZYAN_TRACE_EVENT_CONTAINER_COPY,
+    /**
+     * @brief   The minimum number of bits required to represent all values of this enum.
+     */
+    ZYAN_TRACE_EVENT_REQUIRED_BITS = ZYAN_BITS_TO_REPRESENT(ZYAN_TRACE_EVENT_MAX_VALUE)
+} ZyanTraceEvent;
+
+/**
+ * @brief   Defines the `ZyanTraceRecord` struct that describes a single event.
+ */
+typedef struct ZyanTraceRecord_
+{
+    /**
+     * @brief   The event type.
+     */
+    ZyanTraceEvent event;
+    /**
+     * @brief   The allocator or container instance that emitted the event.
+     */
+    const void* object;
+    /**
+     * @brief   The (new) address of the affected memory.
+     */
+    const void* address;
+    /**
+     * @brief   The previous address of the affected memory or `ZYAN_NULL`.
+     */
+    const void* previous_address;
+    /**
+     * @brief   The (new) size of the affected memory in bytes.
+     */
+    ZyanUSize size;
+    /**
+     * @brief   The previous size of the affected memory in bytes or `0`, if unknown.
+     */
+    ZyanUSize previous_size;
+} ZyanTraceRecord;
+
+/**
+ * @brief   Defines the `ZyanTraceCallback` function prototype.
+ *
+ * @param   record      A pointer to the `ZyanTraceRecord` struct that describes the event.
+ * @param   user_data   The user data pointer of the handler.
+ *
+ * The callback is invoked on the thread that caused the event and must not call back into the
+ * functions that emitted it.
+ */
+typedef void (*ZyanTraceCallback)(const ZyanTraceRecord* record, void* user_data);
+
+/**
+ * @brief   Defines the `ZyanTraceHandler` struct.
+ */
+typedef struct ZyanTraceHandler_
+{
+    /**
+     * @brief   The callback that is invoked for every event.
+     */
+    ZyanTraceCallback callback;
+    /**
+     * @brief   The user data pointer that is passed to the callback.
+     */
+    void* user_data;
+} ZyanTraceHandler;
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/**
+ * @brief   Emits a trace event.
+ *
+ * @param   event               The event type.
+ * @param   object              The allocator or container instance.
+ * @param   address             The (new) address of the affected memory.
+ * @param   previous_address    The previous address of the affected memory or `ZYAN_NULL`.
+ * @param   size                The (new) size of the affected memory in bytes.
+ * @param   previous_size       The previous size of the affected memory in bytes or `0`.
+ *
+ * Expands to nothing, if Zycore is built without `ZYCORE_TRACING`. The arguments are not
+ * evaluated in this case.
+ *
+ * The addresses are passed as integers. They often refer to memory that was just allocated and
+ * is not initialized yet, which a `const void*` argument would flag as a potential read.
+ */
+#ifdef ZYCORE_TRACING
+#   define ZYAN_TRACE(event, object, address, previous_address, size, previous_size) \
+        ZyanTraceEmit((event), (object), (ZyanUPointer)(address), \
+            (ZyanUPointer)(previous_address), (size), (previous_size))
+#else
+#   define ZYAN_TRACE(event, object, address, previous_address, size, previous_size) \
+        ((void)0)
+#endif
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+#ifdef ZYCORE_TRACING
+
+/**
+ * @brief   Installs the given trace handler.
+ *
+ * @param   handler A pointer to the `ZyanTraceHandler` struct or `ZYAN_NULL` to remove the
+ *                  current handler.
+ *
+ * @return  A zycore status code.
+ *
+ * The handler is not copied and must stay valid until it is replaced and no other thread might
+ * still be executing its callback.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanTraceSetHandler(const ZyanTraceHandler* handler);
+
+/**
+ * @brief   Passes the given event to the installed handler and fires the USDT probe, if
+ *          available.
+ *
+ * @param   event               The event type.
+ * @param   object              The allocator or container instance.
+ * @param   address             The (new) address of the affected memory.
+ * @param   previous_address    The previous address of the affected memory or `0`.
+ * @param   size                The (new) size of the affected memory in bytes.
+ * @param   previous_size       The previous size of the affected memory in bytes or `0`.
+ *
+ * Use the `ZYAN_TRACE` macro instead of calling this function directly.
+ */
+ZYCORE_EXPORT void ZyanTraceEmit(ZyanTraceEvent event, const void* object, ZyanUPointer address,
+    ZyanUPointer previous_address, ZyanUSize size, ZyanUSize previous_size);
+
+#endif /* ZYCORE_TRACING */
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_TRACE_H */
@@ -41,6 +41,43 @@
 /* Enums and types                                                                                */
 /* ============================================================================================== */
 
+#ifdef ZYCORE_VECTOR_STATISTICS
+
+/**
+ * @brief   Defines the `ZyanVectorStatistics` struct.
+ *
+ * The statistics are only collected, if Zycore is built with `ZYCORE_VECTOR_STATISTICS`.
+ */
+typedef struct ZyanVectorStatistics_
+{
+    /**
+     * @brief   The number of calls to the `reallocate` function of the allocator.
+     */
+    ZyanU64 reallocations;
+    /**
+     * @brief   The number of reallocations that increased the capacity.
+     */
+    ZyanU64 grow_count;
+    /**
+     * @brief   The number of reallocations that decreased the capacity.
+     */
+    ZyanU64 shrink_count;
+    /**
+     * @brief   The number of bytes moved to close gaps after elements were deleted.
+     */
+    ZyanU64 shift_left_bytes;
+    /**
+     * @brief   The number of bytes moved to make room for inserted elements.
+     */
+    ZyanU64 shift_right_bytes;
+    /**
+     * @brief   The highest capacity (number of elements) the vector ever had.
+     */
+    ZyanUSize peak_capacity;
+} ZyanVectorStatistics;
+
+#endif /* ZYCORE_VECTOR_STATISTICS */
+
 /**
  * @brief   Defines the `ZyanVector` struct.
  *
@@ -77,8 +114,37 @@ typedef struct ZyanVector_
      * @brief   The data pointer.
      */
     void* data;
+#ifdef ZYCORE_VECTOR_STATISTICS
+    /**
+     * @brief   The instrumentation counters.
+     */
+    ZyanVectorStatistics statistics;
+#endif
 } ZyanVector;
 
+/**
+ * @brief   Defines the `ZyanVectorElementFunction` function prototype.
+ *
+ * @param   element     A pointer to the element.
+ * @param   index       The index of the element.
+ * @param   user_data   The user data pointer.
+ */
+typedef void (*ZyanVectorElementFunction)(void* element, ZyanUSize index, void* user_data);
+
+/**
+ * @brief   Defines the `ZyanVectorReduceFunction` function prototype.
+ *
+ * @param   accumulator A pointer to the accumulator.
+ * @param   value       A pointer to the value that is folded into the accumulator.
+ * @param   user_data   The user data pointer.
+ */
+typedef void (*ZyanVectorReduceFunction)(void* accumulator, const void* value, void* user_data);
+
+/**
+ * @brief   Forward declaration of the `ZyanThreadPool` struct (see `Zycore/ThreadPool.h`).
+ */
+struct ZyanThreadPool_;
+
 /* ============================================================================================== */
 /* Exported functions                                                                             */
 /* ============================================================================================== */
@@ -325,6 +391,187 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorSize(const ZyanVector* vector, ZyanUSize* siz
  */
 ZYCORE_EXPORT ZyanStatus ZyanVectorCapacity(const ZyanVector* vector, ZyanUSize* capacity);
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Unchecked access                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/*
+ * The following functions skip all argument and range checks and return their result directly
+ * instead of through an out-parameter, so they can be inlined into tight loops. The preconditions
+ * are only checked by assertions in debug builds; violating them results in undefined behavior.
+ */
+
+/**
+ * @brief   Returns a pointer to the element at the given `index` without any checks.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   index   The element index. Must be less than the size of the vector.
+ *
+ * @return  A pointer to the desired element in the vector.
+ */
+ZYAN_INLINE void* ZyanVectorGetUnchecked(const ZyanVector* vector, ZyanUSize index)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(index < vector->size);
+
+    return (ZyanU8*)vector->data + index * vector->element_size;
+}
+
+/**
+ * @brief   Returns a constant pointer to the element at the given `index` without any checks.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   index   The element index. Must be less than the size of the vector.
+ *
+ * @return  A constant pointer to the desired element in the vector.
+ */
+ZYAN_INLINE const void* ZyanVectorGetConstUnchecked(const ZyanVector* vector, ZyanUSize index)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(index < vector->size);
+
+    return (const ZyanU8*)vector->data + index * vector->element_size;
+}
+
+/**
+ * @brief   Adds a new `element` to the end of the vector without any checks.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance. The size of the vector must be less
+ *                  than its capacity (see `ZyanVectorReserve`).
+ * @param   element A pointer to the element to add.
+ *
+ * Unlike `ZyanVectorPush`, this function never grows the vector.
+ */
+ZYAN_INLINE void ZyanVectorPushUnchecked(ZyanVector* vector, const void* element)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(element);
+    ZYAN_ASSERT(vector->size < vector->capacity);
+
+    // Copied byte by byte to keep the internal `LibC.h` wrappers out of this public header
+    ZyanU8* const destination = (ZyanU8*)vector->data + vector->size * vector->element_size;
+    const ZyanU8* const source = (const ZyanU8*)element;
+    for (ZyanUSize i = 0; i < vector->element_size; ++i)
+    {
+        destination[i] = source[i];
+    }
+    ++vector->size;
+}
+
+/**
+ * @brief   Returns the current size of the vector without any checks.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ *
+ * @return  The size of the vector.
+ */
+ZYAN_INLINE ZyanUSize ZyanVectorSizeUnchecked(const ZyanVector* vector)
+{
+    ZYAN_ASSERT(vector);
+
+    return vector->size;
+}
+
+/**
+ * @brief   Returns the current capacity of the vector without any checks.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ *
+ * @return  The capacity of the vector.
+ */
+ZYAN_INLINE ZyanUSize ZyanVectorCapacityUnchecked(const ZyanVector* vector)
+{
+    ZYAN_ASSERT(vector);
+
+    return vector->capacity;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Statistics                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifdef ZYCORE_VECTOR_STATISTICS
+
+/**
+ * @brief   Returns the instrumentation counters of the vector.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   statistics  Receives the counters.
+ *
+ * @return  A zycore status code.
+ *
+ * A high number of `grow_count` events indicates a missing `ZyanVectorReserve` call or a growth
+ * factor that is too small. Repeated grow and shrink events indicate a shrink threshold that is
+ * too high.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorGetStatistics(const ZyanVector* vector,
+    ZyanVectorStatistics* statistics);
+
+/**
+ * @brief   Resets the instrumentation counters of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * The peak capacity is reset to the current capacity.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorResetStatistics(ZyanVector* vector);
+
+#endif /* ZYCORE_VECTOR_STATISTICS */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Parallel algorithms                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYCORE_NO_LIBC
+
+/**
+ * @brief   Invokes the given function for every element of the vector, using multiple threads.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   pool        A pointer to the `ZyanThreadPool` instance or `ZYAN_NULL` to process all
+ *                      elements on the calling thread.
+ * @param   function    The function to invoke for every element.
+ * @param   user_data   The user data pointer that is passed to `function`.
+ *
+ * @return  A zycore status code.
+ *
+ * The vector is split into chunks that consist of whole blocks of about 16 KiB, which limits
+ * false sharing between the threads to the elements around the chunk boundaries. Vectors that are
+ * smaller than two blocks are processed on the calling thread. The function is invoked
+ * concurrently and the elements are not visited in any particular order.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorParallelForEach(ZyanVector* vector,
+    struct ZyanThreadPool_* pool, ZyanVectorElementFunction function, void* user_data);
+
+/**
+ * @brief   Reduces all elements of the vector to a single value, using multiple threads.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   pool        A pointer to the `ZyanThreadPool` instance or `ZYAN_NULL` to process all
+ *                      elements on the calling thread.
+ * @param   result      Receives the result.
+ * @param   result_size The size of the result (and of `identity`) in bytes.
+ * @param   identity    A pointer to the identity value of the reduction (e.g. `0` for a sum).
+ * @param   reduce      The function that folds a single element into an accumulator.
+ * @param   combine     The function that folds the partial result of a chunk into an
+ *                      accumulator.
+ * @param   user_data   The user data pointer that is passed to `reduce` and `combine`.
+ *
+ * @return  A zycore status code.
+ *
+ * Every chunk is reduced into its own accumulator, which starts as a copy of `identity`. The
+ * partial results are combined in chunk order by the calling thread, so the result is
+ * deterministic for a given thread count, even for operations that are not associative (e.g.
+ * floating-point additions).
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorParallelReduce(const ZyanVector* vector,
+    struct ZyanThreadPool_* pool, void* result, ZyanUSize result_size, const void* identity,
+    ZyanVectorReduceFunction reduce, ZyanVectorReduceFunction combine, void* user_data);
+
+#endif /* ZYCORE_NO_LIBC */
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
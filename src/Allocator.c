@@ -26,6 +26,7 @@
 
 #include <Zycore/Allocator.h>
 #include <Zycore/LibC.h>
+#include <Zycore/Trace.h>
 
 /* ============================================================================================== */
 /* Internal functions                                                                             */
@@ -50,6 +51,7 @@ static ZyanStatus ZyanAllocatorDefaultAllocate(ZyanAllocator* allocator, void**
     {
         return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
     }
+    ZYAN_TRACE(ZYAN_TRACE_EVENT_ALLOCATE, allocator, *p, ZYAN_NULL, element_size * n, 0);
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -69,6 +71,8 @@ static ZyanStatus ZyanAllocatorDefaultReallocate(ZyanAllocator* allocator, void*
     {
         return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
     }
+    // The allocator interface does not pass the previous size
+    ZYAN_TRACE(ZYAN_TRACE_EVENT_REALLOCATE, allocator, x, *p, element_size * n, 0);
     *p = x;
 
     return ZYAN_STATUS_SUCCESS;
@@ -86,6 +90,7 @@ static ZyanStatus ZyanAllocatorDefaultDeallocate(ZyanAllocator* allocator, void*
     ZYAN_UNUSED(element_size);
     ZYAN_UNUSED(n);
 
+    ZYAN_TRACE(ZYAN_TRACE_EVENT_DEALLOCATE, allocator, p, ZYAN_NULL, element_size * n, 0);
     ZYAN_FREE(p);
 
     return ZYAN_STATUS_SUCCESS;
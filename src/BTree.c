@@ -0,0 +1,1211 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/BTree.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+#define ZYAN_BTREE_NODE_SIZE         512
+#define ZYAN_BTREE_MIN_NODE_CAPACITY 4
+#define ZYAN_BTREE_MAX_HEIGHT        64
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanBTreeNode` struct.
+ *
+ * This struct is the header of every node. A leaf node is followed by an array of keys and an
+ * array of values. An inner node is followed by an array of child pointers and an array of
+ * separator keys. All keys in the subtree `children[i]` are less than `keys[i]` and all keys in
+ * the subtree `children[i + 1]` are greater than or equal to `keys[i]`.
+ *
+ * Every node has room for one more entry than its capacity. This allows to insert first and split
+ * afterwards.
+ */
+typedef struct ZyanBTreeNode_
+{
+    /**
+     * @brief   The previous leaf node (leaf nodes only).
+     */
+    struct ZyanBTreeNode_* prev;
+    /**
+     * @brief   The next leaf node (leaf nodes only).
+     */
+    struct ZyanBTreeNode_* next;
+    /**
+     * @brief   The number of keys in this node.
+     */
+    ZyanU32 count;
+    /**
+     * @brief   Signals, if this is a leaf node.
+     */
+    ZyanBool is_leaf;
+} ZyanBTreeNode;
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the size of the node header, rounded up to a multiple of the pointer size.
+ */
+#define ZYAN_BTREE_HEADER_SIZE \
+    ((sizeof(ZyanBTreeNode) + sizeof(void*) - 1) & ~(sizeof(void*) - 1))
+
+/**
+ * @brief   Returns a pointer to the key at the given `index` of a leaf node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the leaf node.
+ * @param   index   The key index.
+ */
+#define ZYAN_BTREE_LEAF_KEY(tree, node, index) \
+    ((ZyanU8*)(node) + ZYAN_BTREE_HEADER_SIZE + (index) * (tree)->key_size)
+
+/**
+ * @brief   Returns a pointer to the value at the given `index` of a leaf node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the leaf node.
+ * @param   index   The value index.
+ */
+#define ZYAN_BTREE_LEAF_VALUE(tree, node, index) \
+    ((ZyanU8*)(node) + (tree)->leaf_values_offset + (index) * (tree)->value_size)
+
+/**
+ * @brief   Returns a pointer to the child pointer array of an inner node.
+ *
+ * @param   node    A pointer to the inner node.
+ */
+#define ZYAN_BTREE_CHILDREN(node) \
+    ((ZyanBTreeNode**)((ZyanU8*)(node) + ZYAN_BTREE_HEADER_SIZE))
+
+/**
+ * @brief   Returns a pointer to the key at the given `index` of an inner node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the inner node.
+ * @param   index   The key index.
+ */
+#define ZYAN_BTREE_INNER_KEY(tree, node, index) \
+    ((ZyanU8*)(node) + (tree)->inner_keys_offset + (index) * (tree)->key_size)
+
+/**
+ * @brief   Returns a pointer to the key at the given `index` of a leaf or inner node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the node.
+ * @param   index   The key index.
+ */
+#define ZYAN_BTREE_KEY(tree, node, index) \
+    ((node)->is_leaf ? ZYAN_BTREE_LEAF_KEY(tree, node, index) : \
+        ZYAN_BTREE_INNER_KEY(tree, node, index))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Node management                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Allocates a new empty node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    Receives a pointer to the new node.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanBTreeAllocateNode(ZyanBTree* tree, ZyanBTreeNode** node)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+
+    ZYAN_CHECK(tree->allocator->allocate(tree->allocator, (void**)node, tree->node_size, 1));
+    (*node)->prev    = ZYAN_NULL;
+    (*node)->next    = ZYAN_NULL;
+    (*node)->count   = 0;
+    (*node)->is_leaf = ZYAN_FALSE;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Deallocates the given `node`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the node.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanBTreeFreeNode(ZyanBTree* tree, ZyanBTreeNode* node)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+
+    return tree->allocator->deallocate(tree->allocator, node, tree->node_size, 1);
+}
+
+/**
+ * @brief   Deallocates the given `node` and all of its descendants.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the node.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanBTreeFreeSubtree(ZyanBTree* tree, ZyanBTreeNode* node)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+
+    if (!node->is_leaf)
+    {
+        ZyanBTreeNode** const children = ZYAN_BTREE_CHILDREN(node);
+        for (ZyanUSize i = 0; i <= node->count; ++i)
+        {
+            ZYAN_CHECK(ZyanBTreeFreeSubtree(tree, children[i]));
+        }
+    }
+
+    return ZyanBTreeFreeNode(tree, node);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Search                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the index of the first key in the given `node` that is not less than `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the node.
+ * @param   key     A pointer to the key.
+ *
+ * @return  The index of the first key that is not less than `key`.
+ */
+static ZyanUSize ZyanBTreeLowerBoundIndex(const ZyanBTree* tree, const ZyanBTreeNode* node,
+    const void* key)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+
+    const ZyanU8* const keys = ZYAN_BTREE_KEY(tree, node, 0);
+    ZyanUSize lo = 0;
+    ZyanUSize hi = node->count;
+    while (lo < hi)
+    {
+        const ZyanUSize mid = lo + (hi - lo) / 2;
+        if (tree->comparison(keys + mid * tree->key_size, key) < 0)
+        {
+            lo = mid + 1;
+        } else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * @brief   Returns the index of the first key in the given `node` that is greater than `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the node.
+ * @param   key     A pointer to the key.
+ *
+ * @return  The index of the first key that is greater than `key`.
+ */
+static ZyanUSize ZyanBTreeUpperBoundIndex(const ZyanBTree* tree, const ZyanBTreeNode* node,
+    const void* key)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+
+    const ZyanU8* const keys = ZYAN_BTREE_KEY(tree, node, 0);
+    ZyanUSize lo = 0;
+    ZyanUSize hi = node->count;
+    while (lo < hi)
+    {
+        const ZyanUSize mid = lo + (hi - lo) / 2;
+        if (tree->comparison(keys + mid * tree->key_size, key) <= 0)
+        {
+            lo = mid + 1;
+        } else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * @brief   Returns the leaf node that might contain the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ *
+ * @return  A pointer to the leaf node.
+ */
+static ZyanBTreeNode* ZyanBTreeFindLeaf(const ZyanBTree* tree, const void* key)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(tree->root);
+
+    ZyanBTreeNode* node = (ZyanBTreeNode*)tree->root;
+    while (!node->is_leaf)
+    {
+        node = ZYAN_BTREE_CHILDREN(node)[ZyanBTreeUpperBoundIndex(tree, node, key)];
+    }
+
+    return node;
+}
+
+/**
+ * @brief   Returns the smallest key in the subtree rooted at the given `node`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the node.
+ *
+ * @return  A pointer to the smallest key.
+ */
+static const void* ZyanBTreeMinKey(const ZyanBTree* tree, const ZyanBTreeNode* node)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+
+    while (!node->is_leaf)
+    {
+        node = ZYAN_BTREE_CHILDREN(node)[0];
+    }
+
+    return ZYAN_BTREE_LEAF_KEY(tree, node, 0);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Node modification                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Moves the entries `[index, count)` of a leaf node by `delta` positions.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the leaf node.
+ * @param   index   The index of the first entry to move.
+ * @param   delta   The number of positions to move the entries by (`1` or `-1`).
+ */
+static void ZyanBTreeLeafShift(const ZyanBTree* tree, ZyanBTreeNode* node, ZyanUSize index,
+    ZyanISize delta)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+    ZYAN_ASSERT(index <= node->count);
+
+    const ZyanUSize count = node->count - index;
+    if (!count)
+    {
+        return;
+    }
+    ZYAN_MEMMOVE(ZYAN_BTREE_LEAF_KEY(tree, node, index + delta),
+        ZYAN_BTREE_LEAF_KEY(tree, node, index), count * tree->key_size);
+    if (tree->value_size)
+    {
+        ZYAN_MEMMOVE(ZYAN_BTREE_LEAF_VALUE(tree, node, index + delta),
+            ZYAN_BTREE_LEAF_VALUE(tree, node, index), count * tree->value_size);
+    }
+}
+
+/**
+ * @brief   Copies `count` entries from one leaf node to another.
+ *
+ * @param   tree        A pointer to the `ZyanBTree` instance.
+ * @param   destination A pointer to the destination leaf node.
+ * @param   index       The destination index.
+ * @param   source      A pointer to the source leaf node.
+ * @param   first       The source index.
+ * @param   count       The number of entries to copy.
+ */
+static void ZyanBTreeLeafCopy(const ZyanBTree* tree, ZyanBTreeNode* destination, ZyanUSize index,
+    const ZyanBTreeNode* source, ZyanUSize first, ZyanUSize count)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(destination);
+    ZYAN_ASSERT(source);
+
+    if (!count)
+    {
+        return;
+    }
+    ZYAN_MEMCPY(ZYAN_BTREE_LEAF_KEY(tree, destination, index),
+        ZYAN_BTREE_LEAF_KEY(tree, source, first), count * tree->key_size);
+    if (tree->value_size)
+    {
+        ZYAN_MEMCPY(ZYAN_BTREE_LEAF_VALUE(tree, destination, index),
+            ZYAN_BTREE_LEAF_VALUE(tree, source, first), count * tree->value_size);
+    }
+}
+
+/**
+ * @brief   Inserts a separator `key` and the `child` to its right at the given `index` of an
+ *          inner node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the inner node.
+ * @param   index   The key index.
+ * @param   key     A pointer to the separator key.
+ * @param   child   A pointer to the child node.
+ */
+static void ZyanBTreeInnerInsert(const ZyanBTree* tree, ZyanBTreeNode* node, ZyanUSize index,
+    const void* key, ZyanBTreeNode* child)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+    ZYAN_ASSERT(index <= node->count);
+
+    ZyanBTreeNode** const children = ZYAN_BTREE_CHILDREN(node);
+    const ZyanUSize count = node->count - index;
+    if (count)
+    {
+        ZYAN_MEMMOVE(ZYAN_BTREE_INNER_KEY(tree, node, index + 1),
+            ZYAN_BTREE_INNER_KEY(tree, node, index), count * tree->key_size);
+        ZYAN_MEMMOVE(&children[index + 2], &children[index + 1], count * sizeof(ZyanBTreeNode*));
+    }
+    ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, node, index), key, tree->key_size);
+    children[index + 1] = child;
+    ++node->count;
+}
+
+/**
+ * @brief   Removes the separator key at the given `index` and the child to its right from an
+ *          inner node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the inner node.
+ * @param   index   The key index.
+ */
+static void ZyanBTreeInnerRemove(const ZyanBTree* tree, ZyanBTreeNode* node, ZyanUSize index)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+    ZYAN_ASSERT(index < node->count);
+
+    ZyanBTreeNode** const children = ZYAN_BTREE_CHILDREN(node);
+    const ZyanUSize count = node->count - index - 1;
+    if (count)
+    {
+        ZYAN_MEMMOVE(ZYAN_BTREE_INNER_KEY(tree, node, index),
+            ZYAN_BTREE_INNER_KEY(tree, node, index + 1), count * tree->key_size);
+        ZYAN_MEMMOVE(&children[index + 1], &children[index + 2], count * sizeof(ZyanBTreeNode*));
+    }
+    --node->count;
+}
+
+/**
+ * @brief   Moves the upper half of an overflowing leaf node to the empty `right` node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the leaf node.
+ * @param   right   A pointer to the new right sibling.
+ */
+static void ZyanBTreeSplitLeaf(const ZyanBTree* tree, ZyanBTreeNode* node, ZyanBTreeNode* right)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+    ZYAN_ASSERT(right);
+
+    const ZyanUSize left_count = node->count / 2;
+    ZyanBTreeLeafCopy(tree, right, 0, node, left_count, node->count - left_count);
+    right->is_leaf = ZYAN_TRUE;
+    right->count   = node->count - (ZyanU32)left_count;
+    node->count    = (ZyanU32)left_count;
+
+    right->prev = node;
+    right->next = node->next;
+    if (node->next)
+    {
+        node->next->prev = right;
+    }
+    node->next = right;
+}
+
+/**
+ * @brief   Moves the upper half of an overflowing inner node to the empty `right` node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the inner node.
+ * @param   right   A pointer to the new right sibling.
+ *
+ * @return  A pointer to the separator key that has to be inserted into the parent node. The key
+ *          remains valid until the next modification of `node`.
+ */
+static const void* ZyanBTreeSplitInner(const ZyanBTree* tree, ZyanBTreeNode* node,
+    ZyanBTreeNode* right)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+    ZYAN_ASSERT(right);
+
+    const ZyanUSize mid = node->count / 2;
+    const ZyanUSize right_count = node->count - mid - 1;
+    ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, right, 0), ZYAN_BTREE_INNER_KEY(tree, node, mid + 1),
+        right_count * tree->key_size);
+    ZYAN_MEMCPY(ZYAN_BTREE_CHILDREN(right), &ZYAN_BTREE_CHILDREN(node)[mid + 1],
+        (right_count + 1) * sizeof(ZyanBTreeNode*));
+    right->is_leaf = ZYAN_FALSE;
+    right->count   = (ZyanU32)right_count;
+    node->count    = (ZyanU32)mid;
+
+    return ZYAN_BTREE_INNER_KEY(tree, node, mid);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Rebalancing                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Restores the minimum fill of an underflowing leaf node by borrowing an entry from
+ *          or merging it with one of its siblings.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   parent  A pointer to the parent node.
+ * @param   index   The index of the leaf node in the parent node.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if two nodes were merged or `ZYAN_STATUS_FALSE`, if not. Another
+ *          zycore status code, if an error occured.
+ */
+static ZyanStatus ZyanBTreeRebalanceLeaf(ZyanBTree* tree, ZyanBTreeNode* parent, ZyanUSize index)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(parent);
+    ZYAN_ASSERT(parent->count > 0);
+
+    ZyanBTreeNode** const children = ZYAN_BTREE_CHILDREN(parent);
+    ZyanBTreeNode* const node = children[index];
+    ZyanBTreeNode* const left = (index > 0) ? children[index - 1] : ZYAN_NULL;
+    ZyanBTreeNode* const right = (index < parent->count) ? children[index + 1] : ZYAN_NULL;
+    const ZyanUSize min = tree->leaf_capacity / 2;
+
+    if (left && (left->count > min))
+    {
+        ZyanBTreeLeafShift(tree, node, 0, 1);
+        ZyanBTreeLeafCopy(tree, node, 0, left, left->count - 1, 1);
+        --left->count;
+        ++node->count;
+        ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, parent, index - 1),
+            ZYAN_BTREE_LEAF_KEY(tree, node, 0), tree->key_size);
+        return ZYAN_STATUS_FALSE;
+    }
+    if (right && (right->count > min))
+    {
+        ZyanBTreeLeafCopy(tree, node, node->count, right, 0, 1);
+        ++node->count;
+        ZyanBTreeLeafShift(tree, right, 1, -1);
+        --right->count;
+        ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, parent, index),
+            ZYAN_BTREE_LEAF_KEY(tree, right, 0), tree->key_size);
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanBTreeNode* const target = left ? left : node;
+    ZyanBTreeNode* const source = left ? node : right;
+    ZYAN_ASSERT(source);
+    ZyanBTreeLeafCopy(tree, target, target->count, source, 0, source->count);
+    target->count += source->count;
+    target->next = source->next;
+    if (source->next)
+    {
+        source->next->prev = target;
+    }
+    ZyanBTreeInnerRemove(tree, parent, left ? index - 1 : index);
+
+    ZYAN_CHECK(ZyanBTreeFreeNode(tree, source));
+    return ZYAN_STATUS_TRUE;
+}
+
+/**
+ * @brief   Restores the minimum fill of an underflowing inner node by borrowing an entry from
+ *          or merging it with one of its siblings.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   parent  A pointer to the parent node.
+ * @param   index   The index of the inner node in the parent node.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if two nodes were merged or `ZYAN_STATUS_FALSE`, if not. Another
+ *          zycore status code, if an error occured.
+ */
+static ZyanStatus ZyanBTreeRebalanceInner(ZyanBTree* tree, ZyanBTreeNode* parent, ZyanUSize index)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(parent);
+    ZYAN_ASSERT(parent->count > 0);
+
+    ZyanBTreeNode** const siblings = ZYAN_BTREE_CHILDREN(parent);
+    ZyanBTreeNode* const node = siblings[index];
+    ZyanBTreeNode* const left = (index > 0) ? siblings[index - 1] : ZYAN_NULL;
+    ZyanBTreeNode* const right = (index < parent->count) ? siblings[index + 1] : ZYAN_NULL;
+    ZyanBTreeNode** const children = ZYAN_BTREE_CHILDREN(node);
+    const ZyanUSize min = tree->inner_capacity / 2;
+
+    if (left && (left->count > min))
+    {
+        // Rotate the separator down and the last key of the left sibling up
+        ZYAN_MEMMOVE(ZYAN_BTREE_INNER_KEY(tree, node, 1), ZYAN_BTREE_INNER_KEY(tree, node, 0),
+            node->count * tree->key_size);
+        ZYAN_MEMMOVE(&children[1], &children[0], (node->count + 1) * sizeof(ZyanBTreeNode*));
+        ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, node, 0),
+            ZYAN_BTREE_INNER_KEY(tree, parent, index - 1), tree->key_size);
+        children[0] = ZYAN_BTREE_CHILDREN(left)[left->count];
+        ++node->count;
+        ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, parent, index - 1),
+            ZYAN_BTREE_INNER_KEY(tree, left, left->count - 1), tree->key_size);
+        --left->count;
+        return ZYAN_STATUS_FALSE;
+    }
+    if (right && (right->count > min))
+    {
+        // Rotate the separator down and the first key of the right sibling up
+        ZyanBTreeNode** const right_children = ZYAN_BTREE_CHILDREN(right);
+        ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, node, node->count),
+            ZYAN_BTREE_INNER_KEY(tree, parent, index), tree->key_size);
+        children[node->count + 1] = right_children[0];
+        ++node->count;
+        ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, parent, index),
+            ZYAN_BTREE_INNER_KEY(tree, right, 0), tree->key_size);
+        ZYAN_MEMMOVE(ZYAN_BTREE_INNER_KEY(tree, right, 0), ZYAN_BTREE_INNER_KEY(tree, right, 1),
+            (right->count - 1) * tree->key_size);
+        ZYAN_MEMMOVE(&right_children[0], &right_children[1], right->count * sizeof(ZyanBTreeNode*));
+        --right->count;
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanBTreeNode* const target = left ? left : node;
+    ZyanBTreeNode* const source = left ? node : right;
+    const ZyanUSize separator = left ? index - 1 : index;
+    ZYAN_ASSERT(source);
+    ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, target, target->count),
+        ZYAN_BTREE_INNER_KEY(tree, parent, separator), tree->key_size);
+    ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, target, target->count + 1),
+        ZYAN_BTREE_INNER_KEY(tree, source, 0), source->count * tree->key_size);
+    ZYAN_MEMCPY(&ZYAN_BTREE_CHILDREN(target)[target->count + 1], ZYAN_BTREE_CHILDREN(source),
+        (source->count + 1) * sizeof(ZyanBTreeNode*));
+    target->count += source->count + 1;
+    ZyanBTreeInnerRemove(tree, parent, separator);
+
+    ZYAN_CHECK(ZyanBTreeFreeNode(tree, source));
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBTreeInit(ZyanBTree* tree, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanComparison comparison)
+{
+    return ZyanBTreeInitEx(tree, key_size, value_size, comparison, ZYAN_BTREE_NODE_SIZE,
+        ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanBTreeInitEx(ZyanBTree* tree, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanComparison comparison, ZyanUSize node_size, ZyanAllocator* allocator)
+{
+    if (!tree || !key_size || !comparison || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Every node has room for `capacity + 1` entries (see `ZyanBTreeNode`)
+    const ZyanUSize slots = ZYAN_BTREE_MIN_NODE_CAPACITY + 1;
+    const ZyanUSize align = sizeof(void*) - 1;
+    const ZyanUSize min_leaf_size =
+        ZYAN_BTREE_HEADER_SIZE + align + slots * (key_size + value_size);
+    const ZyanUSize min_inner_size =
+        ZYAN_BTREE_HEADER_SIZE + sizeof(void*) + slots * (key_size + sizeof(void*));
+    node_size = ZYAN_MAX(node_size, ZYAN_MAX(min_leaf_size, min_inner_size));
+
+    const ZyanUSize leaf_slots =
+        (node_size - ZYAN_BTREE_HEADER_SIZE - align) / (key_size + value_size);
+    const ZyanUSize inner_slots =
+        (node_size - ZYAN_BTREE_HEADER_SIZE - sizeof(void*)) / (key_size + sizeof(void*));
+
+    tree->allocator          = allocator;
+    tree->comparison         = comparison;
+    tree->key_size           = key_size;
+    tree->value_size         = value_size;
+    tree->node_size          = node_size;
+    tree->leaf_capacity      = leaf_slots - 1;
+    tree->inner_capacity     = inner_slots - 1;
+    tree->leaf_values_offset =
+        (ZYAN_BTREE_HEADER_SIZE + leaf_slots * key_size + align) & ~align;
+    tree->inner_keys_offset  = ZYAN_BTREE_HEADER_SIZE + (inner_slots + 1) * sizeof(void*);
+    tree->root               = ZYAN_NULL;
+    tree->size               = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBTreeDestroy(ZyanBTree* tree)
+{
+    return ZyanBTreeClear(tree);
+}
+
+ZyanStatus ZyanBTreeBulkLoad(ZyanBTree* tree, const ZyanVector* entries)
+{
+    if (!tree || !entries || (entries->element_size != tree->key_size + tree->value_size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (tree->root)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+    if (!entries->size)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // The node array holds the nodes of the current level. It is reused in-place for the next
+    // level, as every parent node consumes at least one child
+    const ZyanUSize leaf_count = (entries->size + tree->leaf_capacity - 1) / tree->leaf_capacity;
+    ZyanBTreeNode** nodes;
+    ZYAN_CHECK(tree->allocator->allocate(tree->allocator, (void**)&nodes, sizeof(ZyanBTreeNode*),
+        leaf_count));
+
+    ZyanStatus status = ZYAN_STATUS_SUCCESS;
+    ZyanUSize count = 0;
+    ZyanUSize built = 0;
+    ZyanUSize consumed = 0;
+
+    // Distribute the entries evenly across the leaf nodes. The order of the keys is validated after
+    // copying them, as the packed entries might not be suitably aligned for the comparison function
+    const ZyanU8* entry = (const ZyanU8*)entries->data;
+    const void* previous = ZYAN_NULL;
+    for (; built < leaf_count; ++built)
+    {
+        ZyanBTreeNode* leaf;
+        status = ZyanBTreeAllocateNode(tree, &leaf);
+        if (!ZYAN_SUCCESS(status))
+        {
+            goto CleanUp;
+        }
+        leaf->is_leaf = ZYAN_TRUE;
+        leaf->count = (ZyanU32)(entries->size / leaf_count + (built < entries->size % leaf_count));
+        for (ZyanUSize i = 0; i < leaf->count; ++i)
+        {
+            ZYAN_MEMCPY(ZYAN_BTREE_LEAF_KEY(tree, leaf, i), entry, tree->key_size);
+            if (tree->value_size)
+            {
+                ZYAN_MEMCPY(ZYAN_BTREE_LEAF_VALUE(tree, leaf, i), entry + tree->key_size,
+                    tree->value_size);
+            }
+            entry += entries->element_size;
+        }
+        if (built)
+        {
+            leaf->prev = nodes[built - 1];
+            nodes[built - 1]->next = leaf;
+        }
+        nodes[built] = leaf;
+        for (ZyanUSize i = 0; i < leaf->count; ++i)
+        {
+            const void* const key = ZYAN_BTREE_LEAF_KEY(tree, leaf, i);
+            if (previous && (tree->comparison(previous, key) >= 0))
+            {
+                ++built;
+                status = ZYAN_STATUS_INVALID_ARGUMENT;
+                goto CleanUp;
+            }
+            previous = key;
+        }
+    }
+    count = leaf_count;
+
+    // Build the inner levels bottom-up, again distributing the children evenly
+    while (count > 1)
+    {
+        const ZyanUSize fanout = tree->inner_capacity + 1;
+        const ZyanUSize parents = (count + fanout - 1) / fanout;
+        built = 0;
+        consumed = 0;
+        for (; built < parents; ++built)
+        {
+            ZyanBTreeNode* node;
+            status = ZyanBTreeAllocateNode(tree, &node);
+            if (!ZYAN_SUCCESS(status))
+            {
+                goto CleanUp;
+            }
+            const ZyanUSize children = count / parents + (built < count % parents);
+            ZyanBTreeNode** const node_children = ZYAN_BTREE_CHILDREN(node);
+            for (ZyanUSize i = 0; i < children; ++i)
+            {
+                node_children[i] = nodes[consumed + i];
+                if (i)
+                {
+                    ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, node, i - 1),
+                        ZyanBTreeMinKey(tree, node_children[i]), tree->key_size);
+                }
+            }
+            node->count = (ZyanU32)(children - 1);
+            consumed += children;
+            nodes[built] = node;
+        }
+        count = parents;
+    }
+
+    tree->root = nodes[0];
+    tree->size = entries->size;
+    return tree->allocator->deallocate(tree->allocator, nodes, sizeof(ZyanBTreeNode*),
+        leaf_count);
+
+CleanUp:
+    // `nodes[0, built)` and `nodes[consumed, count)` are the roots of all subtrees built so far
+    for (ZyanUSize i = 0; i < built; ++i)
+    {
+        ZYAN_CHECK(ZyanBTreeFreeSubtree(tree, nodes[i]));
+    }
+    for (ZyanUSize i = consumed; i < count; ++i)
+    {
+        ZYAN_CHECK(ZyanBTreeFreeSubtree(tree, nodes[i]));
+    }
+    ZYAN_CHECK(tree->allocator->deallocate(tree->allocator, nodes, sizeof(ZyanBTreeNode*),
+        leaf_count));
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBTreeGet(const ZyanBTree* tree, const void* key, void** value)
+{
+    if (ZYAN_UNLIKELY(!tree || !key || !value))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!tree->root)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanBTreeNode* const leaf = ZyanBTreeFindLeaf(tree, key);
+    const ZyanUSize index = ZyanBTreeLowerBoundIndex(tree, leaf, key);
+    if ((index == leaf->count) ||
+        tree->comparison(ZYAN_BTREE_LEAF_KEY(tree, leaf, index), key) != 0)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    *value = ZYAN_BTREE_LEAF_VALUE(tree, leaf, index);
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBTreeInsert(ZyanBTree* tree, const void* key, const void* value)
+{
+    if (ZYAN_UNLIKELY(!tree || !key || (!value && tree->value_size)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!tree->root)
+    {
+        ZyanBTreeNode* leaf;
+        ZYAN_CHECK(ZyanBTreeAllocateNode(tree, &leaf));
+        leaf->is_leaf = ZYAN_TRUE;
+        tree->root = leaf;
+    }
+
+    ZyanBTreeNode* path[ZYAN_BTREE_MAX_HEIGHT];
+    ZyanUSize path_index[ZYAN_BTREE_MAX_HEIGHT];
+    ZyanUSize depth = 0;
+
+    ZyanBTreeNode* node = (ZyanBTreeNode*)tree->root;
+    while (!node->is_leaf)
+    {
+        ZYAN_ASSERT(depth < ZYAN_BTREE_MAX_HEIGHT);
+        const ZyanUSize index = ZyanBTreeUpperBoundIndex(tree, node, key);
+        path[depth] = node;
+        path_index[depth] = index;
+        ++depth;
+        node = ZYAN_BTREE_CHILDREN(node)[index];
+    }
+
+    const ZyanUSize index = ZyanBTreeLowerBoundIndex(tree, node, key);
+    if ((index < node->count) &&
+        tree->comparison(ZYAN_BTREE_LEAF_KEY(tree, node, index), key) == 0)
+    {
+        if (tree->value_size)
+        {
+            ZYAN_MEMCPY(ZYAN_BTREE_LEAF_VALUE(tree, node, index), value, tree->value_size);
+        }
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Allocate all nodes required for splitting in advance, so that a failed allocation leaves the
+    // tree untouched
+    ZyanBTreeNode* spare[ZYAN_BTREE_MAX_HEIGHT + 1];
+    ZyanUSize spare_count = 0;
+    if (node->count == tree->leaf_capacity)
+    {
+        ZyanUSize required = 1;
+        ZyanUSize level = depth;
+        while (level && (path[level - 1]->count == tree->inner_capacity))
+        {
+            ++required;
+            --level;
+        }
+        if (!level)
+        {
+            // The root node has to be split as well
+            ++required;
+        }
+        for (; spare_count < required; ++spare_count)
+        {
+            const ZyanStatus status = ZyanBTreeAllocateNode(tree, &spare[spare_count]);
+            if (!ZYAN_SUCCESS(status))
+            {
+                while (spare_count)
+                {
+                    ZYAN_CHECK(ZyanBTreeFreeNode(tree, spare[--spare_count]));
+                }
+                return status;
+            }
+        }
+    }
+
+    ZyanBTreeLeafShift(tree, node, index, 1);
+    ZYAN_MEMCPY(ZYAN_BTREE_LEAF_KEY(tree, node, index), key, tree->key_size);
+    if (tree->value_size)
+    {
+        ZYAN_MEMCPY(ZYAN_BTREE_LEAF_VALUE(tree, node, index), value, tree->value_size);
+    }
+    ++node->count;
+    ++tree->size;
+
+    if (node->count <= tree->leaf_capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanBTreeNode* right = spare[--spare_count];
+    ZyanBTreeSplitLeaf(tree, node, right);
+    const void* separator = ZYAN_BTREE_LEAF_KEY(tree, right, 0);
+
+    while (depth)
+    {
+        --depth;
+        ZyanBTreeNode* const parent = path[depth];
+        ZyanBTreeInnerInsert(tree, parent, path_index[depth], separator, right);
+        if (parent->count <= tree->inner_capacity)
+        {
+            ZYAN_ASSERT(!spare_count);
+            return ZYAN_STATUS_SUCCESS;
+        }
+        right = spare[--spare_count];
+        separator = ZyanBTreeSplitInner(tree, parent, right);
+    }
+
+    // Grow the tree by one level
+    ZYAN_ASSERT(spare_count == 1);
+    ZyanBTreeNode* const root = spare[0];
+    ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, root, 0), separator, tree->key_size);
+    ZYAN_BTREE_CHILDREN(root)[0] = (ZyanBTreeNode*)tree->root;
+    ZYAN_BTREE_CHILDREN(root)[1] = right;
+    root->count = 1;
+    tree->root = root;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBTreeRemove(ZyanBTree* tree, const void* key)
+{
+    if (ZYAN_UNLIKELY(!tree || !key))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!tree->root)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanBTreeNode* path[ZYAN_BTREE_MAX_HEIGHT];
+    ZyanUSize path_index[ZYAN_BTREE_MAX_HEIGHT];
+    ZyanUSize depth = 0;
+
+    ZyanBTreeNode* node = (ZyanBTreeNode*)tree->root;
+    while (!node->is_leaf)
+    {
+        ZYAN_ASSERT(depth < ZYAN_BTREE_MAX_HEIGHT);
+        const ZyanUSize index = ZyanBTreeUpperBoundIndex(tree, node, key);
+        path[depth] = node;
+        path_index[depth] = index;
+        ++depth;
+        node = ZYAN_BTREE_CHILDREN(node)[index];
+    }
+
+    const ZyanUSize index = ZyanBTreeLowerBoundIndex(tree, node, key);
+    if ((index == node->count) ||
+        tree->comparison(ZYAN_BTREE_LEAF_KEY(tree, node, index), key) != 0)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanBTreeLeafShift(tree, node, index + 1, -1);
+    --node->count;
+    --tree->size;
+
+    // Walk up the tree as long as nodes are merged
+    while (depth)
+    {
+        const ZyanUSize min = node->is_leaf ? tree->leaf_capacity / 2 : tree->inner_capacity / 2;
+        if (node->count >= min)
+        {
+            return ZYAN_STATUS_TRUE;
+        }
+
+        --depth;
+        const ZyanStatus status = node->is_leaf
+            ? ZyanBTreeRebalanceLeaf(tree, path[depth], path_index[depth])
+            : ZyanBTreeRebalanceInner(tree, path[depth], path_index[depth]);
+        ZYAN_CHECK(status);
+        if (status == ZYAN_STATUS_FALSE)
+        {
+            return ZYAN_STATUS_TRUE;
+        }
+        node = path[depth];
+    }
+
+    // Shrink the tree, if the root node became empty
+    if (!node->count)
+    {
+        tree->root = node->is_leaf ? ZYAN_NULL : ZYAN_BTREE_CHILDREN(node)[0];
+        ZYAN_CHECK(ZyanBTreeFreeNode(tree, node));
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanBTreeClear(ZyanBTree* tree)
+{
+    if (!tree)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (tree->root)
+    {
+        ZYAN_CHECK(ZyanBTreeFreeSubtree(tree, (ZyanBTreeNode*)tree->root));
+        tree->root = ZYAN_NULL;
+    }
+    tree->size = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBTreeBegin(const ZyanBTree* tree, ZyanBTreeIterator* iterator)
+{
+    if (!tree || !iterator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBTreeNode* node = (ZyanBTreeNode*)tree->root;
+    while (node && !node->is_leaf)
+    {
+        node = ZYAN_BTREE_CHILDREN(node)[0];
+    }
+
+    iterator->tree  = tree;
+    iterator->node  = node;
+    iterator->index = 0;
+
+    return node ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanBTreeLowerBound(const ZyanBTree* tree, const void* key,
+    ZyanBTreeIterator* iterator)
+{
+    if (!tree || !key || !iterator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    iterator->tree  = tree;
+    iterator->node  = ZYAN_NULL;
+    iterator->index = 0;
+    if (!tree->root)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanBTreeNode* const leaf = ZyanBTreeFindLeaf(tree, key);
+    const ZyanUSize index = ZyanBTreeLowerBoundIndex(tree, leaf, key);
+    if (index < leaf->count)
+    {
+        iterator->node  = leaf;
+        iterator->index = index;
+    } else
+    {
+        // Leaf nodes are never empty, so the first entry of the next leaf is the lower bound
+        iterator->node  = leaf->next;
+    }
+
+    return iterator->node ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanBTreeIteratorNext(ZyanBTreeIterator* iterator)
+{
+    if (ZYAN_UNLIKELY(!iterator))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanBTreeNode* const node = (const ZyanBTreeNode*)iterator->node;
+    if (!node)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    if (++iterator->index >= node->count)
+    {
+        iterator->node  = node->next;
+        iterator->index = 0;
+    }
+
+    return iterator->node ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanBTreeIteratorGet(const ZyanBTreeIterator* iterator, const void** key,
+    void** value)
+{
+    if (ZYAN_UNLIKELY(!iterator || !iterator->tree))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(!iterator->node))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (key)
+    {
+        *key = ZYAN_BTREE_LEAF_KEY(iterator->tree, iterator->node, iterator->index);
+    }
+    if (value)
+    {
+        *value = ZYAN_BTREE_LEAF_VALUE(iterator->tree, iterator->node, iterator->index);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBTreeForEachInRange(const ZyanBTree* tree, const void* first,
+    const void* last, ZyanBTreeCallback callback, void* user_data)
+{
+    if (!tree || !first || !last || !callback)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBTreeIterator iterator;
+    ZYAN_CHECK(ZyanBTreeLowerBound(tree, first, &iterator));
+
+    const ZyanBTreeNode* node = (const ZyanBTreeNode*)iterator.node;
+    ZyanUSize index = iterator.index;
+    while (node)
+    {
+        // Check the last key of the node once and skip the per-entry checks, if possible
+        const ZyanBool is_last =
+            tree->comparison(ZYAN_BTREE_LEAF_KEY(tree, node, node->count - 1), last) >= 0;
+        for (; index < node->count; ++index)
+        {
+            const void* const key = ZYAN_BTREE_LEAF_KEY(tree, node, index);
+            if (is_last && (tree->comparison(key, last) >= 0))
+            {
+                return ZYAN_STATUS_SUCCESS;
+            }
+            const ZyanStatus status =
+                callback(key, ZYAN_BTREE_LEAF_VALUE(tree, node, index), user_data);
+            if (status == ZYAN_STATUS_FALSE)
+            {
+                return ZYAN_STATUS_SUCCESS;
+            }
+            ZYAN_CHECK(status);
+        }
+        if (is_last)
+        {
+            break;
+        }
+        node = node->next;
+        index = 0;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBTreeSize(const ZyanBTree* tree, ZyanUSize* size)
+{
+    if (!tree || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = tree->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -25,6 +25,18 @@
 ***************************************************************************************************/
 
 #include <Zycore/Bitset.h>
+#include <Zycore/CPU.h>
+#include <Zycore/LibC.h>
+
+// The vectorized kernels need the intrinsics headers, which pull in parts of the C library
+#if (defined(ZYAN_X86) || defined(ZYAN_X64)) && (defined(ZYAN_GNUC) || defined(ZYAN_MSVC)) && \
+    !defined(ZYCORE_NO_LIBC)
+#   define ZYAN_BITSET_X86_KERNELS
+#   include <immintrin.h>
+#   if defined(ZYAN_MSVC)
+#       include <intrin.h>
+#   endif
+#endif
 
 /* ============================================================================================== */
 /* Internal constants                                                                             */
@@ -67,6 +79,42 @@
 #define ZYAN_BITSET_BIT_OFFSET(index) \
     (7 - ((index) % 8))
 
+/**
+ * @brief   Compiles the following function for the given instruction set extensions.
+ *
+ * @param   features    A comma separated list of instruction set extensions.
+ *
+ * MSVC allows the use of all intrinsics without any special function attributes.
+ */
+#if defined(ZYAN_GNUC)
+#   define ZYAN_BITSET_TARGET(features) __attribute__((target(features)))
+#else
+#   define ZYAN_BITSET_TARGET(features)
+#endif
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanBitsetKernels` struct.
+ *
+ * One instance exists for every supported instruction set; `ZyanCPUDispatch` selects the best
+ * one on the first call.
+ */
+typedef struct ZyanBitsetKernels_
+{
+    /**
+     * @brief   Counts the set bits in the given buffer.
+     *
+     * @param   data    A pointer to the buffer.
+     * @param   size    The size of the buffer in bytes.
+     *
+     * @return  The number of set bits.
+     */
+    ZyanUSize (*popcount)(const ZyanU8* data, ZyanUSize size);
+} ZyanBitsetKernels;
+
 /* ============================================================================================== */
 /* Internal functions                                                                             */
 /* ============================================================================================== */
@@ -87,10 +135,10 @@ static ZyanStatus ZyanBitsetInitVectorElements(ZyanVector* vector, ZyanUSize cou
 {
     ZYAN_ASSERT(vector);
 
-    static const ZyanU8 zero = 0;
-    for (ZyanUSize i = 0; i < count; ++i)
+    ZYAN_CHECK(ZyanVectorResize(vector, count));
+    if (count)
     {
-        ZYAN_CHECK(ZyanVectorPush(vector, &zero));
+        ZYAN_MEMSET(vector->data, 0, count);
     }
 
     return ZYAN_STATUS_SUCCESS;
@@ -118,6 +166,181 @@ static ZyanStatus ZyanBitsetOperationXOR(ZyanU8* b1, const ZyanU8* b2)
     return ZYAN_STATUS_SUCCESS;
 }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Population count kernels                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Counts the set bits in the given buffer without using any instruction set extensions.
+ *
+ * @param   data    A pointer to the buffer.
+ * @param   size    The size of the buffer in bytes.
+ *
+ * @return  The number of set bits.
+ */
+static ZyanUSize ZyanBitsetPopcountGeneric(const ZyanU8* data, ZyanUSize size)
+{
+    ZyanUSize count = 0;
+    ZyanUSize i = 0;
+    for (; i + sizeof(ZyanU64) <= size; i += sizeof(ZyanU64))
+    {
+        ZyanU64 value;
+        ZYAN_MEMCPY(&value, data + i, sizeof(value));
+        value = value - ((value >> 1) & 0x5555555555555555ULL);
+        value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+        value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        count += (ZyanUSize)((value * 0x0101010101010101ULL) >> 56);
+    }
+    for (; i < size; ++i)
+    {
+        ZyanU8 value = data[i];
+        value = (value & 0x55) + ((value >> 1) & 0x55);
+        value = (value & 0x33) + ((value >> 2) & 0x33);
+        value = (value & 0x0F) + ((value >> 4) & 0x0F);
+        count += value;
+    }
+
+    return count;
+}
+
+#ifdef ZYAN_BITSET_X86_KERNELS
+
+/**
+ * @brief   Counts the set bits in the given buffer using the `POPCNT` instruction.
+ *
+ * @param   data    A pointer to the buffer.
+ * @param   size    The size of the buffer in bytes.
+ *
+ * @return  The number of set bits.
+ */
+ZYAN_BITSET_TARGET("popcnt")
+static ZyanUSize ZyanBitsetPopcountPOPCNT(const ZyanU8* data, ZyanUSize size)
+{
+    ZyanUSize count = 0;
+    ZyanUSize i = 0;
+    for (; i + sizeof(ZyanU64) <= size; i += sizeof(ZyanU64))
+    {
+        ZyanU64 value;
+        ZYAN_MEMCPY(&value, data + i, sizeof(value));
+#if defined(ZYAN_GNUC)
+        count += (ZyanUSize)__builtin_popcountll(value);
+#elif defined(ZYAN_X64)
+        count += (ZyanUSize)__popcnt64(value);
+#else
+        count += (ZyanUSize)__popcnt((ZyanU32)value) + (ZyanUSize)__popcnt((ZyanU32)(value >> 32));
+#endif
+    }
+
+    return count + ZyanBitsetPopcountGeneric(data + i, size - i);
+}
+
+/**
+ * @brief   Counts the set bits in the given buffer using AVX2.
+ *
+ * @param   data    A pointer to the buffer.
+ * @param   size    The size of the buffer in bytes.
+ *
+ * @return  The number of set bits.
+ *
+ * Looks up the bit count of every nibble in a 16 entry table (`VPSHUFB`) and sums the bytes of
+ * every 64-bit lane (`VPSADBW`).
+ */
+ZYAN_BITSET_TARGET("avx2")
+static ZyanUSize ZyanBitsetPopcountAVX2(const ZyanU8* data, ZyanUSize size)
+{
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i zero = _mm256_setzero_si256();
+
+    __m256i accumulator = zero;
+    ZyanUSize i = 0;
+    for (; i + sizeof(__m256i) <= size; i += sizeof(__m256i))
+    {
+        const __m256i value = _mm256_loadu_si256((const __m256i*)(data + i));
+        const __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(value, mask));
+        const __m256i hi =
+            _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(value, 4), mask));
+        accumulator =
+            _mm256_add_epi64(accumulator, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), zero));
+    }
+
+    ZyanU64 lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, accumulator);
+    const ZyanUSize count = (ZyanUSize)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+
+    return count + ZyanBitsetPopcountGeneric(data + i, size - i);
+}
+
+/**
+ * @brief   Counts the set bits in the given buffer using `VPOPCNTQ` (AVX-512).
+ *
+ * @param   data    A pointer to the buffer.
+ * @param   size    The size of the buffer in bytes.
+ *
+ * @return  The number of set bits.
+ */
+ZYAN_BITSET_TARGET("avx512f,avx512vpopcntdq")
+static ZyanUSize ZyanBitsetPopcountAVX512(const ZyanU8* data, ZyanUSize size)
+{
+    __m512i accumulator = _mm512_setzero_si512();
+    ZyanUSize i = 0;
+    for (; i + sizeof(__m512i) <= size; i += sizeof(__m512i))
+    {
+        const __m512i value = _mm512_loadu_si512((const void*)(data + i));
+        accumulator = _mm512_add_epi64(accumulator, _mm512_popcnt_epi64(value));
+    }
+    const ZyanUSize count = (ZyanUSize)_mm512_reduce_add_epi64(accumulator);
+
+    return count + ZyanBitsetPopcountGeneric(data + i, size - i);
+}
+
+#endif
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Dispatching                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifdef ZYAN_BITSET_X86_KERNELS
+
+static const ZyanBitsetKernels ZYAN_BITSET_KERNELS_AVX512 = { &ZyanBitsetPopcountAVX512 };
+static const ZyanBitsetKernels ZYAN_BITSET_KERNELS_AVX2   = { &ZyanBitsetPopcountAVX2   };
+static const ZyanBitsetKernels ZYAN_BITSET_KERNELS_POPCNT = { &ZyanBitsetPopcountPOPCNT };
+
+#endif
+
+static const ZyanBitsetKernels ZYAN_BITSET_KERNELS_GENERIC = { &ZyanBitsetPopcountGeneric };
+
+/**
+ * @brief   The kernel tables, ordered from the most to the least specialized one.
+ */
+static const ZyanCPUDispatchEntry ZYAN_BITSET_KERNELS[] =
+{
+#ifdef ZYAN_BITSET_X86_KERNELS
+    { ZYAN_CPU_FEATURE_AVX512F | ZYAN_CPU_FEATURE_AVX512VPOPCNTDQ, &ZYAN_BITSET_KERNELS_AVX512  },
+    { ZYAN_CPU_FEATURE_AVX2,                                       &ZYAN_BITSET_KERNELS_AVX2    },
+    { ZYAN_CPU_FEATURE_POPCNT,                                     &ZYAN_BITSET_KERNELS_POPCNT  },
+#endif
+    { 0,                                                           &ZYAN_BITSET_KERNELS_GENERIC }
+};
+
+/**
+ * @brief   Caches the selected kernel table.
+ */
+static ZyanAtomicPointer zyan_bitset_kernels = ZYAN_ATOMIC_INIT(ZYAN_NULL);
+
+/**
+ * @brief   Returns the best kernel table for the current CPU.
+ *
+ * @return  A pointer to the kernel table.
+ */
+static const ZyanBitsetKernels* ZyanBitsetGetKernels(void)
+{
+    return (const ZyanBitsetKernels*)ZyanCPUDispatch(&zyan_bitset_kernels, ZYAN_BITSET_KERNELS,
+        ZYAN_ARRAY_LENGTH(ZYAN_BITSET_KERNELS));
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -257,11 +480,11 @@ ZyanStatus ZyanBitsetFlip(ZyanBitset* bitset)
 
 ZyanStatus ZyanBitsetSet(ZyanBitset* bitset, ZyanUSize index)
 {
-    if (!bitset)
+    if (ZYAN_UNLIKELY(!bitset))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index >= bitset->size)
+    if (ZYAN_UNLIKELY(index >= bitset->size))
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
@@ -275,11 +498,11 @@ ZyanStatus ZyanBitsetSet(ZyanBitset* bitset, ZyanUSize index)
 
 ZyanStatus ZyanBitsetReset(ZyanBitset* bitset, ZyanUSize index)
 {
-    if (!bitset)
+    if (ZYAN_UNLIKELY(!bitset))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index >= bitset->size)
+    if (ZYAN_UNLIKELY(index >= bitset->size))
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
@@ -302,11 +525,11 @@ ZyanStatus ZyanBitsetAssign(ZyanBitset* bitset, ZyanUSize index, ZyanBool value)
 
 ZyanStatus ZyanBitsetToggle(ZyanBitset* bitset, ZyanUSize index)
 {
-    if (!bitset)
+    if (ZYAN_UNLIKELY(!bitset))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index >= bitset->size)
+    if (ZYAN_UNLIKELY(index >= bitset->size))
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
@@ -320,11 +543,11 @@ ZyanStatus ZyanBitsetToggle(ZyanBitset* bitset, ZyanUSize index)
 
 ZyanStatus ZyanBitsetTest(ZyanBitset* bitset, ZyanUSize index)
 {
-    if (!bitset)
+    if (ZYAN_UNLIKELY(!bitset))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index >= bitset->size)
+    if (ZYAN_UNLIKELY(index >= bitset->size))
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
@@ -528,24 +751,7 @@ ZyanStatus ZyanBitsetCount(const ZyanBitset* bitset, ZyanUSize* count)
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    *count = 0;
-
-    ZyanUSize size;
-    ZYAN_CHECK(ZyanVectorSize(&bitset->bits, &size));
-    for (ZyanUSize i = 0; i < size; ++i)
-    {
-        ZyanU8* value;
-        ZYAN_CHECK(ZyanVectorGetConst(&bitset->bits, i, (const void**)&value));
-
-        ZyanU8 popcnt = *value;
-        popcnt = (popcnt & 0x55) + ((popcnt >> 1) & 0x55);
-        popcnt = (popcnt & 0x33) + ((popcnt >> 2) & 0x33);
-        popcnt = (popcnt & 0x0F) + ((popcnt >> 4) & 0x0F);
-
-        *count += popcnt;
-    }
-
-    *count = ZYAN_MIN(*count, bitset->size);
+    *count = ZyanBitsetCountUnchecked(bitset);
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -646,6 +852,20 @@ ZyanStatus ZyanBitsetNone(const ZyanBitset* bitset)
     return ZYAN_STATUS_TRUE;
 }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Unchecked access                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanUSize ZyanBitsetCountUnchecked(const ZyanBitset* bitset)
+{
+    ZYAN_ASSERT(bitset);
+
+    const ZyanUSize count = ZyanBitsetGetKernels()->popcount((const ZyanU8*)bitset->bits.data,
+        bitset->bits.size);
+
+    return ZYAN_MIN(count, bitset->size);
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
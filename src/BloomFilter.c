@@ -0,0 +1,532 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/BloomFilter.h>
+#include <Zycore/Hash.h>
+#include <Zycore/Internal/Hash.h>
+#include <Zycore/Internal/Math.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The size of a single block in bytes. Matches the cache line size of common CPUs.
+ */
+#define ZYAN_BLOOM_FILTER_BLOCK_SIZE 64
+
+/**
+ * @brief   The number of bits in a single block.
+ */
+#define ZYAN_BLOOM_FILTER_BLOCK_BITS (ZYAN_BLOOM_FILTER_BLOCK_SIZE * 8)
+
+/**
+ * @brief   The maximum number of blocks.
+ *
+ * `ZyanBitset` calculates its byte count using single precision floating point math, which stays
+ * exact below this limit.
+ */
+#define ZYAN_BLOOM_FILTER_MAX_BLOCKS 0x00800000
+
+/**
+ * @brief   The maximum number of probes per element.
+ */
+#define ZYAN_BLOOM_FILTER_MAX_HASH_COUNT 32
+
+/**
+ * @brief   The number of elements that are hashed ahead by the batched functions.
+ */
+#define ZYAN_BLOOM_FILTER_BATCH_SIZE 16
+
+/**
+ * @brief   The natural logarithm of `2`.
+ */
+#define ZYAN_BLOOM_FILTER_LN2 0.69314718055994530942
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Probing                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the block that belongs to the given hash in a blocked filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   hash    The hash of the element.
+ *
+ * @return  A pointer to the first byte of the block.
+ *
+ * The upper half of the hash selects the block using a multiply-shift range reduction.
+ */
+static ZyanU8* ZyanBloomFilterGetBlock(const ZyanBloomFilter* filter, ZyanU64 hash)
+{
+    const ZyanU64 index = ((hash >> 32) * (ZyanU64)filter->block_count) >> 32;
+
+    return (ZyanU8*)filter->bits.bits.data + (ZyanUSize)index * ZYAN_BLOOM_FILTER_BLOCK_SIZE;
+}
+
+/**
+ * @brief   Sets or tests the bits that belong to the given hash in a standard filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   hash    The hash of the element.
+ * @param   insert  `ZYAN_TRUE` to set the bits or `ZYAN_FALSE` to test them.
+ *
+ * @return  `ZYAN_TRUE`, if all bits were set before the call or `ZYAN_FALSE`, if not.
+ *
+ * The probe positions are generated by double hashing. The step is never zero and always smaller
+ * than the number of bits, so a single conditional subtraction keeps the position in range.
+ */
+static ZyanBool ZyanBloomFilterProbeStandard(const ZyanBloomFilter* filter, ZyanU64 hash,
+    ZyanBool insert)
+{
+    ZYAN_ASSERT(filter);
+
+    ZyanU8* const data = (ZyanU8*)filter->bits.bits.data;
+    const ZyanUSize m = filter->bits.size;
+
+    ZyanUSize position = (ZyanUSize)(hash % m);
+    const ZyanUSize step = (ZyanUSize)(ZyanHashU64(hash) % (m - 1)) + 1;
+
+    ZyanBool result = ZYAN_TRUE;
+    for (ZyanU32 i = 0; i < filter->hash_count; ++i)
+    {
+        const ZyanU8 mask = (ZyanU8)(0x80 >> (position & 7));
+        ZyanU8* const byte = &data[position >> 3];
+        if (!(*byte & mask))
+        {
+            if (!insert)
+            {
+                return ZYAN_FALSE;
+            }
+            result = ZYAN_FALSE;
+            *byte |= mask;
+        }
+
+        position += step;
+        if (position >= m)
+        {
+            position -= m;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief   Sets or tests the bits that belong to the given hash in a blocked filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   hash    The hash of the element.
+ * @param   insert  `ZYAN_TRUE` to set the bits or `ZYAN_FALSE` to test them.
+ *
+ * @return  `ZYAN_TRUE`, if all bits were set before the call or `ZYAN_FALSE`, if not.
+ *
+ * The probe positions inside the block are generated by double hashing with an odd step, which
+ * yields distinct positions for all probes.
+ */
+static ZyanBool ZyanBloomFilterProbeBlocked(const ZyanBloomFilter* filter, ZyanU64 hash,
+    ZyanBool insert)
+{
+    ZYAN_ASSERT(filter);
+
+    ZyanU8* const block = ZyanBloomFilterGetBlock(filter, hash);
+
+    const ZyanU64 mixed = ZyanHashU64(hash);
+    ZyanU32 position = (ZyanU32)mixed;
+    const ZyanU32 step = (ZyanU32)(mixed >> 32) | 1;
+
+    ZyanBool result = ZYAN_TRUE;
+    for (ZyanU32 i = 0; i < filter->hash_count; ++i)
+    {
+        const ZyanU32 bit = position & (ZYAN_BLOOM_FILTER_BLOCK_BITS - 1);
+        const ZyanU8 mask = (ZyanU8)(0x80 >> (bit & 7));
+        ZyanU8* const byte = &block[bit >> 3];
+        if (!(*byte & mask))
+        {
+            if (!insert)
+            {
+                return ZYAN_FALSE;
+            }
+            result = ZYAN_FALSE;
+            *byte |= mask;
+        }
+
+        position += step;
+    }
+
+    return result;
+}
+
+/**
+ * @brief   Sets or tests the bits that belong to the given hash.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   hash    The hash of the element.
+ * @param   insert  `ZYAN_TRUE` to set the bits or `ZYAN_FALSE` to test them.
+ *
+ * @return  `ZYAN_TRUE`, if all bits were set before the call or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanBloomFilterProbe(const ZyanBloomFilter* filter, ZyanU64 hash,
+    ZyanBool insert)
+{
+    ZYAN_ASSERT(filter);
+
+    switch (filter->type)
+    {
+    case ZYAN_BLOOM_FILTER_TYPE_STANDARD:
+        return ZyanBloomFilterProbeStandard(filter, hash, insert);
+    case ZYAN_BLOOM_FILTER_TYPE_BLOCKED:
+        return ZyanBloomFilterProbeBlocked(filter, hash, insert);
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * @brief   Prefetches the memory the probes of the given hash are going to access.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   hash    The hash of the element.
+ * @param   insert  `ZYAN_TRUE` to prefetch for writing or `ZYAN_FALSE` to prefetch for reading.
+ *
+ * The batched functions prefetch all blocks of a batch before probing the first one, so the cache
+ * misses of the batch overlap. Standard filters access `k` unrelated cache lines per element and
+ * are not prefetched.
+ */
+static void ZyanBloomFilterPrefetch(const ZyanBloomFilter* filter, ZyanU64 hash, ZyanBool insert)
+{
+    ZYAN_ASSERT(filter);
+
+    if (filter->type != ZYAN_BLOOM_FILTER_TYPE_BLOCKED)
+    {
+        return;
+    }
+
+    const ZyanU8* const block = ZyanBloomFilterGetBlock(filter, hash);
+    if (insert)
+    {
+        ZYAN_PREFETCH_WRITE(block);
+    } else
+    {
+        ZYAN_PREFETCH(block);
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBloomFilterInit(ZyanBloomFilter* filter, ZyanBloomFilterType type,
+    ZyanUSize expected_count, float false_positive_rate)
+{
+    if (!filter || !(false_positive_rate > 0.0f) || !(false_positive_rate < 1.0f))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // m = -n * ln(p) / ln(2)^2 and k = m / n * ln(2) = -ln(p) / ln(2)
+    const double n = expected_count ? (double)expected_count : 1.0;
+    const double log_p = ZyanMathLog(false_positive_rate);
+    const double m = -n * log_p / (ZYAN_BLOOM_FILTER_LN2 * ZYAN_BLOOM_FILTER_LN2);
+    if (m > (double)ZYAN_BLOOM_FILTER_MAX_BLOCKS * ZYAN_BLOOM_FILTER_BLOCK_BITS)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU32 k = (ZyanU32)(-log_p / ZYAN_BLOOM_FILTER_LN2 + 0.5);
+    k = ZYAN_MAX(k, 1);
+    k = ZYAN_MIN(k, ZYAN_BLOOM_FILTER_MAX_HASH_COUNT);
+
+    return ZyanBloomFilterInitEx(filter, type, (ZyanUSize)m + 1, k, ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanBloomFilterInitEx(ZyanBloomFilter* filter, ZyanBloomFilterType type,
+    ZyanUSize bit_count, ZyanU32 hash_count, ZyanAllocator* allocator)
+{
+    if (!filter || ((ZyanUSize)type > ZYAN_BLOOM_FILTER_TYPE_MAX_VALUE) || !bit_count ||
+        !hash_count || (hash_count > ZYAN_BLOOM_FILTER_MAX_HASH_COUNT) || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize block_count = bit_count / ZYAN_BLOOM_FILTER_BLOCK_BITS +
+        ((bit_count % ZYAN_BLOOM_FILTER_BLOCK_BITS) ? 1 : 0);
+    if ((block_count > ZYAN_BLOOM_FILTER_MAX_BLOCKS) ||
+        (block_count > (ZyanUSize)-1 / ZYAN_BLOOM_FILTER_BLOCK_BITS))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Over-allocate by one block to be able to align the storage to the block size
+    const ZyanUSize size = block_count * ZYAN_BLOOM_FILTER_BLOCK_SIZE;
+    void* buffer;
+    ZYAN_CHECK(allocator->allocate(allocator, &buffer, sizeof(ZyanU8),
+        size + ZYAN_BLOOM_FILTER_BLOCK_SIZE - 1));
+
+    void* const data = (void*)(((ZyanUPointer)buffer + ZYAN_BLOOM_FILTER_BLOCK_SIZE - 1) &
+        ~(ZyanUPointer)(ZYAN_BLOOM_FILTER_BLOCK_SIZE - 1));
+    const ZyanStatus status = ZyanBitsetInitBuffer(&filter->bits,
+        block_count * ZYAN_BLOOM_FILTER_BLOCK_BITS, data, size);
+    if (!ZYAN_SUCCESS(status))
+    {
+        allocator->deallocate(allocator, buffer, sizeof(ZyanU8),
+            size + ZYAN_BLOOM_FILTER_BLOCK_SIZE - 1);
+        return status;
+    }
+
+    filter->allocator   = allocator;
+    filter->type        = type;
+    filter->hash_count  = hash_count;
+    filter->block_count = block_count;
+    filter->buffer      = buffer;
+    filter->buffer_size = size + ZYAN_BLOOM_FILTER_BLOCK_SIZE - 1;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBloomFilterDestroy(ZyanBloomFilter* filter)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanBitsetDestroy(&filter->bits));
+    ZYAN_CHECK(filter->allocator->deallocate(filter->allocator, filter->buffer, sizeof(ZyanU8),
+        filter->buffer_size));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBloomFilterInsert(ZyanBloomFilter* filter, const void* element, ZyanUSize size)
+{
+    if (!filter || (!element && size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBloomFilterProbe(filter, ZyanHashBytesValue(element, size), ZYAN_TRUE);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBloomFilterInsertHash(ZyanBloomFilter* filter, ZyanU64 hash)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBloomFilterProbe(filter, hash, ZYAN_TRUE);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBloomFilterInsertElements(ZyanBloomFilter* filter, const void* elements,
+    ZyanUSize element_size, ZyanUSize count)
+{
+    if (!filter || (!elements && count && element_size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* element = (const ZyanU8*)elements;
+    ZyanU64 hashes[ZYAN_BLOOM_FILTER_BATCH_SIZE];
+    while (count)
+    {
+        const ZyanUSize n = ZYAN_MIN(count, ZYAN_BLOOM_FILTER_BATCH_SIZE);
+        for (ZyanUSize i = 0; i < n; ++i)
+        {
+            hashes[i] = ZyanHashBytesValue(element, element_size);
+            ZyanBloomFilterPrefetch(filter, hashes[i], ZYAN_TRUE);
+            element += element_size;
+        }
+        for (ZyanUSize i = 0; i < n; ++i)
+        {
+            ZyanBloomFilterProbe(filter, hashes[i], ZYAN_TRUE);
+        }
+        count -= n;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBloomFilterContains(const ZyanBloomFilter* filter, const void* element,
+    ZyanUSize size)
+{
+    if (!filter || (!element && size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanBloomFilterProbe(filter, ZyanHashBytesValue(element, size), ZYAN_FALSE)
+        ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanBloomFilterContainsHash(const ZyanBloomFilter* filter, ZyanU64 hash)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanBloomFilterProbe(filter, hash, ZYAN_FALSE) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanBloomFilterContainsElements(const ZyanBloomFilter* filter, const void* elements,
+    ZyanUSize element_size, ZyanUSize count, ZyanBool* results)
+{
+    if (!filter || (count && ((!elements && element_size) || !results)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* element = (const ZyanU8*)elements;
+    ZyanU64 hashes[ZYAN_BLOOM_FILTER_BATCH_SIZE];
+    while (count)
+    {
+        const ZyanUSize n = ZYAN_MIN(count, ZYAN_BLOOM_FILTER_BATCH_SIZE);
+        for (ZyanUSize i = 0; i < n; ++i)
+        {
+            hashes[i] = ZyanHashBytesValue(element, element_size);
+            ZyanBloomFilterPrefetch(filter, hashes[i], ZYAN_FALSE);
+            element += element_size;
+        }
+        for (ZyanUSize i = 0; i < n; ++i)
+        {
+            *results++ = ZyanBloomFilterProbe(filter, hashes[i], ZYAN_FALSE);
+        }
+        count -= n;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Set operations                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBloomFilterUnion(ZyanBloomFilter* destination, const ZyanBloomFilter* source)
+{
+    if (!destination || !source)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if ((destination->type != source->type) || (destination->bits.size != source->bits.size) ||
+        (destination->hash_count != source->hash_count))
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    return ZyanBitsetOR(&destination->bits, &source->bits);
+}
+
+ZyanStatus ZyanBloomFilterClear(ZyanBloomFilter* filter)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanBitsetResetAll(&filter->bits);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBloomFilterEstimateCount(const ZyanBloomFilter* filter, ZyanUSize* count)
+{
+    if (!filter || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize set;
+    ZYAN_CHECK(ZyanBitsetCount(&filter->bits, &set));
+    if (!set)
+    {
+        *count = 0;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // n = -(m / k) * ln(1 - X / m), with the number of set bits `X` clamped to keep the logarithm
+    // finite
+    const ZyanUSize m = filter->bits.size;
+    set = ZYAN_MIN(set, m - 1);
+    const double estimate = -((double)m / filter->hash_count) *
+        ZyanMathLog((double)(m - set) / (double)m);
+    *count = (ZyanUSize)(estimate + 0.5);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBloomFilterSize(const ZyanBloomFilter* filter, ZyanUSize* size)
+{
+    if (!filter || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = filter->bits.size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBloomFilterHashCount(const ZyanBloomFilter* filter, ZyanU32* hash_count)
+{
+    if (!filter || !hash_count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *hash_count = filter->hash_count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
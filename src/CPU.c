@@ -0,0 +1,336 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/CPU.h>
+
+#if defined(ZYAN_X86) || defined(ZYAN_X64)
+#   if defined(ZYAN_MSVC)
+#       include <intrin.h>
+#   elif defined(ZYAN_GNUC)
+#       include <cpuid.h>
+#   endif
+#elif defined(ZYAN_AARCH64) && defined(ZYAN_LINUX) && !defined(ZYCORE_NO_LIBC)
+#   include <sys/auxv.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   Marks the cached feature set as valid.
+ *
+ * This bit is never used by any `ZYAN_CPU_FEATURE_*` flag.
+ */
+#define ZYAN_CPU_FEATURES_DETECTED  (1ULL << 63)
+
+/* ============================================================================================== */
+/* Internal variables                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The cached feature set.
+ */
+static ZyanAtomic64 zyan_cpu_features = ZYAN_ATOMIC_INIT(0);
+
+/**
+ * @brief   The features hidden by `ZyanCPUDisableFeatures`.
+ */
+static ZyanAtomic64 zyan_cpu_disabled_features = ZYAN_ATOMIC_INIT(0);
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+#if (defined(ZYAN_X86) || defined(ZYAN_X64)) && (defined(ZYAN_MSVC) || defined(ZYAN_GNUC))
+
+/**
+ * @brief   Executes the `CPUID` instruction.
+ *
+ * @param   leaf    The leaf.
+ * @param   subleaf The subleaf.
+ * @param   regs    Receives the values of `EAX`, `EBX`, `ECX` and `EDX`.
+ */
+static void ZyanCPUCpuid(ZyanU32 leaf, ZyanU32 subleaf, ZyanU32 regs[4])
+{
+#if defined(ZYAN_MSVC)
+    int values[4];
+    __cpuidex(values, (int)leaf, (int)subleaf);
+    for (int i = 0; i < 4; ++i)
+    {
+        regs[i] = (ZyanU32)values[i];
+    }
+#else
+    unsigned int a, b, c, d;
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    regs[0] = a;
+    regs[1] = b;
+    regs[2] = c;
+    regs[3] = d;
+#endif
+}
+
+/**
+ * @brief   Reads the `XCR0` register, which describes the register states saved by the operating
+ *          system.
+ *
+ * @return  The value of the `XCR0` register.
+ */
+static ZyanU64 ZyanCPUReadXCR0(void)
+{
+#if defined(ZYAN_MSVC)
+    return _xgetbv(0);
+#else
+    ZyanU32 eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((ZyanU64)edx << 32) | eax;
+#endif
+}
+
+/**
+ * @brief   Defines the `ZyanCPUFeatureBit` struct that maps a `CPUID` bit to a feature flag.
+ */
+typedef struct ZyanCPUFeatureBit_
+{
+    /**
+     * @brief   The register index (`0` = `EAX`, `1` = `EBX`, `2` = `ECX`, `3` = `EDX`).
+     */
+    ZyanU8 reg;
+    /**
+     * @brief   The bit index.
+     */
+    ZyanU8 bit;
+    /**
+     * @brief   The feature flag.
+     */
+    ZyanCPUFeatures feature;
+} ZyanCPUFeatureBit;
+
+/**
+ * @brief   `CPUID` leaf `1` features that do not depend on the operating system.
+ */
+static const ZyanCPUFeatureBit ZYAN_CPU_LEAF1_BITS[] =
+{
+    { 3, 26, ZYAN_CPU_FEATURE_SSE2   },
+    { 2,  0, ZYAN_CPU_FEATURE_SSE3   },
+    { 2,  9, ZYAN_CPU_FEATURE_SSSE3  },
+    { 2, 19, ZYAN_CPU_FEATURE_SSE41  },
+    { 2, 20, ZYAN_CPU_FEATURE_SSE42  },
+    { 2, 23, ZYAN_CPU_FEATURE_POPCNT }
+};
+
+/**
+ * @brief   `CPUID` leaf `1` features that require the operating system to save the AVX state.
+ */
+static const ZyanCPUFeatureBit ZYAN_CPU_LEAF1_AVX_BITS[] =
+{
+    { 2, 28, ZYAN_CPU_FEATURE_AVX    },
+    { 2, 12, ZYAN_CPU_FEATURE_FMA    }
+};
+
+/**
+ * @brief   `CPUID` leaf `7` features that do not depend on the operating system.
+ */
+static const ZyanCPUFeatureBit ZYAN_CPU_LEAF7_BITS[] =
+{
+    { 1,  3, ZYAN_CPU_FEATURE_BMI1   },
+    { 1,  8, ZYAN_CPU_FEATURE_BMI2   }
+};
+
+/**
+ * @brief   `CPUID` leaf `7` features that require the operating system to save the AVX state.
+ */
+static const ZyanCPUFeatureBit ZYAN_CPU_LEAF7_AVX_BITS[] =
+{
+    { 1,  5, ZYAN_CPU_FEATURE_AVX2   }
+};
+
+/**
+ * @brief   `CPUID` leaf `7` features that require the operating system to save the AVX-512 state.
+ */
+static const ZyanCPUFeatureBit ZYAN_CPU_LEAF7_AVX512_BITS[] =
+{
+    { 1, 16, ZYAN_CPU_FEATURE_AVX512F         },
+    { 1, 30, ZYAN_CPU_FEATURE_AVX512BW        },
+    { 1, 31, ZYAN_CPU_FEATURE_AVX512VL        },
+    { 2, 14, ZYAN_CPU_FEATURE_AVX512VPOPCNTDQ }
+};
+
+/**
+ * @brief   Returns the features whose bits are set in the given `CPUID` result.
+ *
+ * @param   regs    The values of `EAX`, `EBX`, `ECX` and `EDX`.
+ * @param   bits    The feature bits to test.
+ * @param   count   The number of feature bits.
+ *
+ * @return  A combination of `ZYAN_CPU_FEATURE_*` flags.
+ */
+static ZyanCPUFeatures ZyanCPUTestBits(const ZyanU32 regs[4], const ZyanCPUFeatureBit* bits,
+    ZyanUSize count)
+{
+    ZyanCPUFeatures features = 0;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        if (regs[bits[i].reg] & (1u << bits[i].bit))
+        {
+            features |= bits[i].feature;
+        }
+    }
+    return features;
+}
+
+/**
+ * @brief   Detects the features of the current x86 CPU.
+ *
+ * @return  A combination of `ZYAN_CPU_FEATURE_*` flags.
+ */
+static ZyanCPUFeatures ZyanCPUDetect(void)
+{
+    ZyanU32 regs[4];
+    ZyanCPUCpuid(0, 0, regs);
+    const ZyanU32 max_leaf = regs[0];
+    if (max_leaf < 1)
+    {
+        return 0;
+    }
+
+    ZyanCPUCpuid(1, 0, regs);
+    ZyanCPUFeatures features =
+        ZyanCPUTestBits(regs, ZYAN_CPU_LEAF1_BITS, ZYAN_ARRAY_LENGTH(ZYAN_CPU_LEAF1_BITS));
+
+    // The AVX register states are only usable, if the operating system saves them on context
+    // switches (`OSXSAVE`)
+    const ZyanU64 xcr0 = (regs[2] & (1u << 27)) ? ZyanCPUReadXCR0() : 0;
+    const ZyanBool os_avx    = (xcr0 & 0x06) == 0x06;
+    const ZyanBool os_avx512 = (xcr0 & 0xE6) == 0xE6;
+    if (os_avx)
+    {
+        features |= ZyanCPUTestBits(regs, ZYAN_CPU_LEAF1_AVX_BITS,
+            ZYAN_ARRAY_LENGTH(ZYAN_CPU_LEAF1_AVX_BITS));
+    }
+
+    if (max_leaf < 7)
+    {
+        return features;
+    }
+
+    ZyanCPUCpuid(7, 0, regs);
+    features |= ZyanCPUTestBits(regs, ZYAN_CPU_LEAF7_BITS, ZYAN_ARRAY_LENGTH(ZYAN_CPU_LEAF7_BITS));
+    if (os_avx)
+    {
+        features |= ZyanCPUTestBits(regs, ZYAN_CPU_LEAF7_AVX_BITS,
+            ZYAN_ARRAY_LENGTH(ZYAN_CPU_LEAF7_AVX_BITS));
+    }
+    if (os_avx512 && (regs[1] & (1u << 16)))
+    {
+        features |= ZyanCPUTestBits(regs, ZYAN_CPU_LEAF7_AVX512_BITS,
+            ZYAN_ARRAY_LENGTH(ZYAN_CPU_LEAF7_AVX512_BITS));
+    }
+
+    return features;
+}
+
+#elif defined(ZYAN_AARCH64)
+
+/**
+ * @brief   Detects the features of the current AArch64 CPU.
+ *
+ * @return  A combination of `ZYAN_CPU_FEATURE_*` flags.
+ */
+static ZyanCPUFeatures ZyanCPUDetect(void)
+{
+    // Advanced SIMD is part of the AArch64 baseline
+    ZyanCPUFeatures features = ZYAN_CPU_FEATURE_NEON;
+
+#if defined(ZYAN_LINUX) && !defined(ZYCORE_NO_LIBC)
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+    if (hwcap & (1ul << 7))
+    {
+        features |= ZYAN_CPU_FEATURE_CRC32;
+    }
+    if (hwcap & (1ul << 22))
+    {
+        features |= ZYAN_CPU_FEATURE_SVE;
+    }
+#elif defined(ZYAN_APPLE)
+    // All Apple Silicon CPUs implement ARMv8.4-A or newer
+    features |= ZYAN_CPU_FEATURE_CRC32;
+#endif
+
+    return features;
+}
+
+#else
+
+/**
+ * @brief   Detects the features of the current CPU.
+ *
+ * @return  `0`, as feature detection is not implemented for this architecture.
+ */
+static ZyanCPUFeatures ZyanCPUDetect(void)
+{
+    return 0;
+}
+
+#endif
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Feature detection                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanCPUFeatures ZyanCPUGetFeatures(void)
+{
+    ZyanU64 features = ZyanAtomicLoad64(&zyan_cpu_features, ZYAN_MEMORY_ORDER_RELAXED);
+    if (!(features & ZYAN_CPU_FEATURES_DETECTED))
+    {
+        // Racing threads detect the same features, so there is no need for synchronization
+        features = ZyanCPUDetect() | ZYAN_CPU_FEATURES_DETECTED;
+        ZyanAtomicStore64(&zyan_cpu_features, features, ZYAN_MEMORY_ORDER_RELAXED);
+    }
+
+    return features & ~ZYAN_CPU_FEATURES_DETECTED &
+        ~ZyanAtomicLoad64(&zyan_cpu_disabled_features, ZYAN_MEMORY_ORDER_RELAXED);
+}
+
+ZyanStatus ZyanCPUHasFeatures(ZyanCPUFeatures features)
+{
+    return ((ZyanCPUGetFeatures() & features) == features) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanCPUDisableFeatures(ZyanCPUFeatures features)
+{
+    ZyanAtomicFetchOr64(&zyan_cpu_disabled_features, features, ZYAN_MEMORY_ORDER_RELAXED);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
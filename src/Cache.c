@@ -0,0 +1,557 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Cache.h>
+#include <Zycore/LibC.h>
+#include <Zycore/Internal/Hash.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The maximum number of entries. Entry indices are stored as 32-bit values.
+ */
+#define ZYAN_CACHE_MAX_CAPACITY 0x7FFFFFFF
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanCacheEntry` struct.
+ *
+ * The key and the value are stored directly behind this struct.
+ */
+typedef struct ZyanCacheEntry_
+{
+    /**
+     * @brief   The link into the list of used or unused entries.
+     */
+    ZyanIntrusiveListNode link;
+    /**
+     * @brief   The hash of the key.
+     */
+    ZyanU64 hash;
+    /**
+     * @brief   Signals, if the entry is in use.
+     */
+    ZyanBool used;
+    /**
+     * @brief   The CLOCK reference bit.
+     */
+    ZyanBool referenced;
+} ZyanCacheEntry;
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Aligns the given `size` to a multiple of `8`.
+ *
+ * @param   size    The size.
+ *
+ * @return  The aligned size.
+ */
+#define ZYAN_CACHE_ALIGN(size) \
+    (((size) + 7) & ~(ZyanUSize)7)
+
+/**
+ * @brief   Returns a pointer to the entry at the given `index`.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   index   The entry index.
+ *
+ * @return  A pointer to the `ZyanCacheEntry` struct.
+ */
+#define ZYAN_CACHE_ENTRY(cache, index) \
+    ((ZyanCacheEntry*)((ZyanU8*)(cache)->entries.data + \
+        (index) * (cache)->entries.element_size))
+
+/**
+ * @brief   Returns the index of the given `entry`.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   entry   A pointer to the `ZyanCacheEntry` struct.
+ *
+ * @return  The entry index.
+ */
+#define ZYAN_CACHE_ENTRY_INDEX(cache, entry) \
+    ((ZyanUSize)((ZyanU8*)(entry) - (ZyanU8*)(cache)->entries.data) / \
+        (cache)->entries.element_size)
+
+/**
+ * @brief   Returns a pointer to the key of the given `entry`.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   entry   A pointer to the `ZyanCacheEntry` struct.
+ *
+ * @return  A pointer to the key.
+ */
+#define ZYAN_CACHE_ENTRY_KEY(cache, entry) \
+    ((void*)((ZyanU8*)(entry) + (cache)->key_offset))
+
+/**
+ * @brief   Returns a pointer to the value of the given `entry`.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   entry   A pointer to the `ZyanCacheEntry` struct.
+ *
+ * @return  A pointer to the value.
+ */
+#define ZYAN_CACHE_ENTRY_VALUE(cache, entry) \
+    ((void*)((ZyanU8*)(entry) + (cache)->value_offset))
+
+/**
+ * @brief   Returns a pointer to the hash table slots.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ *
+ * @return  A pointer to the first slot.
+ */
+#define ZYAN_CACHE_SLOTS(cache) \
+    ((ZyanU32*)(cache)->slots.data)
+
+/**
+ * @brief   Returns the mask that maps hash values to slot indices.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ *
+ * @return  The slot index mask.
+ */
+#define ZYAN_CACHE_SLOT_MASK(cache) \
+    ((cache)->slots.size - 1)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Searches the hash table slot that refers to the entry with the given `key`.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   key     A pointer to the key.
+ * @param   hash    The hash of the key.
+ * @param   slot    Receives the index of the slot that refers to the entry, if found, or the index
+ *                  of the first empty slot in the probe sequence, if not.
+ *
+ * @return  A pointer to the `ZyanCacheEntry` struct or `ZYAN_NULL`, if the key was not found.
+ */
+static ZyanCacheEntry* ZyanCacheFind(const ZyanCache* cache, const void* key, ZyanU64 hash,
+    ZyanUSize* slot)
+{
+    ZYAN_ASSERT(cache);
+    ZYAN_ASSERT(key);
+    ZYAN_ASSERT(slot);
+
+    const ZyanU32* const slots = ZYAN_CACHE_SLOTS(cache);
+    const ZyanUSize mask = ZYAN_CACHE_SLOT_MASK(cache);
+
+    // The table always contains at least `capacity` empty slots, so this loop terminates
+    for (ZyanUSize i = (ZyanUSize)hash & mask;; i = (i + 1) & mask)
+    {
+        if (!slots[i])
+        {
+            *slot = i;
+            return ZYAN_NULL;
+        }
+
+        ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, slots[i] - 1);
+        if ((entry->hash == hash) &&
+            !ZYAN_MEMCMP(ZYAN_CACHE_ENTRY_KEY(cache, entry), key, cache->key_size))
+        {
+            *slot = i;
+            return entry;
+        }
+    }
+}
+
+/**
+ * @brief   Clears the given hash table `slot` and restores the probe sequences of the following
+ *          slots.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   slot    The slot index.
+ */
+static void ZyanCacheClearSlot(ZyanCache* cache, ZyanUSize slot)
+{
+    ZYAN_ASSERT(cache);
+
+    ZyanU32* const slots = ZYAN_CACHE_SLOTS(cache);
+    const ZyanUSize mask = ZYAN_CACHE_SLOT_MASK(cache);
+
+    // Backward shift deletion avoids tombstones that would slowly degrade lookup performance
+    ZyanUSize i = slot;
+    for (ZyanUSize j = (i + 1) & mask; slots[j]; j = (j + 1) & mask)
+    {
+        const ZyanUSize k = (ZyanUSize)ZYAN_CACHE_ENTRY(cache, slots[j] - 1)->hash & mask;
+        if ((i <= j) ? ((k <= i) || (k > j)) : ((k <= i) && (k > j)))
+        {
+            slots[i] = slots[j];
+            i = j;
+        }
+    }
+    slots[i] = 0;
+}
+
+/**
+ * @brief   Marks the given `entry` as recently used.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   entry   A pointer to the `ZyanCacheEntry` struct.
+ */
+static void ZyanCacheTouch(ZyanCache* cache, ZyanCacheEntry* entry)
+{
+    ZYAN_ASSERT(cache);
+    ZYAN_ASSERT(entry);
+
+    switch (cache->policy)
+    {
+    case ZYAN_CACHE_POLICY_LRU:
+        ZyanIntrusiveListMoveToFront(&cache->used, &entry->link);
+        break;
+    case ZYAN_CACHE_POLICY_CLOCK:
+        entry->referenced = ZYAN_TRUE;
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * @brief   Releases the given `entry` and the hash table `slot` that refers to it.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   entry   A pointer to the `ZyanCacheEntry` struct.
+ * @param   slot    The index of the slot that refers to the entry.
+ */
+static void ZyanCacheRelease(ZyanCache* cache, ZyanCacheEntry* entry, ZyanUSize slot)
+{
+    ZYAN_ASSERT(cache);
+    ZYAN_ASSERT(entry);
+    ZYAN_ASSERT(entry->used);
+
+    ZyanCacheClearSlot(cache, slot);
+    if (cache->policy == ZYAN_CACHE_POLICY_LRU)
+    {
+        ZyanIntrusiveListRemove(&cache->used, &entry->link);
+    }
+    entry->used = ZYAN_FALSE;
+    ZyanIntrusiveListPushFront(&cache->unused, &entry->link);
+}
+
+/**
+ * @brief   Evicts a single entry according to the eviction policy.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanCacheEvict(ZyanCache* cache)
+{
+    ZYAN_ASSERT(cache);
+    ZYAN_ASSERT(ZyanIntrusiveListIsEmpty(&cache->unused));
+
+    ZyanCacheEntry* victim = ZYAN_NULL;
+    switch (cache->policy)
+    {
+    case ZYAN_CACHE_POLICY_LRU:
+        victim = ZYAN_INTRUSIVE_LIST_ENTRY(ZyanIntrusiveListTail(&cache->used), ZyanCacheEntry,
+            link);
+        break;
+    case ZYAN_CACHE_POLICY_CLOCK:
+        // All entries are in use at this point. The hand clears every set reference bit it passes,
+        // so this loop terminates after at most one full revolution
+        for (;;)
+        {
+            ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, cache->clock_hand);
+            cache->clock_hand = (cache->clock_hand + 1) % cache->capacity;
+            if (!entry->referenced)
+            {
+                victim = entry;
+                break;
+            }
+            entry->referenced = ZYAN_FALSE;
+        }
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    ZYAN_ASSERT(victim);
+
+    if (cache->callback)
+    {
+        ZYAN_CHECK(cache->callback(ZYAN_CACHE_ENTRY_KEY(cache, victim),
+            ZYAN_CACHE_ENTRY_VALUE(cache, victim), cache->user_data));
+    }
+
+    ZyanUSize slot;
+    ZYAN_UNUSED(ZyanCacheFind(cache, ZYAN_CACHE_ENTRY_KEY(cache, victim), victim->hash, &slot));
+    ZyanCacheRelease(cache, victim, slot);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCacheInit(ZyanCache* cache, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanUSize capacity, ZyanCachePolicy policy)
+{
+    return ZyanCacheInitEx(cache, key_size, value_size, capacity, policy, ZYAN_NULL, ZYAN_NULL,
+        ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanCacheInitEx(ZyanCache* cache, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanUSize capacity, ZyanCachePolicy policy, ZyanCacheEvictionCallback callback,
+    void* user_data, ZyanAllocator* allocator)
+{
+    if (!cache || !key_size || !capacity || (capacity > ZYAN_CACHE_MAX_CAPACITY) ||
+        ((ZyanUSize)policy > ZYAN_CACHE_POLICY_MAX_VALUE))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    cache->policy       = policy;
+    cache->key_size     = key_size;
+    cache->value_size   = value_size;
+    cache->key_offset   = ZYAN_CACHE_ALIGN(sizeof(ZyanCacheEntry));
+    cache->value_offset = cache->key_offset + ZYAN_CACHE_ALIGN(key_size);
+    cache->capacity     = capacity;
+    cache->clock_hand   = 0;
+    cache->callback     = callback;
+    cache->user_data    = user_data;
+
+    // Keep the load factor of the hash table at or below `0.5`
+    ZyanUSize slot_count = 2;
+    while (slot_count < capacity * 2)
+    {
+        slot_count <<= 1;
+    }
+
+    const ZyanUSize entry_size = cache->value_offset + ZYAN_CACHE_ALIGN(value_size);
+    ZYAN_CHECK(ZyanVectorInitEx(&cache->entries, entry_size, capacity, allocator, 1.0f, 0.0f));
+    ZyanStatus status = ZyanVectorResize(&cache->entries, capacity);
+    if (ZYAN_SUCCESS(status))
+    {
+        status = ZyanVectorInitEx(&cache->slots, sizeof(ZyanU32), slot_count, allocator, 1.0f,
+            0.0f);
+    }
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZYAN_CHECK(ZyanVectorDestroy(&cache->entries));
+        return status;
+    }
+    status = ZyanVectorResize(&cache->slots, slot_count);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZYAN_CHECK(ZyanVectorDestroy(&cache->slots));
+        ZYAN_CHECK(ZyanVectorDestroy(&cache->entries));
+        return status;
+    }
+
+    return ZyanCacheClear(cache);
+}
+
+ZyanStatus ZyanCacheDestroy(ZyanCache* cache)
+{
+    if (!cache)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanVectorDestroy(&cache->slots));
+    return ZyanVectorDestroy(&cache->entries);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCacheGet(ZyanCache* cache, const void* key, void** value)
+{
+    if (ZYAN_UNLIKELY(!cache || !key || !value))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize slot;
+    ZyanCacheEntry* const entry =
+        ZyanCacheFind(cache, key, ZyanHashBytesValue(key, cache->key_size), &slot);
+    if (!entry)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanCacheTouch(cache, entry);
+    *value = ZYAN_CACHE_ENTRY_VALUE(cache, entry);
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCachePut(ZyanCache* cache, const void* key, const void* value)
+{
+    if (ZYAN_UNLIKELY(!cache || !key || (!value && cache->value_size)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU64 hash = ZyanHashBytesValue(key, cache->key_size);
+
+    ZyanUSize slot;
+    ZyanCacheEntry* entry = ZyanCacheFind(cache, key, hash, &slot);
+    if (entry)
+    {
+        if (cache->value_size)
+        {
+            ZYAN_MEMCPY(ZYAN_CACHE_ENTRY_VALUE(cache, entry), value, cache->value_size);
+        }
+        ZyanCacheTouch(cache, entry);
+
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    if (ZyanIntrusiveListIsEmpty(&cache->unused))
+    {
+        ZYAN_CHECK(ZyanCacheEvict(cache));
+
+        // The eviction might have shifted slots of the probe sequence
+        ZYAN_UNUSED(ZyanCacheFind(cache, key, hash, &slot));
+    }
+
+    entry = ZYAN_INTRUSIVE_LIST_ENTRY(ZyanIntrusiveListPopFront(&cache->unused), ZyanCacheEntry,
+        link);
+    entry->hash       = hash;
+    entry->used       = ZYAN_TRUE;
+    entry->referenced = ZYAN_FALSE;
+    ZYAN_MEMCPY(ZYAN_CACHE_ENTRY_KEY(cache, entry), key, cache->key_size);
+    if (cache->value_size)
+    {
+        ZYAN_MEMCPY(ZYAN_CACHE_ENTRY_VALUE(cache, entry), value, cache->value_size);
+    }
+    if (cache->policy == ZYAN_CACHE_POLICY_LRU)
+    {
+        ZyanIntrusiveListPushFront(&cache->used, &entry->link);
+    }
+    ZYAN_CACHE_SLOTS(cache)[slot] = (ZyanU32)ZYAN_CACHE_ENTRY_INDEX(cache, entry) + 1;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCacheRemove(ZyanCache* cache, const void* key)
+{
+    if (ZYAN_UNLIKELY(!cache || !key))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize slot;
+    ZyanCacheEntry* const entry =
+        ZyanCacheFind(cache, key, ZyanHashBytesValue(key, cache->key_size), &slot);
+    if (!entry)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanCacheRelease(cache, entry, slot);
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanCacheClear(ZyanCache* cache)
+{
+    if (!cache)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanIntrusiveListInit(&cache->used);
+    ZyanIntrusiveListInit(&cache->unused);
+    for (ZyanUSize i = 0; i < cache->capacity; ++i)
+    {
+        ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, i);
+        entry->used       = ZYAN_FALSE;
+        entry->referenced = ZYAN_FALSE;
+        ZyanIntrusiveListPushBack(&cache->unused, &entry->link);
+    }
+    ZYAN_MEMSET(cache->slots.data, 0, cache->slots.size * sizeof(ZyanU32));
+    cache->clock_hand = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCacheSize(const ZyanCache* cache, ZyanUSize* size)
+{
+    if (!cache || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = cache->capacity - ZyanIntrusiveListSize(&cache->unused);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCacheCapacity(const ZyanCache* cache, ZyanUSize* capacity)
+{
+    if (!cache || !capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *capacity = cache->capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,369 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/ConcurrentVector.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+#define ZYAN_CONCURRENT_VECTOR_MIN_CAPACITY     16
+
+/**
+ * @brief   The number of bits of a `ZyanUSize` value.
+ */
+#define ZYAN_CONCURRENT_VECTOR_USIZE_BITS       (sizeof(ZyanUSize) * 8)
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the number of elements in the given segment.
+ *
+ * @param   vector  A pointer to the `ZyanConcurrentVector` instance.
+ * @param   segment The segment index.
+ *
+ * @return  The number of elements in the given segment.
+ */
+#define ZYAN_CONCURRENT_VECTOR_SEGMENT_CAPACITY(vector, segment) \
+    ((ZyanUSize)1 << ((vector)->first_segment_shift + (segment)))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the binary logarithm of the given value, rounded down.
+ *
+ * @param   value   The value. Must not be `0`.
+ *
+ * @return  The binary logarithm of the given value, rounded down.
+ */
+static ZyanU8 ZyanConcurrentVectorLog2(ZyanU64 value)
+{
+    ZYAN_ASSERT(value);
+
+#if defined(ZYAN_GNUC)
+    return (ZyanU8)(63 - __builtin_clzll(value));
+#else
+    ZyanU8 result = 0;
+    while (value >>= 1)
+    {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+/**
+ * @brief   Returns the pointer to the given segment and allocates it, if required.
+ *
+ * @param   vector  A pointer to the `ZyanConcurrentVector` instance.
+ * @param   segment The segment index.
+ * @param   data    Receives the pointer to the segment.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanConcurrentVectorAcquireSegment(ZyanConcurrentVector* vector,
+    ZyanU8 segment, void** data)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(segment < vector->segment_count);
+    ZYAN_ASSERT(data);
+
+    void* current =
+        ZyanAtomicLoadPointer(&vector->segments[segment], ZYAN_MEMORY_ORDER_ACQUIRE);
+    if (current)
+    {
+        *data = current;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Multiple threads may race to allocate the same segment. The losers release their copy and
+    // continue with the one that was published first.
+    void* allocated;
+    ZYAN_CHECK(vector->allocator->allocate(vector->allocator, &allocated, vector->element_size,
+        ZYAN_CONCURRENT_VECTOR_SEGMENT_CAPACITY(vector, segment)));
+    if (!ZyanAtomicCompareExchangePointer(&vector->segments[segment], &current, allocated,
+        ZYAN_MEMORY_ORDER_ACQ_REL, ZYAN_MEMORY_ORDER_ACQUIRE))
+    {
+        ZYAN_CHECK(vector->allocator->deallocate(vector->allocator, allocated,
+            vector->element_size, ZYAN_CONCURRENT_VECTOR_SEGMENT_CAPACITY(vector, segment)));
+        *data = current;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    *data = allocated;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Splits the given element index into a segment index and an offset.
+ *
+ * @param   vector  A pointer to the `ZyanConcurrentVector` instance.
+ * @param   index   The element index.
+ * @param   segment Receives the segment index.
+ * @param   offset  Receives the offset of the element inside the segment.
+ */
+static void ZyanConcurrentVectorLocate(const ZyanConcurrentVector* vector, ZyanU64 index,
+    ZyanU8* segment, ZyanUSize* offset)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(index < vector->max_size);
+    ZYAN_ASSERT(segment);
+    ZYAN_ASSERT(offset);
+
+    // Segment `n` starts at index `((1 << n) - 1) << first_segment_shift`
+    const ZyanU8 s = ZyanConcurrentVectorLog2((index >> vector->first_segment_shift) + 1);
+    *segment = s;
+    *offset  = (ZyanUSize)(index - ((((ZyanU64)1 << s) - 1) << vector->first_segment_shift));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConcurrentVectorInit(ZyanConcurrentVector* vector, ZyanUSize element_size,
+    ZyanUSize capacity)
+{
+    return ZyanConcurrentVectorInitEx(vector, element_size, capacity, ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanConcurrentVectorInitEx(ZyanConcurrentVector* vector, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanAllocator* allocator)
+{
+    if (!vector || !element_size || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    capacity = ZYAN_MAX(ZYAN_CONCURRENT_VECTOR_MIN_CAPACITY, capacity);
+    ZyanU8 shift = ZyanConcurrentVectorLog2(capacity);
+    if (capacity & (capacity - 1))
+    {
+        ++shift;
+    }
+    // Leave room for at least two segments
+    if ((ZyanUSize)shift + 2 > ZYAN_CONCURRENT_VECTOR_USIZE_BITS)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // The last element of segment `n` has the index `(2 << (n + shift)) - (1 << shift) - 1`
+    const ZyanU8 segment_count = (ZyanU8)ZYAN_MIN((ZyanUSize)ZYAN_CONCURRENT_VECTOR_MAX_SEGMENTS,
+        ZYAN_CONCURRENT_VECTOR_USIZE_BITS - shift);
+    const ZyanU64 half = (ZyanU64)1 << (segment_count + shift - 1);
+
+    vector->allocator           = allocator;
+    vector->element_size        = element_size;
+    vector->first_segment_shift = shift;
+    vector->segment_count       = segment_count;
+    vector->max_size            = half - ((ZyanU64)1 << shift) + half;
+    ZyanAtomicStore64(&vector->size, 0, ZYAN_MEMORY_ORDER_RELAXED);
+    for (ZyanUSize i = 0; i < ZYAN_CONCURRENT_VECTOR_MAX_SEGMENTS; ++i)
+    {
+        ZyanAtomicStorePointer(&vector->segments[i], ZYAN_NULL, ZYAN_MEMORY_ORDER_RELAXED);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanConcurrentVectorDestroy(ZyanConcurrentVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    for (ZyanU8 i = 0; i < vector->segment_count; ++i)
+    {
+        void* const data =
+            ZyanAtomicLoadPointer(&vector->segments[i], ZYAN_MEMORY_ORDER_ACQUIRE);
+        if (!data)
+        {
+            continue;
+        }
+        ZYAN_CHECK(vector->allocator->deallocate(vector->allocator, data, vector->element_size,
+            ZYAN_CONCURRENT_VECTOR_SEGMENT_CAPACITY(vector, i)));
+        ZyanAtomicStorePointer(&vector->segments[i], ZYAN_NULL, ZYAN_MEMORY_ORDER_RELAXED);
+    }
+    ZyanAtomicStore64(&vector->size, 0, ZYAN_MEMORY_ORDER_RELAXED);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConcurrentVectorGet(const ZyanConcurrentVector* vector, ZyanUSize index,
+    const void** element)
+{
+    if (!vector || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= ZyanAtomicLoad64(&vector->size, ZYAN_MEMORY_ORDER_ACQUIRE))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZyanU8 segment;
+    ZyanUSize offset;
+    ZyanConcurrentVectorLocate(vector, index, &segment, &offset);
+
+    // The segment of every counted slot is published before the size is incremented
+    const ZyanU8* const data =
+        (const ZyanU8*)ZyanAtomicLoadPointer(&vector->segments[segment], ZYAN_MEMORY_ORDER_ACQUIRE);
+    ZYAN_ASSERT(data);
+
+    *element = data + offset * vector->element_size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanConcurrentVectorGetMutable(ZyanConcurrentVector* vector, ZyanUSize index,
+    void** element)
+{
+    return ZyanConcurrentVectorGet(vector, index, (const void**)element);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConcurrentVectorPush(ZyanConcurrentVector* vector, const void* element,
+    ZyanUSize* index)
+{
+    if (!vector || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    void* slot;
+    ZYAN_CHECK(ZyanConcurrentVectorEmplace(vector, &slot, index));
+    ZYAN_MEMCPY(slot, element, vector->element_size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanConcurrentVectorEmplace(ZyanConcurrentVector* vector, void** element,
+    ZyanUSize* index)
+{
+    if (!vector || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // The segment is acquired before the slot is counted, so a failed allocation never leaves a
+    // slot behind that readers could index. A segment that was allocated for a lost race stays
+    // published and is used by one of the following slots.
+    ZyanU64 reserved = ZyanAtomicLoad64(&vector->size, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanU8 segment;
+    ZyanUSize offset;
+    void* data;
+    do
+    {
+        if (reserved >= vector->max_size)
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+        ZyanConcurrentVectorLocate(vector, reserved, &segment, &offset);
+        ZYAN_CHECK(ZyanConcurrentVectorAcquireSegment(vector, segment, &data));
+    } while (!ZyanAtomicCompareExchange64(&vector->size, &reserved, reserved + 1,
+        ZYAN_MEMORY_ORDER_RELEASE, ZYAN_MEMORY_ORDER_RELAXED));
+
+    *element = (ZyanU8*)data + offset * vector->element_size;
+    if (index)
+    {
+        *index = (ZyanUSize)reserved;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConcurrentVectorReserve(ZyanConcurrentVector* vector, ZyanUSize capacity)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+    if (capacity > vector->max_size)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    ZyanU8 last;
+    ZyanUSize offset;
+    ZyanConcurrentVectorLocate(vector, capacity - 1, &last, &offset);
+    for (ZyanU8 i = 0; i <= last; ++i)
+    {
+        void* data;
+        ZYAN_CHECK(ZyanConcurrentVectorAcquireSegment(vector, i, &data));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConcurrentVectorSize(const ZyanConcurrentVector* vector, ZyanUSize* size)
+{
+    if (!vector || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = (ZyanUSize)ZyanAtomicLoad64(&vector->size, ZYAN_MEMORY_ORDER_ACQUIRE);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
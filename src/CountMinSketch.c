@@ -0,0 +1,416 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/CountMinSketch.h>
+#include <Zycore/LibC.h>
+#include <Zycore/Internal/Hash.h>
+#include <Zycore/Internal/Math.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The maximum number of counters per row.
+ */
+#define ZYAN_COUNT_MIN_SKETCH_MAX_WIDTH ((ZyanUSize)1 << 26)
+
+/**
+ * @brief   The maximum number of rows.
+ */
+#define ZYAN_COUNT_MIN_SKETCH_MAX_DEPTH 32
+
+/**
+ * @brief   The version of the serialization format.
+ */
+#define ZYAN_COUNT_MIN_SKETCH_FORMAT_VERSION 1
+
+/**
+ * @brief   The size of the serialization header in bytes.
+ */
+#define ZYAN_COUNT_MIN_SKETCH_HEADER_SIZE 20
+
+/**
+ * @brief   Euler's number.
+ */
+#define ZYAN_COUNT_MIN_SKETCH_E 2.71828182845904523536
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Hashing                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the index of the counter in the given row that belongs to the given hash.
+ *
+ * @param   sketch  A pointer to the `ZyanCountMinSketch` instance.
+ * @param   hash    The hash of the element.
+ * @param   row     The row index.
+ *
+ * @return  The index of the counter in the counter array.
+ *
+ * The per-row hash functions are derived from the two halves of the hash by double hashing.
+ */
+static ZyanUSize ZyanCountMinSketchIndex(const ZyanCountMinSketch* sketch, ZyanU64 hash,
+    ZyanUSize row)
+{
+    ZYAN_ASSERT(sketch);
+
+    const ZyanU64 h1 = hash & 0xFFFFFFFF;
+    const ZyanU64 h2 = (hash >> 32) | 1;
+
+    return row * sketch->width + (ZyanUSize)((h1 + row * h2) & (sketch->width - 1));
+}
+
+/**
+ * @brief   Adds two counter values and saturates on overflow.
+ *
+ * @param   a   The first value.
+ * @param   b   The second value.
+ *
+ * @return  The saturated sum.
+ */
+static ZyanU64 ZyanCountMinSketchAddSaturated(ZyanU64 a, ZyanU64 b)
+{
+    const ZyanU64 sum = a + b;
+    return (sum < a) ? (ZyanU64)-1 : sum;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Serialization                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Writes a value in little endian byte order.
+ *
+ * @param   buffer  A pointer to the buffer.
+ * @param   value   The value.
+ * @param   size    The number of bytes to write.
+ */
+static void ZyanCountMinSketchWrite(ZyanU8* buffer, ZyanU64 value, ZyanU32 size)
+{
+    ZYAN_ASSERT(buffer);
+
+    for (ZyanU32 i = 0; i < size; ++i)
+    {
+        buffer[i] = (ZyanU8)(value >> (i * 8));
+    }
+}
+
+/**
+ * @brief   Reads a value in little endian byte order.
+ *
+ * @param   buffer  A pointer to the buffer.
+ * @param   size    The number of bytes to read.
+ *
+ * @return  The value.
+ */
+static ZyanU64 ZyanCountMinSketchRead(const ZyanU8* buffer, ZyanU32 size)
+{
+    ZYAN_ASSERT(buffer);
+
+    ZyanU64 value = 0;
+    for (ZyanU32 i = 0; i < size; ++i)
+    {
+        value |= (ZyanU64)buffer[i] << (i * 8);
+    }
+
+    return value;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCountMinSketchInit(ZyanCountMinSketch* sketch, float epsilon, float delta)
+{
+    if (!sketch || !(epsilon > 0.0f) || !(epsilon < 1.0f) || !(delta > 0.0f) ||
+        !(delta < 1.0f))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // width = e / epsilon and depth = ln(1 / delta)
+    const double width = ZYAN_COUNT_MIN_SKETCH_E / epsilon;
+    const double depth = ZyanMathLog(1.0 / delta);
+    if ((width > (double)ZYAN_COUNT_MIN_SKETCH_MAX_WIDTH) ||
+        (depth > ZYAN_COUNT_MIN_SKETCH_MAX_DEPTH))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanCountMinSketchInitEx(sketch, (ZyanUSize)width + 1, (ZyanUSize)depth + 1,
+        ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanCountMinSketchInitEx(ZyanCountMinSketch* sketch, ZyanUSize width, ZyanUSize depth,
+    ZyanAllocator* allocator)
+{
+    if (!sketch || !width || (width > ZYAN_COUNT_MIN_SKETCH_MAX_WIDTH) || !depth ||
+        (depth > ZYAN_COUNT_MIN_SKETCH_MAX_DEPTH) || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize rounded = 1;
+    while (rounded < width)
+    {
+        rounded <<= 1;
+    }
+    if (rounded > (ZyanUSize)-1 / sizeof(ZyanU64) / depth)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(allocator->allocate(allocator, (void**)&sketch->counters, sizeof(ZyanU64),
+        rounded * depth));
+    ZYAN_MEMSET(sketch->counters, 0, rounded * depth * sizeof(ZyanU64));
+
+    sketch->allocator = allocator;
+    sketch->width     = rounded;
+    sketch->depth     = depth;
+    sketch->total     = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCountMinSketchDestroy(ZyanCountMinSketch* sketch)
+{
+    if (!sketch)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return sketch->allocator->deallocate(sketch->allocator, sketch->counters, sizeof(ZyanU64),
+        sketch->width * sketch->depth);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCountMinSketchAdd(ZyanCountMinSketch* sketch, const void* element, ZyanUSize size,
+    ZyanU64 count)
+{
+    if (!sketch || (!element && size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanCountMinSketchAddHash(sketch, ZyanHashBytesValue(element, size), count);
+}
+
+ZyanStatus ZyanCountMinSketchAddHash(ZyanCountMinSketch* sketch, ZyanU64 hash, ZyanU64 count)
+{
+    if (!sketch)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    for (ZyanUSize row = 0; row < sketch->depth; ++row)
+    {
+        ZyanU64* const counter = &sketch->counters[ZyanCountMinSketchIndex(sketch, hash, row)];
+        *counter = ZyanCountMinSketchAddSaturated(*counter, count);
+    }
+    sketch->total = ZyanCountMinSketchAddSaturated(sketch->total, count);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCountMinSketchMerge(ZyanCountMinSketch* destination,
+    const ZyanCountMinSketch* source)
+{
+    if (!destination || !source)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if ((destination->width != source->width) || (destination->depth != source->depth))
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    const ZyanUSize count = destination->width * destination->depth;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        destination->counters[i] =
+            ZyanCountMinSketchAddSaturated(destination->counters[i], source->counters[i]);
+    }
+    destination->total = ZyanCountMinSketchAddSaturated(destination->total, source->total);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCountMinSketchClear(ZyanCountMinSketch* sketch)
+{
+    if (!sketch)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_MEMSET(sketch->counters, 0, sketch->width * sketch->depth * sizeof(ZyanU64));
+    sketch->total = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Estimation                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCountMinSketchEstimate(const ZyanCountMinSketch* sketch, const void* element,
+    ZyanUSize size, ZyanU64* count)
+{
+    if (!sketch || (!element && size) || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanCountMinSketchEstimateHash(sketch, ZyanHashBytesValue(element, size), count);
+}
+
+ZyanStatus ZyanCountMinSketchEstimateHash(const ZyanCountMinSketch* sketch, ZyanU64 hash,
+    ZyanU64* count)
+{
+    if (!sketch || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU64 result = (ZyanU64)-1;
+    for (ZyanUSize row = 0; row < sketch->depth; ++row)
+    {
+        const ZyanU64 value = sketch->counters[ZyanCountMinSketchIndex(sketch, hash, row)];
+        result = ZYAN_MIN(result, value);
+    }
+    *count = result;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCountMinSketchTotal(const ZyanCountMinSketch* sketch, ZyanU64* total)
+{
+    if (!sketch || !total)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *total = sketch->total;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Serialization                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCountMinSketchSerializedSize(const ZyanCountMinSketch* sketch, ZyanUSize* size)
+{
+    if (!sketch || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = ZYAN_COUNT_MIN_SKETCH_HEADER_SIZE + sketch->width * sketch->depth * 8;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCountMinSketchSerialize(const ZyanCountMinSketch* sketch, void* buffer,
+    ZyanUSize capacity)
+{
+    if (!sketch || !buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize size;
+    ZYAN_CHECK(ZyanCountMinSketchSerializedSize(sketch, &size));
+    if (capacity < size)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    ZyanU8* p = (ZyanU8*)buffer;
+    ZyanCountMinSketchWrite(p, ZYAN_COUNT_MIN_SKETCH_FORMAT_VERSION, 4);
+    ZyanCountMinSketchWrite(p + 4, sketch->width, 4);
+    ZyanCountMinSketchWrite(p + 8, sketch->depth, 4);
+    ZyanCountMinSketchWrite(p + 12, sketch->total, 8);
+    p += ZYAN_COUNT_MIN_SKETCH_HEADER_SIZE;
+
+    const ZyanUSize count = sketch->width * sketch->depth;
+    for (ZyanUSize i = 0; i < count; ++i, p += 8)
+    {
+        ZyanCountMinSketchWrite(p, sketch->counters[i], 8);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCountMinSketchDeserialize(ZyanCountMinSketch* sketch, const void* buffer,
+    ZyanUSize size, ZyanAllocator* allocator)
+{
+    if (!sketch || !buffer || !allocator || (size < ZYAN_COUNT_MIN_SKETCH_HEADER_SIZE))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* p = (const ZyanU8*)buffer;
+    const ZyanU64 width = ZyanCountMinSketchRead(p + 4, 4);
+    const ZyanU64 depth = ZyanCountMinSketchRead(p + 8, 4);
+    if ((ZyanCountMinSketchRead(p, 4) != ZYAN_COUNT_MIN_SKETCH_FORMAT_VERSION) || !width ||
+        (width & (width - 1)) || (width > ZYAN_COUNT_MIN_SKETCH_MAX_WIDTH) || !depth ||
+        (depth > ZYAN_COUNT_MIN_SKETCH_MAX_DEPTH) ||
+        ((size - ZYAN_COUNT_MIN_SKETCH_HEADER_SIZE) / 8 != width * depth) ||
+        ((size - ZYAN_COUNT_MIN_SKETCH_HEADER_SIZE) % 8))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanCountMinSketchInitEx(sketch, (ZyanUSize)width, (ZyanUSize)depth, allocator));
+    sketch->total = ZyanCountMinSketchRead(p + 12, 8);
+    p += ZYAN_COUNT_MIN_SKETCH_HEADER_SIZE;
+
+    const ZyanUSize count = sketch->width * sketch->depth;
+    for (ZyanUSize i = 0; i < count; ++i, p += 8)
+    {
+        sketch->counters[i] = ZyanCountMinSketchRead(p, 8);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
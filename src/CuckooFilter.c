@@ -0,0 +1,468 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/CuckooFilter.h>
+#include <Zycore/Hash.h>
+#include <Zycore/LibC.h>
+#include <Zycore/Internal/Hash.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The number of fingerprints per bucket.
+ */
+#define ZYAN_CUCKOO_FILTER_BUCKET_SLOTS 4
+
+/**
+ * @brief   The maximum number of relocations performed by a single insertion.
+ */
+#define ZYAN_CUCKOO_FILTER_MAX_KICKS 500
+
+/**
+ * @brief   The maximum number of buckets.
+ */
+#define ZYAN_CUCKOO_FILTER_MAX_BUCKETS ((ZyanUSize)1 << (sizeof(ZyanUSize) * 8 - 5))
+
+/**
+ * @brief   A bucket with `1` in every fingerprint lane.
+ */
+#define ZYAN_CUCKOO_FILTER_LANES_LOW  0x0001000100010001
+
+/**
+ * @brief   A bucket with the most significant bit set in every fingerprint lane.
+ */
+#define ZYAN_CUCKOO_FILTER_LANES_HIGH 0x8000800080008000
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Hashing                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Derives the fingerprint from the given hash.
+ *
+ * @param   hash    The hash of the element.
+ *
+ * @return  The fingerprint. `0` marks empty slots and is never returned.
+ */
+static ZyanU16 ZyanCuckooFilterFingerprint(ZyanU64 hash)
+{
+    const ZyanU16 fingerprint = (ZyanU16)(hash >> 48);
+    return fingerprint ? fingerprint : 1;
+}
+
+/**
+ * @brief   Returns the alternate bucket index for the given fingerprint.
+ *
+ * @param   filter      A pointer to the `ZyanCuckooFilter` instance.
+ * @param   index       The current bucket index.
+ * @param   fingerprint The fingerprint.
+ *
+ * @return  The alternate bucket index.
+ *
+ * The function is an involution: applying it twice returns the original index, so a relocated
+ * fingerprint can always find its way back without knowing the original element.
+ */
+static ZyanUSize ZyanCuckooFilterAlternateIndex(const ZyanCuckooFilter* filter, ZyanUSize index,
+    ZyanU16 fingerprint)
+{
+    ZYAN_ASSERT(filter);
+
+    return (index ^ (ZyanUSize)ZyanHashU64(fingerprint)) & (filter->bucket_count - 1);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Buckets                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Checks if any fingerprint lane of the given bucket is zero.
+ *
+ * @param   bucket  The bucket.
+ *
+ * @return  `ZYAN_TRUE`, if at least one lane is zero or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanCuckooFilterHasZeroLane(ZyanU64 bucket)
+{
+    return ((bucket - ZYAN_CUCKOO_FILTER_LANES_LOW) & ~bucket & ZYAN_CUCKOO_FILTER_LANES_HIGH)
+        ? ZYAN_TRUE : ZYAN_FALSE;
+}
+
+/**
+ * @brief   Checks if the given bucket contains the given fingerprint.
+ *
+ * @param   bucket      The bucket.
+ * @param   fingerprint The fingerprint.
+ *
+ * @return  `ZYAN_TRUE`, if the bucket contains the fingerprint or `ZYAN_FALSE`, if not.
+ *
+ * All four lanes are compared at once by broadcasting the fingerprint and searching the result
+ * for a zero lane.
+ */
+static ZyanBool ZyanCuckooFilterBucketContains(ZyanU64 bucket, ZyanU16 fingerprint)
+{
+    const ZyanU64 broadcast = (ZyanU64)fingerprint * ZYAN_CUCKOO_FILTER_LANES_LOW;
+    return ZyanCuckooFilterHasZeroLane(bucket ^ broadcast);
+}
+
+/**
+ * @brief   Replaces the first lane of the given bucket that matches `expected`.
+ *
+ * @param   bucket      A pointer to the bucket.
+ * @param   expected    The fingerprint to search for (`0` for an empty slot).
+ * @param   replacement The new fingerprint.
+ *
+ * @return  `ZYAN_TRUE`, if a lane was replaced or `ZYAN_FALSE`, if no lane matched.
+ */
+static ZyanBool ZyanCuckooFilterBucketReplace(ZyanU64* bucket, ZyanU16 expected,
+    ZyanU16 replacement)
+{
+    ZYAN_ASSERT(bucket);
+
+    if (!ZyanCuckooFilterBucketContains(*bucket, expected))
+    {
+        return ZYAN_FALSE;
+    }
+
+    for (ZyanU32 i = 0; i < ZYAN_CUCKOO_FILTER_BUCKET_SLOTS; ++i)
+    {
+        const ZyanU32 shift = i * 16;
+        if ((ZyanU16)(*bucket >> shift) == expected)
+        {
+            *bucket = (*bucket & ~((ZyanU64)0xFFFF << shift)) | ((ZyanU64)replacement << shift);
+            return ZYAN_TRUE;
+        }
+    }
+
+    ZYAN_UNREACHABLE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the next value of the random number generator (xorshift64).
+ *
+ * @param   filter  A pointer to the `ZyanCuckooFilter` instance.
+ *
+ * @return  A pseudo random number.
+ */
+static ZyanU64 ZyanCuckooFilterRandom(ZyanCuckooFilter* filter)
+{
+    ZYAN_ASSERT(filter);
+
+    ZyanU64 x = filter->random;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    filter->random = x;
+
+    return x;
+}
+
+/**
+ * @brief   Places a fingerprint into one of its candidate buckets, relocating other fingerprints
+ *          if required.
+ *
+ * @param   filter      A pointer to the `ZyanCuckooFilter` instance.
+ * @param   index       One of the candidate bucket indices of the fingerprint.
+ * @param   fingerprint The fingerprint.
+ *
+ * The victim slot must be empty. If the fingerprint could not be placed after the maximum number
+ * of relocations, the last displaced fingerprint is stored in the victim slot.
+ */
+static void ZyanCuckooFilterPlace(ZyanCuckooFilter* filter, ZyanUSize index, ZyanU16 fingerprint)
+{
+    ZYAN_ASSERT(filter);
+    ZYAN_ASSERT(!filter->victim_fingerprint);
+
+    if (ZyanCuckooFilterBucketReplace(&filter->buckets[index], 0, fingerprint))
+    {
+        return;
+    }
+    index = ZyanCuckooFilterAlternateIndex(filter, index, fingerprint);
+    if (ZyanCuckooFilterBucketReplace(&filter->buckets[index], 0, fingerprint))
+    {
+        return;
+    }
+
+    for (ZyanU32 kick = 0; kick < ZYAN_CUCKOO_FILTER_MAX_KICKS; ++kick)
+    {
+        // Both candidate buckets are full at this point. Swap the fingerprint with a random
+        // resident and move the resident on to its alternate bucket
+        const ZyanU32 shift = (ZyanU32)(ZyanCuckooFilterRandom(filter) % 4) * 16;
+        ZyanU64* const bucket = &filter->buckets[index];
+        const ZyanU16 displaced = (ZyanU16)(*bucket >> shift);
+        *bucket = (*bucket & ~((ZyanU64)0xFFFF << shift)) | ((ZyanU64)fingerprint << shift);
+
+        fingerprint = displaced;
+        index = ZyanCuckooFilterAlternateIndex(filter, index, fingerprint);
+        if (ZyanCuckooFilterBucketReplace(&filter->buckets[index], 0, fingerprint))
+        {
+            return;
+        }
+    }
+
+    filter->victim_fingerprint = fingerprint;
+    filter->victim_index = index;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCuckooFilterInit(ZyanCuckooFilter* filter, ZyanUSize capacity)
+{
+    return ZyanCuckooFilterInitEx(filter, capacity, ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanCuckooFilterInitEx(ZyanCuckooFilter* filter, ZyanUSize capacity,
+    ZyanAllocator* allocator)
+{
+    if (!filter || !capacity || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize bucket_count = 1;
+    while ((double)bucket_count * ZYAN_CUCKOO_FILTER_BUCKET_SLOTS * 0.95 < (double)capacity)
+    {
+        if (bucket_count >= ZYAN_CUCKOO_FILTER_MAX_BUCKETS)
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        bucket_count <<= 1;
+    }
+
+    ZYAN_CHECK(allocator->allocate(allocator, (void**)&filter->buckets, sizeof(ZyanU64),
+        bucket_count));
+    ZYAN_MEMSET(filter->buckets, 0, bucket_count * sizeof(ZyanU64));
+
+    filter->allocator          = allocator;
+    filter->bucket_count       = bucket_count;
+    filter->size               = 0;
+    filter->random             = 0x9E3779B97F4A7C15;
+    filter->victim_fingerprint = 0;
+    filter->victim_index       = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCuckooFilterDestroy(ZyanCuckooFilter* filter)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return filter->allocator->deallocate(filter->allocator, filter->buckets, sizeof(ZyanU64),
+        filter->bucket_count);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCuckooFilterInsert(ZyanCuckooFilter* filter, const void* element, ZyanUSize size)
+{
+    if (!filter || (!element && size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanCuckooFilterInsertHash(filter, ZyanHashBytesValue(element, size));
+}
+
+ZyanStatus ZyanCuckooFilterInsertHash(ZyanCuckooFilter* filter, ZyanU64 hash)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // A pending victim means the table is saturated. Refusing the insertion keeps all previously
+    // added elements visible
+    if (filter->victim_fingerprint)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    ZyanCuckooFilterPlace(filter, (ZyanUSize)hash & (filter->bucket_count - 1),
+        ZyanCuckooFilterFingerprint(hash));
+    ++filter->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCuckooFilterContains(const ZyanCuckooFilter* filter, const void* element,
+    ZyanUSize size)
+{
+    if (!filter || (!element && size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanCuckooFilterContainsHash(filter, ZyanHashBytesValue(element, size));
+}
+
+ZyanStatus ZyanCuckooFilterContainsHash(const ZyanCuckooFilter* filter, ZyanU64 hash)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU16 fingerprint = ZyanCuckooFilterFingerprint(hash);
+    const ZyanUSize i1 = (ZyanUSize)hash & (filter->bucket_count - 1);
+    const ZyanUSize i2 = ZyanCuckooFilterAlternateIndex(filter, i1, fingerprint);
+
+    if (ZyanCuckooFilterBucketContains(filter->buckets[i1], fingerprint) ||
+        ZyanCuckooFilterBucketContains(filter->buckets[i2], fingerprint))
+    {
+        return ZYAN_STATUS_TRUE;
+    }
+
+    if ((filter->victim_fingerprint == fingerprint) &&
+        ((filter->victim_index == i1) || (filter->victim_index == i2)))
+    {
+        return ZYAN_STATUS_TRUE;
+    }
+
+    return ZYAN_STATUS_FALSE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCuckooFilterRemove(ZyanCuckooFilter* filter, const void* element, ZyanUSize size)
+{
+    if (!filter || (!element && size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanCuckooFilterRemoveHash(filter, ZyanHashBytesValue(element, size));
+}
+
+ZyanStatus ZyanCuckooFilterRemoveHash(ZyanCuckooFilter* filter, ZyanU64 hash)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU16 fingerprint = ZyanCuckooFilterFingerprint(hash);
+    const ZyanUSize i1 = (ZyanUSize)hash & (filter->bucket_count - 1);
+    const ZyanUSize i2 = ZyanCuckooFilterAlternateIndex(filter, i1, fingerprint);
+
+    if ((filter->victim_fingerprint == fingerprint) &&
+        ((filter->victim_index == i1) || (filter->victim_index == i2)))
+    {
+        filter->victim_fingerprint = 0;
+        --filter->size;
+        return ZYAN_STATUS_TRUE;
+    }
+
+    if (!ZyanCuckooFilterBucketReplace(&filter->buckets[i1], fingerprint, 0) &&
+        !ZyanCuckooFilterBucketReplace(&filter->buckets[i2], fingerprint, 0))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+    --filter->size;
+
+    // A slot was freed, so try to move the pending victim back into the table
+    if (filter->victim_fingerprint)
+    {
+        const ZyanU16 victim = filter->victim_fingerprint;
+        filter->victim_fingerprint = 0;
+        ZyanCuckooFilterPlace(filter, filter->victim_index, victim);
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanCuckooFilterClear(ZyanCuckooFilter* filter)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_MEMSET(filter->buckets, 0, filter->bucket_count * sizeof(ZyanU64));
+    filter->size = 0;
+    filter->victim_fingerprint = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCuckooFilterSize(const ZyanCuckooFilter* filter, ZyanUSize* size)
+{
+    if (!filter || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = filter->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCuckooFilterCapacity(const ZyanCuckooFilter* filter, ZyanUSize* capacity)
+{
+    if (!filter || !capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *capacity = filter->bucket_count * ZYAN_CUCKOO_FILTER_BUCKET_SLOTS;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
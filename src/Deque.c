@@ -0,0 +1,482 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Deque.h>
+#include <Zycore/LibC.h>
+#include <Zycore/Trace.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+#define ZYAN_DEQUE_BLOCK_SIZE         4096
+#define ZYAN_DEQUE_MIN_BLOCK_CAPACITY 16
+#define ZYAN_DEQUE_MIN_MAP_CAPACITY   8
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the number of elements per block.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ *
+ * @return  The number of elements per block.
+ */
+#define ZYAN_DEQUE_BLOCK_CAPACITY(deque) \
+    ((ZyanUSize)1 << (deque)->block_shift)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the offset of the element at the given `index`.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   index   The element index.
+ *
+ * @return  The offset of the element at the given `index`.
+ */
+static void* ZyanDequeOffset(const ZyanDeque* deque, ZyanUSize index)
+{
+    ZYAN_ASSERT(deque);
+    ZYAN_ASSERT(deque->map);
+
+    const ZyanUSize position = deque->offset + index;
+    ZyanU8* const block = (ZyanU8*)deque->map[deque->map_begin + (position >> deque->block_shift)];
+    const ZyanUSize mask = ZYAN_DEQUE_BLOCK_CAPACITY(deque) - 1;
+
+    return block + (position & mask) * deque->element_size;
+}
+
+/**
+ * @brief   Obtains a new block, either by reusing the spare block or by allocating a new one.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   block   Receives a pointer to the block.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanDequeAcquireBlock(ZyanDeque* deque, void** block)
+{
+    ZYAN_ASSERT(deque);
+    ZYAN_ASSERT(block);
+
+    if (deque->spare)
+    {
+        *block = deque->spare;
+        deque->spare = ZYAN_NULL;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    return deque->allocator->allocate(deque->allocator, block, deque->element_size,
+        ZYAN_DEQUE_BLOCK_CAPACITY(deque));
+}
+
+/**
+ * @brief   Releases a block, either by keeping it as spare block or by deallocating it.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   block   A pointer to the block.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanDequeReleaseBlock(ZyanDeque* deque, void* block)
+{
+    ZYAN_ASSERT(deque);
+    ZYAN_ASSERT(block);
+
+    if (!deque->spare)
+    {
+        deque->spare = block;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    return deque->allocator->deallocate(deque->allocator, block, deque->element_size,
+        ZYAN_DEQUE_BLOCK_CAPACITY(deque));
+}
+
+/**
+ * @brief   Makes sure that the block map has at least one free entry at both ends of the used
+ *          range.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * Only the block pointers are moved by this function. The elements are never copied.
+ */
+static ZyanStatus ZyanDequeAdjustMap(ZyanDeque* deque)
+{
+    ZYAN_ASSERT(deque);
+
+    const ZyanUSize required = deque->block_count + 2;
+    if (deque->map && (required * 2 <= deque->map_capacity))
+    {
+        // Enough room in total, just recenter the used range
+        const ZyanUSize begin = (deque->map_capacity - deque->block_count) / 2;
+        ZYAN_MEMMOVE(deque->map + begin, deque->map + deque->map_begin,
+            deque->block_count * sizeof(void*));
+        ZYAN_TRACE(ZYAN_TRACE_EVENT_CONTAINER_COPY, deque, deque->map + begin,
+            deque->map + deque->map_begin, deque->block_count * sizeof(void*), 0);
+        deque->map_begin = begin;
+
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanUSize capacity =
+        ZYAN_MAX(ZYAN_DEQUE_MIN_MAP_CAPACITY, ZYAN_MAX(required * 2, deque->map_capacity * 2));
+    void** map;
+    ZYAN_CHECK(deque->allocator->allocate(deque->allocator, (void**)&map, sizeof(void*),
+        capacity));
+
+    const ZyanUSize begin = (capacity - deque->block_count) / 2;
+    if (deque->map)
+    {
+        ZYAN_MEMCPY(map + begin, deque->map + deque->map_begin,
+            deque->block_count * sizeof(void*));
+        ZYAN_CHECK(deque->allocator->deallocate(deque->allocator, deque->map, sizeof(void*),
+            deque->map_capacity));
+    }
+
+    ZYAN_TRACE(ZYAN_TRACE_EVENT_CONTAINER_GROW, deque, map, deque->map,
+        capacity * sizeof(void*), deque->map_capacity * sizeof(void*));
+
+    deque->map          = map;
+    deque->map_capacity = capacity;
+    deque->map_begin    = begin;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Releases all blocks after the last element has been removed.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanDequeReset(ZyanDeque* deque)
+{
+    ZYAN_ASSERT(deque);
+    ZYAN_ASSERT(!deque->size);
+
+    for (ZyanUSize i = 0; i < deque->block_count; ++i)
+    {
+        ZYAN_CHECK(ZyanDequeReleaseBlock(deque, deque->map[deque->map_begin + i]));
+    }
+    deque->block_count = 0;
+    deque->offset      = 0;
+    deque->map_begin   = deque->map_capacity / 2;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanDequeInit(ZyanDeque* deque, ZyanUSize element_size)
+{
+    return ZyanDequeInitEx(deque, element_size,
+        ZYAN_DEQUE_BLOCK_SIZE / (element_size ? element_size : 1), ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanDequeInitEx(ZyanDeque* deque, ZyanUSize element_size, ZyanUSize block_capacity,
+    ZyanAllocator* allocator)
+{
+    if (!deque || !element_size || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    block_capacity = ZYAN_MAX(ZYAN_DEQUE_MIN_BLOCK_CAPACITY, block_capacity);
+    ZyanUSize shift = 0;
+    while (((ZyanUSize)1 << shift) < block_capacity)
+    {
+        ++shift;
+    }
+
+    deque->allocator    = allocator;
+    deque->element_size = element_size;
+    deque->block_shift  = shift;
+    deque->map          = ZYAN_NULL;
+    deque->map_capacity = 0;
+    deque->map_begin    = 0;
+    deque->block_count  = 0;
+    deque->offset       = 0;
+    deque->size         = 0;
+    deque->spare        = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDequeDestroy(ZyanDeque* deque)
+{
+    if (!deque)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanDequeClear(deque));
+    if (deque->spare)
+    {
+        ZYAN_CHECK(deque->allocator->deallocate(deque->allocator, deque->spare,
+            deque->element_size, ZYAN_DEQUE_BLOCK_CAPACITY(deque)));
+        deque->spare = ZYAN_NULL;
+    }
+    if (deque->map)
+    {
+        ZYAN_CHECK(deque->allocator->deallocate(deque->allocator, deque->map, sizeof(void*),
+            deque->map_capacity));
+        deque->map = ZYAN_NULL;
+        deque->map_capacity = 0;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanDequeGet(const ZyanDeque* deque, ZyanUSize index, void** element)
+{
+    if (ZYAN_UNLIKELY(!deque || !element))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(index >= deque->size))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    *element = ZyanDequeOffset(deque, index);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDequeGetConst(const ZyanDeque* deque, ZyanUSize index, const void** element)
+{
+    if (ZYAN_UNLIKELY(!deque || !element))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(index >= deque->size))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    *element = (const void*)ZyanDequeOffset(deque, index);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Assignment                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanDequeAssign(ZyanDeque* deque, ZyanUSize index, const void* element)
+{
+    if (ZYAN_UNLIKELY(!deque || !element))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(index >= deque->size))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZYAN_MEMCPY(ZyanDequeOffset(deque, index), element, deque->element_size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanDequePushBack(ZyanDeque* deque, const void* element)
+{
+    if (ZYAN_UNLIKELY(!deque || !element))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (ZYAN_UNLIKELY(deque->offset + deque->size == deque->block_count << deque->block_shift))
+    {
+        if (!deque->map || (deque->map_begin + deque->block_count == deque->map_capacity))
+        {
+            ZYAN_CHECK(ZyanDequeAdjustMap(deque));
+        }
+
+        void* block;
+        ZYAN_CHECK(ZyanDequeAcquireBlock(deque, &block));
+        deque->map[deque->map_begin + deque->block_count++] = block;
+    }
+
+    ZYAN_MEMCPY(ZyanDequeOffset(deque, deque->size), element, deque->element_size);
+    ++deque->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDequePushFront(ZyanDeque* deque, const void* element)
+{
+    if (ZYAN_UNLIKELY(!deque || !element))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (ZYAN_UNLIKELY(deque->offset == 0))
+    {
+        if (!deque->map || (deque->map_begin == 0))
+        {
+            ZYAN_CHECK(ZyanDequeAdjustMap(deque));
+        }
+
+        void* block;
+        ZYAN_CHECK(ZyanDequeAcquireBlock(deque, &block));
+        deque->map[--deque->map_begin] = block;
+        ++deque->block_count;
+        deque->offset = ZYAN_DEQUE_BLOCK_CAPACITY(deque);
+    }
+
+    --deque->offset;
+    ++deque->size;
+    ZYAN_MEMCPY(ZyanDequeOffset(deque, 0), element, deque->element_size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanDequePopBack(ZyanDeque* deque, void* element)
+{
+    if (ZYAN_UNLIKELY(!deque))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(deque->size == 0))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (element)
+    {
+        ZYAN_MEMCPY(element, ZyanDequeOffset(deque, deque->size - 1), deque->element_size);
+    }
+
+    if (--deque->size == 0)
+    {
+        return ZyanDequeReset(deque);
+    }
+    const ZyanUSize mask = ZYAN_DEQUE_BLOCK_CAPACITY(deque) - 1;
+    if (ZYAN_UNLIKELY(((deque->offset + deque->size) & mask) == 0))
+    {
+        ZYAN_CHECK(ZyanDequeReleaseBlock(deque,
+            deque->map[deque->map_begin + --deque->block_count]));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDequePopFront(ZyanDeque* deque, void* element)
+{
+    if (ZYAN_UNLIKELY(!deque))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(deque->size == 0))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (element)
+    {
+        ZYAN_MEMCPY(element, ZyanDequeOffset(deque, 0), deque->element_size);
+    }
+
+    ++deque->offset;
+    if (--deque->size == 0)
+    {
+        return ZyanDequeReset(deque);
+    }
+    if (ZYAN_UNLIKELY(deque->offset == ZYAN_DEQUE_BLOCK_CAPACITY(deque)))
+    {
+        ZYAN_CHECK(ZyanDequeReleaseBlock(deque, deque->map[deque->map_begin++]));
+        --deque->block_count;
+        deque->offset = 0;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDequeClear(ZyanDeque* deque)
+{
+    if (!deque)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    deque->size = 0;
+
+    return ZyanDequeReset(deque);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanDequeSize(const ZyanDeque* deque, ZyanUSize* size)
+{
+    if (!deque || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = deque->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,413 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Epoch.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The number of retired blocks per participant that triggers a collection.
+ */
+#define ZYAN_EPOCH_COLLECT_THRESHOLD    64
+
+/**
+ * @brief   The active bit of the local epoch of a participant.
+ */
+#define ZYAN_EPOCH_ACTIVE               1
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanEpochRetiredBlock` struct.
+ */
+typedef struct ZyanEpochRetiredBlock_
+{
+    /**
+     * @brief   The allocator that owns the block.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * @brief   A pointer to the block.
+     */
+    void* p;
+    /**
+     * @brief   The size of a single element of the block.
+     */
+    ZyanUSize element_size;
+    /**
+     * @brief   The number of elements of the block.
+     */
+    ZyanUSize n;
+} ZyanEpochRetiredBlock;
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   Releases all blocks in the given retired list.
+ *
+ * @param   participant A pointer to the `ZyanEpochParticipant` record.
+ * @param   index       The index of the retired list.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanEpochReleaseList(ZyanEpochParticipant* participant, ZyanUSize index)
+{
+    ZyanVector* const list = &participant->retired[index];
+    const ZyanEpochRetiredBlock* const blocks = (const ZyanEpochRetiredBlock*)list->data;
+
+    ZyanStatus result = ZYAN_STATUS_SUCCESS;
+    for (ZyanUSize i = 0; i < list->size; ++i)
+    {
+        const ZyanStatus status = blocks[i].allocator->deallocate(blocks[i].allocator,
+            blocks[i].p, blocks[i].element_size, blocks[i].n);
+        if (!ZYAN_SUCCESS(status))
+        {
+            result = status;
+        }
+    }
+    participant->retired_count -= list->size;
+
+    ZYAN_CHECK(ZyanVectorClear(list));
+    return result;
+}
+
+/**
+ * @brief   Releases all retired lists of the given participant that are older than two epochs.
+ *
+ * @param   participant A pointer to the `ZyanEpochParticipant` record.
+ * @param   epoch       The current global epoch.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanEpochReleaseExpired(ZyanEpochParticipant* participant, ZyanU64 epoch)
+{
+    for (ZyanUSize i = 0; i < ZYAN_ARRAY_LENGTH(participant->retired); ++i)
+    {
+        if (participant->retired[i].size && (participant->retired_epoch[i] + 2 <= epoch))
+        {
+            ZYAN_CHECK(ZyanEpochReleaseList(participant, i));
+        }
+    }
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Advances the global epoch, if all active participants observed the current one.
+ *
+ * @param   domain  A pointer to the `ZyanEpochDomain` instance.
+ *
+ * @return  The (possibly advanced) global epoch.
+ */
+static ZyanU64 ZyanEpochTryAdvance(ZyanEpochDomain* domain)
+{
+    ZyanU64 epoch = ZyanAtomicLoad64(&domain->epoch, ZYAN_MEMORY_ORDER_SEQ_CST);
+
+    // Pairs with the fence in `ZyanEpochEnter`
+    ZyanAtomicThreadFence(ZYAN_MEMORY_ORDER_SEQ_CST);
+
+    const ZyanEpochParticipant* participant = (const ZyanEpochParticipant*)
+        ZyanAtomicLoadPointer(&domain->participants, ZYAN_MEMORY_ORDER_ACQUIRE);
+    for (; participant; participant = participant->next)
+    {
+        const ZyanU64 local = ZyanAtomicLoad64(&participant->local_epoch,
+            ZYAN_MEMORY_ORDER_ACQUIRE);
+        if ((local & ZYAN_EPOCH_ACTIVE) && ((local >> 1) != epoch))
+        {
+            return epoch;
+        }
+    }
+
+    // Losing the race against another thread is fine, as the epoch advanced either way
+    if (ZyanAtomicCompareExchange64(&domain->epoch, &epoch, epoch + 1, ZYAN_MEMORY_ORDER_ACQ_REL,
+        ZYAN_MEMORY_ORDER_ACQUIRE))
+    {
+        return epoch + 1;
+    }
+    return epoch;
+}
+
+/**
+ * @brief   Releases all retired blocks of the given participant unconditionally and destroys its
+ *          retired lists.
+ *
+ * @param   participant A pointer to the `ZyanEpochParticipant` record.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanEpochDestroyParticipant(ZyanEpochParticipant* participant)
+{
+    ZyanStatus result = ZYAN_STATUS_SUCCESS;
+    for (ZyanUSize i = 0; i < ZYAN_ARRAY_LENGTH(participant->retired); ++i)
+    {
+        ZyanStatus status = ZyanEpochReleaseList(participant, i);
+        if (ZYAN_SUCCESS(status))
+        {
+            status = ZyanVectorDestroy(&participant->retired[i]);
+        }
+        if (!ZYAN_SUCCESS(status))
+        {
+            result = status;
+        }
+    }
+    return result;
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanEpochDomainInit(ZyanEpochDomain* domain)
+{
+    return ZyanEpochDomainInitEx(domain, ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanEpochDomainInitEx(ZyanEpochDomain* domain, ZyanAllocator* allocator)
+{
+    if (!domain || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    domain->allocator = allocator;
+    ZyanAtomicStore64(&domain->epoch, 0, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanAtomicStorePointer(&domain->participants, ZYAN_NULL, ZYAN_MEMORY_ORDER_RELAXED);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanEpochDomainDestroy(ZyanEpochDomain* domain)
+{
+    if (!domain)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanEpochParticipant* participant = (ZyanEpochParticipant*)
+        ZyanAtomicExchangePointer(&domain->participants, ZYAN_NULL, ZYAN_MEMORY_ORDER_ACQUIRE);
+    ZyanStatus result = ZYAN_STATUS_SUCCESS;
+    while (participant)
+    {
+        ZyanEpochParticipant* const next = participant->next;
+        ZyanStatus status = ZyanEpochDestroyParticipant(participant);
+        if (ZYAN_SUCCESS(status))
+        {
+            status = domain->allocator->deallocate(domain->allocator, participant,
+                sizeof(ZyanEpochParticipant), 1);
+        }
+        if (!ZYAN_SUCCESS(status))
+        {
+            result = status;
+        }
+        participant = next;
+    }
+
+    return result;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Participants                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanEpochDomainRegister(ZyanEpochDomain* domain, ZyanEpochParticipant** participant)
+{
+    if (!domain || !participant)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanEpochParticipant* record = (ZyanEpochParticipant*)
+        ZyanAtomicLoadPointer(&domain->participants, ZYAN_MEMORY_ORDER_ACQUIRE);
+    for (; record; record = record->next)
+    {
+        ZyanU32 in_use = 0;
+        if (ZyanAtomicCompareExchange32(&record->in_use, &in_use, 1, ZYAN_MEMORY_ORDER_ACQUIRE,
+            ZYAN_MEMORY_ORDER_RELAXED))
+        {
+            *participant = record;
+            return ZYAN_STATUS_SUCCESS;
+        }
+    }
+
+    ZYAN_CHECK(domain->allocator->allocate(domain->allocator, (void**)&record,
+        sizeof(ZyanEpochParticipant), 1));
+    for (ZyanUSize i = 0; i < ZYAN_ARRAY_LENGTH(record->retired); ++i)
+    {
+        const ZyanStatus status = ZyanVectorInitEx(&record->retired[i],
+            sizeof(ZyanEpochRetiredBlock), ZYAN_EPOCH_COLLECT_THRESHOLD, domain->allocator, 2.0f,
+            0.0f);
+        if (!ZYAN_SUCCESS(status))
+        {
+            while (i--)
+            {
+                ZyanVectorDestroy(&record->retired[i]);
+            }
+            domain->allocator->deallocate(domain->allocator, record,
+                sizeof(ZyanEpochParticipant), 1);
+            return status;
+        }
+        record->retired_epoch[i] = 0;
+    }
+    ZyanAtomicStore64(&record->local_epoch, 0, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanAtomicStore32(&record->in_use, 1, ZYAN_MEMORY_ORDER_RELAXED);
+    record->nesting       = 0;
+    record->domain        = domain;
+    record->retired_count = 0;
+
+    // Records are never removed from the list, so a simple lock-free push is sufficient
+    void* head = ZyanAtomicLoadPointer(&domain->participants, ZYAN_MEMORY_ORDER_RELAXED);
+    do
+    {
+        record->next = (ZyanEpochParticipant*)head;
+    } while (!ZyanAtomicCompareExchangePointer(&domain->participants, &head, record,
+        ZYAN_MEMORY_ORDER_RELEASE, ZYAN_MEMORY_ORDER_RELAXED));
+
+    *participant = record;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanEpochDomainUnregister(ZyanEpochParticipant* participant)
+{
+    if (!participant || participant->nesting)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanStatus status = ZyanEpochCollect(participant);
+    ZyanAtomicStore32(&participant->in_use, 0, ZYAN_MEMORY_ORDER_RELEASE);
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Critical sections                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanEpochEnter(ZyanEpochParticipant* participant)
+{
+    if (!participant)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (participant->nesting++)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanU64 epoch = ZyanAtomicLoad64(&participant->domain->epoch,
+        ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanAtomicStore64(&participant->local_epoch, (epoch << 1) | ZYAN_EPOCH_ACTIVE,
+        ZYAN_MEMORY_ORDER_RELAXED);
+
+    // The announcement has to be visible before any shared pointer is loaded
+    ZyanAtomicThreadFence(ZYAN_MEMORY_ORDER_SEQ_CST);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanEpochLeave(ZyanEpochParticipant* participant)
+{
+    if (!participant || !participant->nesting)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (--participant->nesting)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanAtomicStore64(&participant->local_epoch, 0, ZYAN_MEMORY_ORDER_RELEASE);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Reclamation                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanEpochRetire(ZyanEpochParticipant* participant, ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    if (!participant || !allocator || !p)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Readers that entered their critical section before the block was unlinked observed this
+    // epoch or an older one
+    const ZyanU64 epoch = ZyanAtomicLoad64(&participant->domain->epoch,
+        ZYAN_MEMORY_ORDER_SEQ_CST);
+    const ZyanUSize index = (ZyanUSize)(epoch % ZYAN_ARRAY_LENGTH(participant->retired));
+    if (participant->retired_epoch[index] != epoch)
+    {
+        // The list contains blocks of an epoch that is at least three epochs old
+        if (participant->retired[index].size)
+        {
+            ZYAN_CHECK(ZyanEpochReleaseList(participant, index));
+        }
+        participant->retired_epoch[index] = epoch;
+    }
+
+    ZyanEpochRetiredBlock block;
+    block.allocator    = allocator;
+    block.p            = p;
+    block.element_size = element_size;
+    block.n            = n;
+    ZYAN_CHECK(ZyanVectorPush(&participant->retired[index], &block));
+
+    if (++participant->retired_count >= ZYAN_EPOCH_COLLECT_THRESHOLD)
+    {
+        return ZyanEpochCollect(participant);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanEpochCollect(ZyanEpochParticipant* participant)
+{
+    if (!participant)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU64 epoch = ZyanEpochTryAdvance(participant->domain);
+    return ZyanEpochReleaseExpired(participant, epoch);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
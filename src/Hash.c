@@ -0,0 +1,337 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Hash.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The primes used by the `XXH64` algorithm.
+ */
+#define ZYAN_HASH_PRIME1 ((ZyanU64)0x9E3779B185EBCA87)
+#define ZYAN_HASH_PRIME2 ((ZyanU64)0xC2B2AE3D27D4EB4F)
+#define ZYAN_HASH_PRIME3 ((ZyanU64)0x165667B19E3779F9)
+#define ZYAN_HASH_PRIME4 ((ZyanU64)0x85EBCA77C2B2AE63)
+#define ZYAN_HASH_PRIME5 ((ZyanU64)0x27D4EB2F165667C5)
+
+/**
+ * @brief   The size of a stripe that is processed by the four accumulator lanes at once.
+ */
+#define ZYAN_HASH_STRIPE_SIZE 32
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Rotates the given 64-bit value to the left.
+ *
+ * @param   x   The value.
+ * @param   r   The rotation count (from `1` to `63`).
+ *
+ * @return  The rotated value.
+ */
+#define ZYAN_HASH_ROTL64(x, r) \
+    (((x) << (r)) | ((x) >> (64 - (r))))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   Reads a 64-bit value in little endian byte order.
+ *
+ * @param   p   A pointer to the data.
+ *
+ * @return  The value.
+ *
+ * Compilers recognize this pattern and emit a single (unaligned) load on little endian targets.
+ */
+static ZyanU64 ZyanHashRead64(const ZyanU8* p)
+{
+    return  (ZyanU64)p[0]        | ((ZyanU64)p[1] <<  8) | ((ZyanU64)p[2] << 16) |
+           ((ZyanU64)p[3] << 24) | ((ZyanU64)p[4] << 32) | ((ZyanU64)p[5] << 40) |
+           ((ZyanU64)p[6] << 48) | ((ZyanU64)p[7] << 56);
+}
+
+/**
+ * @brief   Reads a 32-bit value in little endian byte order.
+ *
+ * @param   p   A pointer to the data.
+ *
+ * @return  The value.
+ */
+static ZyanU32 ZyanHashRead32(const ZyanU8* p)
+{
+    return  (ZyanU32)p[0]        | ((ZyanU32)p[1] <<  8) | ((ZyanU32)p[2] << 16) |
+           ((ZyanU32)p[3] << 24);
+}
+
+/**
+ * @brief   Mixes an 8-byte input word into an accumulator lane.
+ *
+ * @param   lane    The accumulator lane.
+ * @param   input   The input word.
+ *
+ * @return  The new accumulator value.
+ */
+static ZyanU64 ZyanHashRound(ZyanU64 lane, ZyanU64 input)
+{
+    lane += input * ZYAN_HASH_PRIME2;
+    lane  = ZYAN_HASH_ROTL64(lane, 31);
+    lane *= ZYAN_HASH_PRIME1;
+
+    return lane;
+}
+
+/**
+ * @brief   Merges an accumulator lane into the hash value.
+ *
+ * @param   hash    The hash value.
+ * @param   lane    The accumulator lane.
+ *
+ * @return  The new hash value.
+ */
+static ZyanU64 ZyanHashMergeRound(ZyanU64 hash, ZyanU64 lane)
+{
+    hash ^= ZyanHashRound(0, lane);
+    hash  = hash * ZYAN_HASH_PRIME1 + ZYAN_HASH_PRIME4;
+
+    return hash;
+}
+
+/**
+ * @brief   Processes all complete stripes of the given data.
+ *
+ * @param   lanes   The four accumulator lanes.
+ * @param   p       A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  A pointer to the first byte that was not processed.
+ *
+ * The four lanes are independent, which lets the CPU execute their multiplications in parallel.
+ */
+static const ZyanU8* ZyanHashStripes(ZyanU64 lanes[4], const ZyanU8* p, ZyanUSize size)
+{
+    ZyanU64 v1 = lanes[0];
+    ZyanU64 v2 = lanes[1];
+    ZyanU64 v3 = lanes[2];
+    ZyanU64 v4 = lanes[3];
+
+    const ZyanU8* const end = p + (size - size % ZYAN_HASH_STRIPE_SIZE);
+    for (; p < end; p += ZYAN_HASH_STRIPE_SIZE)
+    {
+        v1 = ZyanHashRound(v1, ZyanHashRead64(p +  0));
+        v2 = ZyanHashRound(v2, ZyanHashRead64(p +  8));
+        v3 = ZyanHashRound(v3, ZyanHashRead64(p + 16));
+        v4 = ZyanHashRound(v4, ZyanHashRead64(p + 24));
+    }
+
+    lanes[0] = v1;
+    lanes[1] = v2;
+    lanes[2] = v3;
+    lanes[3] = v4;
+
+    return p;
+}
+
+/**
+ * @brief   Initializes the accumulator lanes for the given seed.
+ *
+ * @param   lanes   The four accumulator lanes.
+ * @param   seed    The seed.
+ */
+static void ZyanHashInitLanes(ZyanU64 lanes[4], ZyanU64 seed)
+{
+    lanes[0] = seed + ZYAN_HASH_PRIME1 + ZYAN_HASH_PRIME2;
+    lanes[1] = seed + ZYAN_HASH_PRIME2;
+    lanes[2] = seed;
+    lanes[3] = seed - ZYAN_HASH_PRIME1;
+}
+
+/**
+ * @brief   Calculates the final hash value.
+ *
+ * @param   lanes   The four accumulator lanes or `ZYAN_NULL`, if less than one stripe was
+ *                  processed.
+ * @param   seed    The seed.
+ * @param   length  The total length of the input in bytes.
+ * @param   p       A pointer to the remaining input bytes.
+ * @param   size    The number of remaining input bytes (less than one stripe).
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 ZyanHashFinalize(const ZyanU64 lanes[4], ZyanU64 seed, ZyanU64 length,
+    const ZyanU8* p, ZyanUSize size)
+{
+    ZYAN_ASSERT(size < ZYAN_HASH_STRIPE_SIZE);
+
+    ZyanU64 hash;
+    if (lanes)
+    {
+        hash = ZYAN_HASH_ROTL64(lanes[0], 1) + ZYAN_HASH_ROTL64(lanes[1], 7) +
+            ZYAN_HASH_ROTL64(lanes[2], 12) + ZYAN_HASH_ROTL64(lanes[3], 18);
+        hash = ZyanHashMergeRound(hash, lanes[0]);
+        hash = ZyanHashMergeRound(hash, lanes[1]);
+        hash = ZyanHashMergeRound(hash, lanes[2]);
+        hash = ZyanHashMergeRound(hash, lanes[3]);
+    } else
+    {
+        hash = seed + ZYAN_HASH_PRIME5;
+    }
+    hash += length;
+
+    for (; size >= 8; size -= 8, p += 8)
+    {
+        hash ^= ZyanHashRound(0, ZyanHashRead64(p));
+        hash  = ZYAN_HASH_ROTL64(hash, 27) * ZYAN_HASH_PRIME1 + ZYAN_HASH_PRIME4;
+    }
+    if (size >= 4)
+    {
+        hash ^= (ZyanU64)ZyanHashRead32(p) * ZYAN_HASH_PRIME1;
+        hash  = ZYAN_HASH_ROTL64(hash, 23) * ZYAN_HASH_PRIME2 + ZYAN_HASH_PRIME3;
+        size -= 4;
+        p += 4;
+    }
+    for (; size; --size, ++p)
+    {
+        hash ^= *p * ZYAN_HASH_PRIME5;
+        hash  = ZYAN_HASH_ROTL64(hash, 11) * ZYAN_HASH_PRIME1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= ZYAN_HASH_PRIME2;
+    hash ^= hash >> 29;
+    hash *= ZYAN_HASH_PRIME3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Byte strings                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashBytes(const void* data, ZyanUSize size, ZyanU64 seed, ZyanU64* hash)
+{
+    if ((!data && size) || !hash)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* p = (const ZyanU8*)data;
+    if (size < ZYAN_HASH_STRIPE_SIZE)
+    {
+        *hash = ZyanHashFinalize(ZYAN_NULL, seed, size, p, size);
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanU64 lanes[4];
+    ZyanHashInitLanes(lanes, seed);
+    const ZyanU8* const tail = ZyanHashStripes(lanes, p, size);
+    *hash = ZyanHashFinalize(lanes, seed, size, tail, (ZyanUSize)(p + size - tail));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Streaming                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashInit(ZyanHashState* state, ZyanU64 seed)
+{
+    if (!state)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    state->seed = seed;
+    state->length = 0;
+    state->buffer_size = 0;
+    ZyanHashInitLanes(state->lanes, seed);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHashUpdate(ZyanHashState* state, const void* data, ZyanUSize size)
+{
+    if (!state || (!data && size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* p = (const ZyanU8*)data;
+    state->length += size;
+
+    // Complete a partially filled stripe first
+    if (state->buffer_size)
+    {
+        const ZyanUSize n = ZYAN_MIN(size, ZYAN_HASH_STRIPE_SIZE - state->buffer_size);
+        ZYAN_MEMCPY(state->buffer + state->buffer_size, p, n);
+        state->buffer_size += (ZyanU32)n;
+        p += n;
+        size -= n;
+        if (state->buffer_size < ZYAN_HASH_STRIPE_SIZE)
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+        ZyanHashStripes(state->lanes, state->buffer, ZYAN_HASH_STRIPE_SIZE);
+        state->buffer_size = 0;
+    }
+
+    const ZyanU8* const tail = ZyanHashStripes(state->lanes, p, size);
+    state->buffer_size = (ZyanU32)(p + size - tail);
+    if (state->buffer_size)
+    {
+        ZYAN_MEMCPY(state->buffer, tail, state->buffer_size);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHashFinal(const ZyanHashState* state, ZyanU64* hash)
+{
+    if (!state || !hash)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *hash = ZyanHashFinalize((state->length >= ZYAN_HASH_STRIPE_SIZE) ? state->lanes : ZYAN_NULL,
+        state->seed, state->length, state->buffer, state->buffer_size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,651 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/HyperLogLog.h>
+#include <Zycore/LibC.h>
+#include <Zycore/Internal/Hash.h>
+#include <Zycore/Internal/Math.h>
+
+#if (defined(ZYAN_X86) || defined(ZYAN_X64)) && !defined(ZYCORE_NO_LIBC) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    // `emmintrin.h` pulls in parts of the C runtime on some compilers
+#   define ZYAN_HYPER_LOG_LOG_SSE2
+#   include <emmintrin.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The version of the serialization format.
+ */
+#define ZYAN_HYPER_LOG_LOG_FORMAT_VERSION 1
+
+/**
+ * @brief   The size of the serialization header in bytes.
+ */
+#define ZYAN_HYPER_LOG_LOG_HEADER_SIZE 4
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the number of registers of the given sketch.
+ *
+ * @param   hll A pointer to the `ZyanHyperLogLog` instance.
+ *
+ * @return  The number of registers.
+ */
+#define ZYAN_HYPER_LOG_LOG_REGISTER_COUNT(hll) \
+    ((ZyanUSize)1 << (hll)->precision)
+
+/**
+ * @brief   Returns the maximum number of sparse entries before the sketch switches to the dense
+ *          representation.
+ *
+ * @param   hll A pointer to the `ZyanHyperLogLog` instance.
+ *
+ * @return  The maximum number of sparse entries.
+ */
+#define ZYAN_HYPER_LOG_LOG_SPARSE_LIMIT(hll) \
+    (ZYAN_HYPER_LOG_LOG_REGISTER_COUNT(hll) / 4)
+
+/**
+ * @brief   Encodes a sparse entry.
+ *
+ * @param   index   The register index.
+ * @param   value   The register value.
+ *
+ * @return  The sparse entry.
+ */
+#define ZYAN_HYPER_LOG_LOG_SPARSE_ENTRY(index, value) \
+    ((ZyanU32)(((ZyanU32)(index) << 8) | (ZyanU32)(value)))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Registers                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the maximum register value of the given sketch.
+ *
+ * @param   precision   The precision of the sketch.
+ *
+ * @return  The maximum register value.
+ */
+static ZyanU8 ZyanHyperLogLogMaxValue(ZyanU8 precision)
+{
+    return (ZyanU8)(64 - precision + 1);
+}
+
+/**
+ * @brief   Splits the given hash into a register index and value.
+ *
+ * @param   precision   The precision of the sketch.
+ * @param   hash        The hash of the element.
+ * @param   index       Receives the register index.
+ * @param   value       Receives the register value (the position of the leftmost set bit of the
+ *                      remaining hash bits).
+ */
+static void ZyanHyperLogLogSplitHash(ZyanU8 precision, ZyanU64 hash, ZyanUSize* index,
+    ZyanU8* value)
+{
+    ZYAN_ASSERT(index);
+    ZYAN_ASSERT(value);
+
+    *index = (ZyanUSize)(hash >> (64 - precision));
+
+    // The sentinel bit bounds the result to the maximum register value
+    ZyanU64 w = (hash << precision) | ((ZyanU64)1 << (precision - 1));
+    ZyanU8 zeros = 0;
+    if (!(w >> 32)) { zeros += 32; w <<= 32; }
+    if (!(w >> 48)) { zeros += 16; w <<= 16; }
+    if (!(w >> 56)) { zeros +=  8; w <<=  8; }
+    if (!(w >> 60)) { zeros +=  4; w <<=  4; }
+    if (!(w >> 62)) { zeros +=  2; w <<=  2; }
+    if (!(w >> 63)) { zeros +=  1; }
+
+    *value = zeros + 1;
+}
+
+/**
+ * @brief   Initializes the register vector of the given sketch with the sparse representation.
+ *
+ * @param   hll A pointer to the `ZyanHyperLogLog` instance.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanHyperLogLogInitSparse(ZyanHyperLogLog* hll)
+{
+    ZYAN_ASSERT(hll);
+
+    ZYAN_CHECK(ZyanVectorInitEx(&hll->registers, sizeof(ZyanU32), 0, hll->allocator, 2.0f,
+        0.0f));
+    hll->is_sparse = ZYAN_TRUE;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Initializes the given vector with the dense representation of a sketch with the
+ *          given precision.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   precision   The precision of the sketch.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanHyperLogLogInitDense(ZyanVector* vector, ZyanU8 precision,
+    ZyanAllocator* allocator)
+{
+    ZYAN_ASSERT(vector);
+
+    const ZyanUSize count = (ZyanUSize)1 << precision;
+    ZYAN_CHECK(ZyanVectorInitEx(vector, sizeof(ZyanU8), count, allocator, 1.0f, 0.0f));
+    ZYAN_CHECK(ZyanVectorResize(vector, count));
+    ZYAN_MEMSET(vector->data, 0, count);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Switches the given sketch to the dense representation.
+ *
+ * @param   hll A pointer to the `ZyanHyperLogLog` instance.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanHyperLogLogToDense(ZyanHyperLogLog* hll)
+{
+    ZYAN_ASSERT(hll);
+
+    if (!hll->is_sparse)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanVector dense;
+    ZYAN_CHECK(ZyanHyperLogLogInitDense(&dense, hll->precision, hll->allocator));
+
+    ZyanU8* const registers = (ZyanU8*)dense.data;
+    const ZyanU32* const entries = (const ZyanU32*)hll->registers.data;
+    for (ZyanUSize i = 0; i < hll->registers.size; ++i)
+    {
+        registers[entries[i] >> 8] = (ZyanU8)entries[i];
+    }
+
+    ZYAN_CHECK(ZyanVectorDestroy(&hll->registers));
+    hll->registers = dense;
+    hll->is_sparse = ZYAN_FALSE;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Raises the register with the given index to at least the given value.
+ *
+ * @param   hll     A pointer to the `ZyanHyperLogLog` instance.
+ * @param   index   The register index.
+ * @param   value   The register value.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanHyperLogLogUpdate(ZyanHyperLogLog* hll, ZyanUSize index, ZyanU8 value)
+{
+    ZYAN_ASSERT(hll);
+    ZYAN_ASSERT(index < ZYAN_HYPER_LOG_LOG_REGISTER_COUNT(hll));
+
+    if (!hll->is_sparse)
+    {
+        ZyanU8* const reg = (ZyanU8*)hll->registers.data + index;
+        if (*reg < value)
+        {
+            *reg = value;
+        }
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Binary search for the first entry with an index that is not less than `index`
+    ZyanU32* entries = (ZyanU32*)hll->registers.data;
+    ZyanUSize lo = 0;
+    ZyanUSize hi = hll->registers.size;
+    while (lo < hi)
+    {
+        const ZyanUSize mid = lo + (hi - lo) / 2;
+        if ((entries[mid] >> 8) < index)
+        {
+            lo = mid + 1;
+        } else
+        {
+            hi = mid;
+        }
+    }
+
+    if ((lo < hll->registers.size) && ((entries[lo] >> 8) == index))
+    {
+        if ((ZyanU8)entries[lo] < value)
+        {
+            entries[lo] = ZYAN_HYPER_LOG_LOG_SPARSE_ENTRY(index, value);
+        }
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    if (hll->registers.size >= ZYAN_HYPER_LOG_LOG_SPARSE_LIMIT(hll))
+    {
+        ZYAN_CHECK(ZyanHyperLogLogToDense(hll));
+        ((ZyanU8*)hll->registers.data)[index] = value;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanU32 entry = ZYAN_HYPER_LOG_LOG_SPARSE_ENTRY(index, value);
+    return ZyanVectorInsert(&hll->registers, lo, &entry);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Serialization                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Writes a 32-bit value in little endian byte order.
+ *
+ * @param   buffer  A pointer to the buffer.
+ * @param   value   The value.
+ */
+static void ZyanHyperLogLogWriteU32(ZyanU8* buffer, ZyanU32 value)
+{
+    ZYAN_ASSERT(buffer);
+
+    for (ZyanU32 i = 0; i < 4; ++i)
+    {
+        buffer[i] = (ZyanU8)(value >> (i * 8));
+    }
+}
+
+/**
+ * @brief   Reads a 32-bit value in little endian byte order.
+ *
+ * @param   buffer  A pointer to the buffer.
+ *
+ * @return  The value.
+ */
+static ZyanU32 ZyanHyperLogLogReadU32(const ZyanU8* buffer)
+{
+    ZYAN_ASSERT(buffer);
+
+    ZyanU32 value = 0;
+    for (ZyanU32 i = 0; i < 4; ++i)
+    {
+        value |= (ZyanU32)buffer[i] << (i * 8);
+    }
+
+    return value;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHyperLogLogInit(ZyanHyperLogLog* hll, ZyanU8 precision)
+{
+    return ZyanHyperLogLogInitEx(hll, precision, ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanHyperLogLogInitEx(ZyanHyperLogLog* hll, ZyanU8 precision, ZyanAllocator* allocator)
+{
+    if (!hll || (precision < ZYAN_HYPER_LOG_LOG_MIN_PRECISION) ||
+        (precision > ZYAN_HYPER_LOG_LOG_MAX_PRECISION) || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    hll->allocator = allocator;
+    hll->precision = precision;
+
+    return ZyanHyperLogLogInitSparse(hll);
+}
+
+ZyanStatus ZyanHyperLogLogDestroy(ZyanHyperLogLog* hll)
+{
+    if (!hll)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorDestroy(&hll->registers);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHyperLogLogAdd(ZyanHyperLogLog* hll, const void* element, ZyanUSize size)
+{
+    if (!hll || (!element && size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanHyperLogLogAddHash(hll, ZyanHashBytesValue(element, size));
+}
+
+ZyanStatus ZyanHyperLogLogAddHash(ZyanHyperLogLog* hll, ZyanU64 hash)
+{
+    if (!hll)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize index;
+    ZyanU8 value;
+    ZyanHyperLogLogSplitHash(hll->precision, hash, &index, &value);
+
+    return ZyanHyperLogLogUpdate(hll, index, value);
+}
+
+ZyanStatus ZyanHyperLogLogMerge(ZyanHyperLogLog* destination, const ZyanHyperLogLog* source)
+{
+    if (!destination || !source)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (destination->precision != source->precision)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+    if (destination == source)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    if (source->is_sparse)
+    {
+        const ZyanU32* const entries = (const ZyanU32*)source->registers.data;
+        for (ZyanUSize i = 0; i < source->registers.size; ++i)
+        {
+            ZYAN_CHECK(ZyanHyperLogLogUpdate(destination, entries[i] >> 8, (ZyanU8)entries[i]));
+        }
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_CHECK(ZyanHyperLogLogToDense(destination));
+
+    // The register count is a power of two not less than 16
+    ZyanU8* const dst = (ZyanU8*)destination->registers.data;
+    const ZyanU8* const src = (const ZyanU8*)source->registers.data;
+    const ZyanUSize count = ZYAN_HYPER_LOG_LOG_REGISTER_COUNT(destination);
+#ifdef ZYAN_HYPER_LOG_LOG_SSE2
+    for (ZyanUSize i = 0; i < count; i += 16)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(dst + i));
+        const __m128i b = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_max_epu8(a, b));
+    }
+#else
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        dst[i] = ZYAN_MAX(dst[i], src[i]);
+    }
+#endif
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHyperLogLogClear(ZyanHyperLogLog* hll)
+{
+    if (!hll)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (hll->is_sparse)
+    {
+        return ZyanVectorClear(&hll->registers);
+    }
+
+    ZYAN_CHECK(ZyanVectorDestroy(&hll->registers));
+    return ZyanHyperLogLogInitSparse(hll);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Estimation                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHyperLogLogEstimate(const ZyanHyperLogLog* hll, ZyanU64* count)
+{
+    if (!hll || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize m = ZYAN_HYPER_LOG_LOG_REGISTER_COUNT(hll);
+    ZyanUSize zeros;
+    double estimate;
+
+    if (hll->is_sparse)
+    {
+        // The sparse representation only exists while far less than `2.5 * m` elements were
+        // added, which is the range where linear counting is more accurate
+        zeros = m - hll->registers.size;
+        estimate = 0.0;
+    } else
+    {
+        const ZyanU8* const registers = (const ZyanU8*)hll->registers.data;
+        double sum = 0.0;
+        zeros = 0;
+        for (ZyanUSize i = 0; i < m; ++i)
+        {
+            sum += 1.0 / (double)((ZyanU64)1 << registers[i]);
+            zeros += !registers[i];
+        }
+
+        double alpha;
+        switch (m)
+        {
+        case 16:
+            alpha = 0.673;
+            break;
+        case 32:
+            alpha = 0.697;
+            break;
+        case 64:
+            alpha = 0.709;
+            break;
+        default:
+            alpha = 0.7213 / (1.0 + 1.079 / (double)m);
+            break;
+        }
+        estimate = alpha * (double)m * (double)m / sum;
+    }
+
+    if ((hll->is_sparse || (estimate <= 2.5 * (double)m)) && zeros)
+    {
+        estimate = (double)m * ZyanMathLog((double)m / (double)zeros);
+    }
+
+    *count = (ZyanU64)(estimate + 0.5);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Serialization                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHyperLogLogSerializedSize(const ZyanHyperLogLog* hll, ZyanUSize* size)
+{
+    if (!hll || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = ZYAN_HYPER_LOG_LOG_HEADER_SIZE + (hll->is_sparse
+        ? 4 + hll->registers.size * 4
+        : ZYAN_HYPER_LOG_LOG_REGISTER_COUNT(hll));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHyperLogLogSerialize(const ZyanHyperLogLog* hll, void* buffer, ZyanUSize capacity)
+{
+    if (!hll || !buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize size;
+    ZYAN_CHECK(ZyanHyperLogLogSerializedSize(hll, &size));
+    if (capacity < size)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    ZyanU8* p = (ZyanU8*)buffer;
+    p[0] = ZYAN_HYPER_LOG_LOG_FORMAT_VERSION;
+    p[1] = hll->precision;
+    p[2] = hll->is_sparse ? 1 : 0;
+    p[3] = 0;
+    p += ZYAN_HYPER_LOG_LOG_HEADER_SIZE;
+
+    if (hll->is_sparse)
+    {
+        const ZyanU32* const entries = (const ZyanU32*)hll->registers.data;
+        ZyanHyperLogLogWriteU32(p, (ZyanU32)hll->registers.size);
+        p += 4;
+        for (ZyanUSize i = 0; i < hll->registers.size; ++i, p += 4)
+        {
+            ZyanHyperLogLogWriteU32(p, entries[i]);
+        }
+    } else
+    {
+        ZYAN_MEMCPY(p, hll->registers.data, ZYAN_HYPER_LOG_LOG_REGISTER_COUNT(hll));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHyperLogLogDeserialize(ZyanHyperLogLog* hll, const void* buffer, ZyanUSize size,
+    ZyanAllocator* allocator)
+{
+    if (!hll || !buffer || !allocator || (size < ZYAN_HYPER_LOG_LOG_HEADER_SIZE))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* p = (const ZyanU8*)buffer;
+    const ZyanU8 precision = p[1];
+    const ZyanBool is_sparse = (p[2] == 1);
+    if ((p[0] != ZYAN_HYPER_LOG_LOG_FORMAT_VERSION) ||
+        (precision < ZYAN_HYPER_LOG_LOG_MIN_PRECISION) ||
+        (precision > ZYAN_HYPER_LOG_LOG_MAX_PRECISION) || (p[2] > 1) || p[3])
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    p += ZYAN_HYPER_LOG_LOG_HEADER_SIZE;
+    size -= ZYAN_HYPER_LOG_LOG_HEADER_SIZE;
+
+    const ZyanUSize m = (ZyanUSize)1 << precision;
+    const ZyanU8 max_value = ZyanHyperLogLogMaxValue(precision);
+
+    if (!is_sparse)
+    {
+        if (size != m)
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        for (ZyanUSize i = 0; i < m; ++i)
+        {
+            if (p[i] > max_value)
+            {
+                return ZYAN_STATUS_INVALID_ARGUMENT;
+            }
+        }
+
+        ZYAN_CHECK(ZyanHyperLogLogInitDense(&hll->registers, precision, allocator));
+        ZYAN_MEMCPY(hll->registers.data, p, m);
+        hll->allocator = allocator;
+        hll->precision = precision;
+        hll->is_sparse = ZYAN_FALSE;
+
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    if (size < 4)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    const ZyanUSize count = ZyanHyperLogLogReadU32(p);
+    p += 4;
+    size -= 4;
+    if ((count > m / 4) || (size != count * 4))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Entries must be sorted by strictly increasing register index and hold valid values
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        const ZyanU32 entry = ZyanHyperLogLogReadU32(p + i * 4);
+        const ZyanU8 value = (ZyanU8)entry;
+        if (((entry >> 8) >= m) || !value || (value > max_value) ||
+            (i && ((entry >> 8) <= (ZyanHyperLogLogReadU32(p + (i - 1) * 4) >> 8))))
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+    }
+
+    hll->allocator = allocator;
+    hll->precision = precision;
+    ZYAN_CHECK(ZyanHyperLogLogInitSparse(hll));
+    const ZyanStatus status = ZyanVectorResize(&hll->registers, count);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanVectorDestroy(&hll->registers);
+        return status;
+    }
+    ZyanU32* const entries = (ZyanU32*)hll->registers.data;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        entries[i] = ZyanHyperLogLogReadU32(p + i * 4);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,434 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/List.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns a pointer to the node pool used by the given list.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ *
+ * @return  A pointer to the node pool.
+ */
+#define ZYAN_LIST_POOL(list) \
+    ((list)->shared_pool ? (list)->shared_pool : &(list)->pool)
+
+/**
+ * @brief   Returns a pointer to the data of the given list node.
+ *
+ * @param   node    A pointer to the `ZyanListNode` struct.
+ *
+ * @return  A pointer to the data of the node.
+ */
+#define ZYAN_LIST_NODE_DATA(node) \
+    ((void*)((ZyanU8*)(node) + sizeof(ZyanListNode)))
+
+/**
+ * @brief   Returns the `ZyanListNode` struct that contains the given list link.
+ *
+ * @param   list_link   A pointer to the `ZyanIntrusiveListNode` struct or `ZYAN_NULL`.
+ *
+ * @return  A pointer to the `ZyanListNode` struct or `ZYAN_NULL`.
+ */
+#define ZYAN_LIST_NODE(list_link) \
+    ((list_link) ? ZYAN_INTRUSIVE_LIST_ENTRY(list_link, ZyanListNode, link) : ZYAN_NULL)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Allocates a new list node and initializes it with the given `element`.
+ *
+ * @param   list    A pointer to the `ZyanList` instance.
+ * @param   element A pointer to the element.
+ * @param   node    Receives a pointer to the new node.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanListAllocateNode(ZyanList* list, const void* element, ZyanListNode** node)
+{
+    ZYAN_ASSERT(list);
+    ZYAN_ASSERT(element);
+    ZYAN_ASSERT(node);
+
+    ZYAN_CHECK(ZyanPoolAllocate(ZYAN_LIST_POOL(list), (void**)node));
+    (*node)->link.prev = ZYAN_NULL;
+    (*node)->link.next = ZYAN_NULL;
+    ZYAN_MEMCPY(ZYAN_LIST_NODE_DATA(*node), element, list->element_size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanListInit(ZyanList* list, ZyanUSize element_size)
+{
+    if (!list || !element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    list->shared_pool  = ZYAN_NULL;
+    list->element_size = element_size;
+    ZyanIntrusiveListInit(&list->nodes);
+
+    return ZyanPoolInit(&list->pool, ZYAN_LIST_NODE_SIZE(element_size));
+}
+
+ZyanStatus ZyanListInitEx(ZyanList* list, ZyanUSize element_size, ZyanUSize slab_capacity,
+    ZyanAllocator* allocator)
+{
+    if (!list || !element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    list->shared_pool  = ZYAN_NULL;
+    list->element_size = element_size;
+    ZyanIntrusiveListInit(&list->nodes);
+
+    return ZyanPoolInitEx(&list->pool, ZYAN_LIST_NODE_SIZE(element_size), slab_capacity,
+        allocator);
+}
+
+ZyanStatus ZyanListInitPool(ZyanList* list, ZyanUSize element_size, ZyanPool* pool)
+{
+    if (!list || !element_size || !pool)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (pool->block_size < ZYAN_LIST_NODE_SIZE(element_size))
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    list->shared_pool  = pool;
+    list->element_size = element_size;
+    ZyanIntrusiveListInit(&list->nodes);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanListDestroy(ZyanList* list)
+{
+    if (!list)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (list->shared_pool)
+    {
+        return ZyanListClear(list);
+    }
+
+    // Releasing the slabs of an owned pool implicitly releases all nodes
+    ZyanIntrusiveListInit(&list->nodes);
+    return ZyanPoolDestroy(&list->pool);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Node access                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanListGetHeadNode(const ZyanList* list, ZyanListNode** node)
+{
+    if (!list || !node)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *node = ZYAN_LIST_NODE(list->nodes.head);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanListGetTailNode(const ZyanList* list, ZyanListNode** node)
+{
+    if (!list || !node)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *node = ZYAN_LIST_NODE(list->nodes.tail);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanListGetNextNode(ZyanListNode** node)
+{
+    if (ZYAN_UNLIKELY(!node || !*node))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *node = ZYAN_LIST_NODE((*node)->link.next);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanListGetPrevNode(ZyanListNode** node)
+{
+    if (ZYAN_UNLIKELY(!node || !*node))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *node = ZYAN_LIST_NODE((*node)->link.prev);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanListGetNodeData(const ZyanListNode* node, void** value)
+{
+    if (ZYAN_UNLIKELY(!node || !value))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *value = ZYAN_LIST_NODE_DATA(node);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanListPushBack(ZyanList* list, const void* element, ZyanListNode** node)
+{
+    return ZyanListInsertBefore(list, ZYAN_NULL, element, node);
+}
+
+ZyanStatus ZyanListPushFront(ZyanList* list, const void* element, ZyanListNode** node)
+{
+    if (ZYAN_UNLIKELY(!list))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanListInsertBefore(list, ZYAN_LIST_NODE(list->nodes.head), element, node);
+}
+
+ZyanStatus ZyanListPushBackElements(ZyanList* list, const void* elements, ZyanUSize count)
+{
+    if (!list || !elements || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Link the new nodes into a temporary list first to keep the list untouched on failure
+    ZyanIntrusiveList temp;
+    ZyanIntrusiveListInit(&temp);
+
+    const ZyanU8* element = (const ZyanU8*)elements;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ZyanListNode* node;
+        const ZyanStatus status = ZyanListAllocateNode(list, element, &node);
+        if (!ZYAN_SUCCESS(status))
+        {
+            ZyanIntrusiveListNode* link;
+            while ((link = ZyanIntrusiveListPopFront(&temp)) != ZYAN_NULL)
+            {
+                ZYAN_CHECK(ZyanPoolFree(ZYAN_LIST_POOL(list), ZYAN_LIST_NODE(link)));
+            }
+            return status;
+        }
+        ZyanIntrusiveListPushBack(&temp, &node->link);
+        element += list->element_size;
+    }
+
+    ZyanIntrusiveListSplice(&list->nodes, ZYAN_NULL, &temp);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanListInsertBefore(ZyanList* list, ZyanListNode* position, const void* element,
+    ZyanListNode** node)
+{
+    if (!list || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanListNode* new_node;
+    ZYAN_CHECK(ZyanListAllocateNode(list, element, &new_node));
+    ZyanIntrusiveListInsertBefore(&list->nodes, position ? &position->link : ZYAN_NULL,
+        &new_node->link);
+
+    if (node)
+    {
+        *node = new_node;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanListRemove(ZyanList* list, ZyanListNode* node)
+{
+    if (!list || !node)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanIntrusiveListRemove(&list->nodes, &node->link);
+
+    return ZyanPoolFree(ZYAN_LIST_POOL(list), node);
+}
+
+ZyanStatus ZyanListPopBack(ZyanList* list)
+{
+    if (ZYAN_UNLIKELY(!list))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(!list->nodes.tail))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    return ZyanListRemove(list, ZYAN_LIST_NODE(list->nodes.tail));
+}
+
+ZyanStatus ZyanListPopFront(ZyanList* list)
+{
+    if (ZYAN_UNLIKELY(!list))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(!list->nodes.head))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    return ZyanListRemove(list, ZYAN_LIST_NODE(list->nodes.head));
+}
+
+ZyanStatus ZyanListClear(ZyanList* list)
+{
+    if (!list)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanIntrusiveListNode* link = list->nodes.head;
+    while (link)
+    {
+        ZyanIntrusiveListNode* const next = link->next;
+        ZYAN_CHECK(ZyanPoolFree(ZYAN_LIST_POOL(list), ZYAN_LIST_NODE(link)));
+        link = next;
+    }
+    ZyanIntrusiveListInit(&list->nodes);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Reordering                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanListMoveToFront(ZyanList* list, ZyanListNode* node)
+{
+    if (!list || !node)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanIntrusiveListMoveToFront(&list->nodes, &node->link);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanListMoveToBack(ZyanList* list, ZyanListNode* node)
+{
+    if (!list || !node)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanIntrusiveListMoveToBack(&list->nodes, &node->link);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanListSplice(ZyanList* destination, ZyanList* source)
+{
+    if (!destination || !source || (destination == source))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!destination->shared_pool || (destination->shared_pool != source->shared_pool) ||
+        (destination->element_size != source->element_size))
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    ZyanIntrusiveListSplice(&destination->nodes, ZYAN_NULL, &source->nodes);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanListSize(const ZyanList* list, ZyanUSize* size)
+{
+    if (!list || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = list->nodes.size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
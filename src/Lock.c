@@ -0,0 +1,678 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Hash.h>
+#include <Zycore/Lock.h>
+#ifndef ZYCORE_NO_LIBC
+#   include <Zycore/Internal/Thread.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The number of times a lock is polled, before the calling thread blocks.
+ */
+#define ZYAN_LOCK_SPIN_COUNT                100
+
+/**
+ * @brief   The maximum number of threads served before a ticket lock waiter, for which the
+ *          waiter keeps spinning instead of yielding right away.
+ *
+ * Also caps the proportional pause between two polls of the ticket lock.
+ */
+#define ZYAN_TICKET_LOCK_MAX_SPIN_DISTANCE  4
+
+/**
+ * @brief   The writer bit of the `ZyanRWLock` state.
+ */
+#define ZYAN_RW_LOCK_WRITER                 0x80000000u
+
+/**
+ * @brief   Set in the `ZyanRWLock` state, if threads are waiting for the lock.
+ */
+#define ZYAN_RW_LOCK_WAITING                0x40000000u
+
+/**
+ * @brief   The mask of the reader count in the `ZyanRWLock` state.
+ */
+#define ZYAN_RW_LOCK_READERS                0x3FFFFFFFu
+
+/**
+ * @brief   The maximum number of reader slots of a `ZyanDistributedRWLock`.
+ */
+#define ZYAN_DISTRIBUTED_RW_LOCK_MAX_SLOTS  4096
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanDistributedRWLockSlot` union.
+ */
+typedef union ZyanDistributedRWLockSlot_
+{
+    /**
+     * @brief   The number of readers that use this slot.
+     */
+    ZyanAtomic32 readers;
+    /**
+     * @brief   Pads the slot to a whole cache line.
+     */
+    ZyanU8 padding[ZYAN_CACHE_LINE_SIZE];
+} ZyanDistributedRWLockSlot;
+
+/* ============================================================================================== */
+/* Internal variables                                                                             */
+/* ============================================================================================== */
+
+#ifndef ZYCORE_NO_LIBC
+
+/**
+ * @brief   A thread-local variable whose address identifies the current thread.
+ */
+static ZYAN_THREAD_LOCAL ZyanU8 zyan_lock_thread_anchor;
+
+#endif
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   Blocks the calling thread as long as the given variable contains the `expected` value.
+ *
+ * @param   address     A pointer to the `ZyanAtomic32` instance.
+ * @param   expected    The expected value.
+ */
+static void ZyanLockWait(ZyanAtomic32* address, ZyanU32 expected)
+{
+#ifndef ZYCORE_NO_LIBC
+    ZyanFutexWait(address, expected);
+#else
+    ZYAN_UNUSED(address);
+    ZYAN_UNUSED(expected);
+    ZyanAtomicPause();
+#endif
+}
+
+/**
+ * @brief   Wakes up threads that are blocked in `ZyanLockWait` on the given variable.
+ *
+ * @param   address     A pointer to the `ZyanAtomic32` instance.
+ * @param   all         `ZYAN_TRUE` to wake up all waiting threads or `ZYAN_FALSE` to wake up a
+ *                      single one.
+ */
+static void ZyanLockWake(ZyanAtomic32* address, ZyanBool all)
+{
+#ifndef ZYCORE_NO_LIBC
+    ZyanFutexWake(address, all);
+#else
+    ZYAN_UNUSED(address);
+    ZYAN_UNUSED(all);
+#endif
+}
+
+/**
+ * @brief   Spins until the given variable no longer contains the `expected` value or the spin
+ *          limit is reached.
+ *
+ * @param   address     A pointer to the `ZyanAtomic32` instance.
+ * @param   expected    The expected value.
+ *
+ * @return  The last value that was read.
+ */
+static ZyanU32 ZyanLockSpin(const ZyanAtomic32* address, ZyanU32 expected)
+{
+    ZyanU32 value = expected;
+    for (ZyanUSize i = 0; (i < ZYAN_LOCK_SPIN_COUNT) && (value == expected); ++i)
+    {
+        ZyanAtomicPause();
+        value = ZyanAtomicLoad32(address, ZYAN_MEMORY_ORDER_RELAXED);
+    }
+    return value;
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lock                                                                                           */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanLockInit(ZyanLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanAtomicStore32(&lock->state, 0, ZYAN_MEMORY_ORDER_RELAXED);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanLockAcquire(ZyanLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU32 state = 0;
+    if (ZyanAtomicCompareExchange32(&lock->state, &state, 1, ZYAN_MEMORY_ORDER_ACQUIRE,
+        ZYAN_MEMORY_ORDER_RELAXED))
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Spin while the owner is likely to release the lock soon
+    if (state == 1)
+    {
+        state = ZyanLockSpin(&lock->state, 1);
+        if ((state == 0) && ZyanAtomicCompareExchange32(&lock->state, &state, 1,
+            ZYAN_MEMORY_ORDER_ACQUIRE, ZYAN_MEMORY_ORDER_RELAXED))
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+    }
+
+    // Announce a waiting thread. The lock is kept in the contended state after it was acquired,
+    // as there might be more waiting threads.
+    if (state != 2)
+    {
+        state = ZyanAtomicExchange32(&lock->state, 2, ZYAN_MEMORY_ORDER_ACQUIRE);
+    }
+    while (state != 0)
+    {
+        ZyanLockWait(&lock->state, 2);
+        state = ZyanAtomicExchange32(&lock->state, 2, ZYAN_MEMORY_ORDER_ACQUIRE);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanLockTryAcquire(ZyanLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU32 state = 0;
+    return ZyanAtomicCompareExchange32(&lock->state, &state, 1, ZYAN_MEMORY_ORDER_ACQUIRE,
+        ZYAN_MEMORY_ORDER_RELAXED) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanLockRelease(ZyanLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (ZyanAtomicExchange32(&lock->state, 0, ZYAN_MEMORY_ORDER_RELEASE) == 2)
+    {
+        ZyanLockWake(&lock->state, ZYAN_FALSE);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Ticket lock                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanTicketLockInit(ZyanTicketLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanAtomicStore32(&lock->next, 0, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanAtomicStore32(&lock->owner, 0, ZYAN_MEMORY_ORDER_RELAXED);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanTicketLockAcquire(ZyanTicketLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU32 ticket = ZyanAtomicFetchAdd32(&lock->next, 1, ZYAN_MEMORY_ORDER_RELAXED);
+
+    ZyanUSize polls = 0;
+    for (;;)
+    {
+        const ZyanU32 owner = ZyanAtomicLoad32(&lock->owner, ZYAN_MEMORY_ORDER_ACQUIRE);
+        if (owner == ticket)
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+
+        const ZyanU32 distance = ticket - owner;
+#ifndef ZYCORE_NO_LIBC
+        // Give up the time slice early, as the threads served first might not be running at all
+        if ((distance > ZYAN_TICKET_LOCK_MAX_SPIN_DISTANCE) || (++polls >= ZYAN_LOCK_SPIN_COUNT))
+        {
+            ZyanThreadYield();
+            continue;
+        }
+#else
+        ZYAN_UNUSED(polls);
+#endif
+        // Back off proportionally to the number of threads that are served first
+        const ZyanU32 pauses = ZYAN_MIN(distance, ZYAN_TICKET_LOCK_MAX_SPIN_DISTANCE);
+        for (ZyanU32 i = pauses; i > 0; --i)
+        {
+            ZyanAtomicPause();
+        }
+    }
+}
+
+ZyanStatus ZyanTicketLockTryAcquire(ZyanTicketLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // The lock is free, if the next ticket would be served right away
+    ZyanU32 ticket = ZyanAtomicLoad32(&lock->owner, ZYAN_MEMORY_ORDER_ACQUIRE);
+    return ZyanAtomicCompareExchange32(&lock->next, &ticket, ticket + 1,
+        ZYAN_MEMORY_ORDER_ACQUIRE, ZYAN_MEMORY_ORDER_RELAXED)
+        ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanTicketLockRelease(ZyanTicketLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Only the owner modifies this field
+    const ZyanU32 owner = ZyanAtomicLoad32(&lock->owner, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanAtomicStore32(&lock->owner, owner + 1, ZYAN_MEMORY_ORDER_RELEASE);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Reader-writer lock                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRWLockInit(ZyanRWLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanAtomicStore32(&lock->state, 0, ZYAN_MEMORY_ORDER_RELAXED);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRWLockAcquireRead(ZyanRWLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU32 state = ZyanAtomicLoad32(&lock->state, ZYAN_MEMORY_ORDER_RELAXED);
+    for (;;)
+    {
+        if (!(state & (ZYAN_RW_LOCK_WRITER | ZYAN_RW_LOCK_WAITING)))
+        {
+            ZYAN_ASSERT((state & ZYAN_RW_LOCK_READERS) != ZYAN_RW_LOCK_READERS);
+            if (ZyanAtomicCompareExchange32(&lock->state, &state, state + 1,
+                ZYAN_MEMORY_ORDER_ACQUIRE, ZYAN_MEMORY_ORDER_RELAXED))
+            {
+                return ZYAN_STATUS_SUCCESS;
+            }
+            continue;
+        }
+
+        const ZyanU32 value = ZyanLockSpin(&lock->state, state);
+        if (value != state)
+        {
+            state = value;
+            continue;
+        }
+
+        // Make sure the thread that releases the lock knows that it has to wake us up
+        if (!(state & ZYAN_RW_LOCK_WAITING) &&
+            !ZyanAtomicCompareExchange32(&lock->state, &state, state | ZYAN_RW_LOCK_WAITING,
+                ZYAN_MEMORY_ORDER_RELAXED, ZYAN_MEMORY_ORDER_RELAXED))
+        {
+            continue;
+        }
+        ZyanLockWait(&lock->state, state | ZYAN_RW_LOCK_WAITING);
+        state = ZyanAtomicLoad32(&lock->state, ZYAN_MEMORY_ORDER_RELAXED);
+    }
+}
+
+ZyanStatus ZyanRWLockTryAcquireRead(ZyanRWLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU32 state = ZyanAtomicLoad32(&lock->state, ZYAN_MEMORY_ORDER_RELAXED);
+    while (!(state & (ZYAN_RW_LOCK_WRITER | ZYAN_RW_LOCK_WAITING)))
+    {
+        if (ZyanAtomicCompareExchange32(&lock->state, &state, state + 1,
+            ZYAN_MEMORY_ORDER_ACQUIRE, ZYAN_MEMORY_ORDER_RELAXED))
+        {
+            return ZYAN_STATUS_TRUE;
+        }
+    }
+
+    return ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanRWLockReleaseRead(ZyanRWLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU32 state = ZyanAtomicFetchSub32(&lock->state, 1, ZYAN_MEMORY_ORDER_RELEASE);
+    ZYAN_ASSERT(state & ZYAN_RW_LOCK_READERS);
+    if (((state & ZYAN_RW_LOCK_READERS) == 1) && (state & ZYAN_RW_LOCK_WAITING))
+    {
+        ZyanLockWake(&lock->state, ZYAN_TRUE);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRWLockAcquireWrite(ZyanRWLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU32 state = ZyanAtomicLoad32(&lock->state, ZYAN_MEMORY_ORDER_RELAXED);
+    for (;;)
+    {
+        if (!(state & (ZYAN_RW_LOCK_WRITER | ZYAN_RW_LOCK_READERS)))
+        {
+            // The waiting bit is preserved, as other threads might still be blocked on the lock.
+            // Releasing the write lock only wakes them up, if the bit is set
+            if (ZyanAtomicCompareExchange32(&lock->state, &state,
+                ZYAN_RW_LOCK_WRITER | (state & ZYAN_RW_LOCK_WAITING), ZYAN_MEMORY_ORDER_ACQUIRE,
+                ZYAN_MEMORY_ORDER_RELAXED))
+            {
+                return ZYAN_STATUS_SUCCESS;
+            }
+            continue;
+        }
+
+        // Block new readers, so that the active ones eventually drain
+        if (!(state & ZYAN_RW_LOCK_WAITING))
+        {
+            if (!ZyanAtomicCompareExchange32(&lock->state, &state, state | ZYAN_RW_LOCK_WAITING,
+                ZYAN_MEMORY_ORDER_RELAXED, ZYAN_MEMORY_ORDER_RELAXED))
+            {
+                continue;
+            }
+            state |= ZYAN_RW_LOCK_WAITING;
+        }
+
+        const ZyanU32 value = ZyanLockSpin(&lock->state, state);
+        if (value == state)
+        {
+            ZyanLockWait(&lock->state, state);
+            state = ZyanAtomicLoad32(&lock->state, ZYAN_MEMORY_ORDER_RELAXED);
+        } else
+        {
+            state = value;
+        }
+    }
+}
+
+ZyanStatus ZyanRWLockTryAcquireWrite(ZyanRWLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU32 state = ZyanAtomicLoad32(&lock->state, ZYAN_MEMORY_ORDER_RELAXED);
+    while (!(state & (ZYAN_RW_LOCK_WRITER | ZYAN_RW_LOCK_READERS)))
+    {
+        if (ZyanAtomicCompareExchange32(&lock->state, &state,
+            ZYAN_RW_LOCK_WRITER | (state & ZYAN_RW_LOCK_WAITING), ZYAN_MEMORY_ORDER_ACQUIRE,
+            ZYAN_MEMORY_ORDER_RELAXED))
+        {
+            return ZYAN_STATUS_TRUE;
+        }
+    }
+
+    return ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanRWLockReleaseWrite(ZyanRWLock* lock)
+{
+    if (!lock)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU32 state = ZyanAtomicExchange32(&lock->state, 0, ZYAN_MEMORY_ORDER_RELEASE);
+    ZYAN_ASSERT(state & ZYAN_RW_LOCK_WRITER);
+    if (state & ZYAN_RW_LOCK_WAITING)
+    {
+        ZyanLockWake(&lock->state, ZYAN_TRUE);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Distributed reader-writer lock                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanDistributedRWLockInit(ZyanDistributedRWLock* lock)
+{
+#ifndef ZYCORE_NO_LIBC
+    const ZyanUSize slot_count = 2 * ZyanThreadGetHardwareConcurrency();
+#else
+    const ZyanUSize slot_count = 64;
+#endif
+
+    return ZyanDistributedRWLockInitEx(lock,
+        ZYAN_MIN(slot_count, ZYAN_DISTRIBUTED_RW_LOCK_MAX_SLOTS), ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanDistributedRWLockInitEx(ZyanDistributedRWLock* lock, ZyanUSize slot_count,
+    ZyanAllocator* allocator)
+{
+    if (!lock || !slot_count || (slot_count > ZYAN_DISTRIBUTED_RW_LOCK_MAX_SLOTS) || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize count = 1;
+    while (count < slot_count)
+    {
+        count <<= 1;
+    }
+
+    void* buffer;
+    ZYAN_CHECK(allocator->allocate(allocator, &buffer, sizeof(ZyanU8),
+        (count + 1) * sizeof(ZyanDistributedRWLockSlot)));
+
+    ZyanDistributedRWLockSlot* const slots = (ZyanDistributedRWLockSlot*)(
+        ((ZyanUPointer)buffer + ZYAN_CACHE_LINE_SIZE - 1) &
+        ~(ZyanUPointer)(ZYAN_CACHE_LINE_SIZE - 1));
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ZyanAtomicStore32(&slots[i].readers, 0, ZYAN_MEMORY_ORDER_RELAXED);
+    }
+
+    lock->allocator  = allocator;
+    ZyanLockInit(&lock->writer_lock);
+    ZyanAtomicStore32(&lock->writer, 0, ZYAN_MEMORY_ORDER_RELAXED);
+    lock->slot_count = count;
+    lock->slots      = slots;
+    lock->buffer     = buffer;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDistributedRWLockDestroy(ZyanDistributedRWLock* lock)
+{
+    if (!lock || !lock->buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(lock->allocator->deallocate(lock->allocator, lock->buffer, sizeof(ZyanU8),
+        (lock->slot_count + 1) * sizeof(ZyanDistributedRWLockSlot)));
+    lock->buffer = ZYAN_NULL;
+    lock->slots  = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDistributedRWLockAcquireRead(ZyanDistributedRWLock* lock, ZyanUSize* slot)
+{
+    if (!lock || !lock->slots || !slot)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Threads are spread over the slots by the address of a thread-local variable (or of the
+    // current stack frame), which is cheaper than querying the current processor.
+#ifndef ZYCORE_NO_LIBC
+    const ZyanUPointer anchor = (ZyanUPointer)&zyan_lock_thread_anchor;
+#else
+    const ZyanUPointer anchor = (ZyanUPointer)&slot;
+#endif
+    const ZyanUSize index = (ZyanUSize)ZyanHashU64((ZyanU64)anchor) & (lock->slot_count - 1);
+    ZyanAtomic32* const readers = &((ZyanDistributedRWLockSlot*)lock->slots)[index].readers;
+
+    for (;;)
+    {
+        // Pairs with the sequentially consistent store and loads in the writer
+        ZyanAtomicFetchAdd32(readers, 1, ZYAN_MEMORY_ORDER_SEQ_CST);
+        if (!ZyanAtomicLoad32(&lock->writer, ZYAN_MEMORY_ORDER_SEQ_CST))
+        {
+            *slot = index;
+            return ZYAN_STATUS_SUCCESS;
+        }
+        ZyanAtomicFetchSub32(readers, 1, ZYAN_MEMORY_ORDER_RELEASE);
+
+        // Wait for the writer and make sure it knows that it has to wake us up
+        ZyanU32 writer = ZyanLockSpin(&lock->writer, 1);
+        while (writer)
+        {
+            if ((writer == 2) || ZyanAtomicCompareExchange32(&lock->writer, &writer, 2,
+                ZYAN_MEMORY_ORDER_RELAXED, ZYAN_MEMORY_ORDER_RELAXED))
+            {
+                ZyanLockWait(&lock->writer, 2);
+                writer = ZyanAtomicLoad32(&lock->writer, ZYAN_MEMORY_ORDER_RELAXED);
+            }
+        }
+    }
+}
+
+ZyanStatus ZyanDistributedRWLockReleaseRead(ZyanDistributedRWLock* lock, ZyanUSize slot)
+{
+    if (!lock || !lock->slots || (slot >= lock->slot_count))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanAtomicFetchSub32(&((ZyanDistributedRWLockSlot*)lock->slots)[slot].readers, 1,
+        ZYAN_MEMORY_ORDER_RELEASE);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDistributedRWLockAcquireWrite(ZyanDistributedRWLock* lock)
+{
+    if (!lock || !lock->slots)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanLockAcquire(&lock->writer_lock));
+    ZyanAtomicStore32(&lock->writer, 1, ZYAN_MEMORY_ORDER_SEQ_CST);
+
+    ZyanDistributedRWLockSlot* const slots = (ZyanDistributedRWLockSlot*)lock->slots;
+    for (ZyanUSize i = 0; i < lock->slot_count; ++i)
+    {
+        ZyanUSize polls = 0;
+        while (ZyanAtomicLoad32(&slots[i].readers, ZYAN_MEMORY_ORDER_SEQ_CST))
+        {
+            ZyanAtomicPause();
+#ifndef ZYCORE_NO_LIBC
+            if (++polls >= ZYAN_LOCK_SPIN_COUNT)
+            {
+                ZyanThreadYield();
+            }
+#else
+            ZYAN_UNUSED(polls);
+#endif
+        }
+    }
+    ZyanAtomicThreadFence(ZYAN_MEMORY_ORDER_ACQUIRE);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDistributedRWLockReleaseWrite(ZyanDistributedRWLock* lock)
+{
+    if (!lock || !lock->slots)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (ZyanAtomicExchange32(&lock->writer, 0, ZYAN_MEMORY_ORDER_RELEASE) == 2)
+    {
+        ZyanLockWake(&lock->writer, ZYAN_TRUE);
+    }
+
+    return ZyanLockRelease(&lock->writer_lock);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,208 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Pool.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+#define ZYAN_POOL_SLAB_SIZE         4096
+#define ZYAN_POOL_MIN_SLAB_CAPACITY 8
+
+/**
+ * @brief   The size of the slab header that links all slabs of a pool.
+ *
+ * The header is padded to preserve the alignment of the first block.
+ */
+#define ZYAN_POOL_SLAB_HEADER_SIZE \
+    (2 * sizeof(void*))
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the total size of a single slab in bytes.
+ *
+ * @param   pool    A pointer to the `ZyanPool` instance.
+ *
+ * @return  The total size of a single slab in bytes.
+ */
+#define ZYAN_POOL_SLAB_BYTES(pool) \
+    (ZYAN_POOL_SLAB_HEADER_SIZE + (pool)->block_size * (pool)->slab_capacity)
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPoolInit(ZyanPool* pool, ZyanUSize block_size)
+{
+    return ZyanPoolInitEx(pool, block_size,
+        ZYAN_MAX(ZYAN_POOL_MIN_SLAB_CAPACITY, ZYAN_POOL_SLAB_SIZE / (block_size ? block_size : 1)),
+        ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanPoolInitEx(ZyanPool* pool, ZyanUSize block_size, ZyanUSize slab_capacity,
+    ZyanAllocator* allocator)
+{
+    if (!pool || !block_size || !slab_capacity || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Every block must be able to hold the free-list link and keep the next block aligned
+    block_size = (block_size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+    pool->allocator     = allocator;
+    pool->block_size    = block_size;
+    pool->slab_capacity = slab_capacity;
+    pool->slabs         = ZYAN_NULL;
+    pool->free_list     = ZYAN_NULL;
+    pool->unused        = ZYAN_NULL;
+    pool->unused_end    = ZYAN_NULL;
+    pool->size          = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPoolDestroy(ZyanPool* pool)
+{
+    if (!pool)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    void* slab = pool->slabs;
+    while (slab)
+    {
+        void* const next = *(void**)slab;
+        ZYAN_CHECK(pool->allocator->deallocate(pool->allocator, slab, ZYAN_POOL_SLAB_BYTES(pool),
+            1));
+        slab = next;
+    }
+
+    pool->slabs      = ZYAN_NULL;
+    pool->free_list  = ZYAN_NULL;
+    pool->unused     = ZYAN_NULL;
+    pool->unused_end = ZYAN_NULL;
+    pool->size       = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocation                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPoolAllocate(ZyanPool* pool, void** block)
+{
+    if (ZYAN_UNLIKELY(!pool || !block))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (ZYAN_LIKELY(pool->free_list))
+    {
+        *block = pool->free_list;
+        pool->free_list = *(void**)pool->free_list;
+        ++pool->size;
+
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    if (ZYAN_UNLIKELY(pool->unused == pool->unused_end))
+    {
+        void* slab;
+        ZYAN_CHECK(pool->allocator->allocate(pool->allocator, &slab, ZYAN_POOL_SLAB_BYTES(pool),
+            1));
+
+        *(void**)slab    = pool->slabs;
+        pool->slabs      = slab;
+        pool->unused     = (ZyanU8*)slab + ZYAN_POOL_SLAB_HEADER_SIZE;
+        pool->unused_end = pool->unused + pool->block_size * pool->slab_capacity;
+    }
+
+    // Blocks of a new slab are handed out sequentially instead of threading the whole slab into
+    // the free-list up front
+    *block = pool->unused;
+    pool->unused += pool->block_size;
+    ++pool->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPoolFree(ZyanPool* pool, void* block)
+{
+    if (ZYAN_UNLIKELY(!pool || !block))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(pool->size);
+
+    *(void**)block = pool->free_list;
+    pool->free_list = block;
+    --pool->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPoolBlockSize(const ZyanPool* pool, ZyanUSize* block_size)
+{
+    if (!pool || !block_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *block_size = pool->block_size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPoolSize(const ZyanPool* pool, ZyanUSize* size)
+{
+    if (!pool || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = pool->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,444 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/PriorityQueue.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+#define ZYAN_PRIORITY_QUEUE_ARITY            4
+#define ZYAN_PRIORITY_QUEUE_GROWTH_FACTOR    2.00f
+#define ZYAN_PRIORITY_QUEUE_SHRINK_THRESHOLD 0.25f
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the offset of the element at the given `index`.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ * @param   index   The element index.
+ *
+ * @return  The offset of the element at the given `index`.
+ */
+#define ZYAN_PRIORITY_QUEUE_OFFSET(queue, index) \
+    ((void*)((ZyanU8*)(queue)->vector.data + ((index) * (queue)->vector.element_size)))
+
+/**
+ * @brief   Returns the index of the parent of the node at the given `index`.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ * @param   index   The node index (must not be `0`).
+ *
+ * @return  The index of the parent node.
+ */
+#define ZYAN_PRIORITY_QUEUE_PARENT(queue, index) \
+    (((index) - 1) / (queue)->arity)
+
+/**
+ * @brief   Returns the index of the first child of the node at the given `index`.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ * @param   index   The node index.
+ *
+ * @return  The index of the first child node.
+ */
+#define ZYAN_PRIORITY_QUEUE_FIRST_CHILD(queue, index) \
+    ((index) * (queue)->arity + 1)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Swaps the contents of two memory blocks.
+ *
+ * @param   a       A pointer to the first memory block.
+ * @param   b       A pointer to the second memory block.
+ * @param   size    The size of the memory blocks in bytes.
+ */
+static void ZyanPriorityQueueSwap(void* a, void* b, ZyanUSize size)
+{
+    ZYAN_ASSERT(a);
+    ZYAN_ASSERT(b);
+
+    ZyanU8 temp[32];
+    ZyanU8* pa = (ZyanU8*)a;
+    ZyanU8* pb = (ZyanU8*)b;
+    while (size)
+    {
+        const ZyanUSize n = ZYAN_MIN(size, sizeof(temp));
+        ZYAN_MEMCPY(temp, pa, n);
+        ZYAN_MEMCPY(pa, pb, n);
+        ZYAN_MEMCPY(pb, temp, n);
+        pa += n;
+        pb += n;
+        size -= n;
+    }
+}
+
+/**
+ * @brief   Moves the element at the given `index` up, until the heap property is restored.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ * @param   index   The element index.
+ */
+static void ZyanPriorityQueueSiftUp(ZyanPriorityQueue* queue, ZyanUSize index)
+{
+    ZYAN_ASSERT(queue);
+    ZYAN_ASSERT(queue->comparison);
+    ZYAN_ASSUME(queue->arity >= 2);
+
+    while (index > 0)
+    {
+        const ZyanUSize parent = ZYAN_PRIORITY_QUEUE_PARENT(queue, index);
+        void* const element = ZYAN_PRIORITY_QUEUE_OFFSET(queue, index);
+        void* const p = ZYAN_PRIORITY_QUEUE_OFFSET(queue, parent);
+        if (queue->comparison(element, p) >= 0)
+        {
+            break;
+        }
+        ZyanPriorityQueueSwap(element, p, queue->vector.element_size);
+        index = parent;
+    }
+}
+
+/**
+ * @brief   Moves the element at the given `index` down, until the heap property is restored.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ * @param   index   The element index.
+ */
+static void ZyanPriorityQueueSiftDown(ZyanPriorityQueue* queue, ZyanUSize index)
+{
+    ZYAN_ASSERT(queue);
+    ZYAN_ASSERT(queue->comparison);
+    ZYAN_ASSUME(queue->arity >= 2);
+
+    const ZyanUSize size = queue->vector.size;
+    for (;;)
+    {
+        const ZyanUSize first = ZYAN_PRIORITY_QUEUE_FIRST_CHILD(queue, index);
+        if (first >= size)
+        {
+            break;
+        }
+
+        // Find the child with the highest priority. All children of a node are stored in adjacent
+        // memory
+        const ZyanUSize last = ZYAN_MIN(first + queue->arity, size);
+        ZyanUSize best = first;
+        for (ZyanUSize i = first + 1; i < last; ++i)
+        {
+            if (queue->comparison(ZYAN_PRIORITY_QUEUE_OFFSET(queue, i),
+                ZYAN_PRIORITY_QUEUE_OFFSET(queue, best)) < 0)
+            {
+                best = i;
+            }
+        }
+
+        void* const element = ZYAN_PRIORITY_QUEUE_OFFSET(queue, index);
+        void* const child = ZYAN_PRIORITY_QUEUE_OFFSET(queue, best);
+        if (queue->comparison(child, element) >= 0)
+        {
+            break;
+        }
+        ZyanPriorityQueueSwap(element, child, queue->vector.element_size);
+        index = best;
+    }
+}
+
+/**
+ * @brief   Rearranges all elements of the queue to satisfy the heap property.
+ *
+ * @param   queue   A pointer to the `ZyanPriorityQueue` instance.
+ */
+static void ZyanPriorityQueueHeapify(ZyanPriorityQueue* queue)
+{
+    ZYAN_ASSERT(queue);
+
+    const ZyanUSize size = queue->vector.size;
+    if (size < 2)
+    {
+        return;
+    }
+
+    ZyanUSize i = ZYAN_PRIORITY_QUEUE_PARENT(queue, size - 1) + 1;
+    while (i--)
+    {
+        ZyanPriorityQueueSiftDown(queue, i);
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPriorityQueueInit(ZyanPriorityQueue* queue, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanComparison comparison)
+{
+    return ZyanPriorityQueueInitEx(queue, element_size, capacity, comparison,
+        ZYAN_PRIORITY_QUEUE_ARITY, ZyanAllocatorDefault(), ZYAN_PRIORITY_QUEUE_GROWTH_FACTOR,
+        ZYAN_PRIORITY_QUEUE_SHRINK_THRESHOLD);
+}
+
+ZyanStatus ZyanPriorityQueueInitEx(ZyanPriorityQueue* queue, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanComparison comparison, ZyanUSize arity, ZyanAllocator* allocator,
+    float growth_factor, float shrink_threshold)
+{
+    if (!queue || !comparison || (arity < 2))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    queue->comparison = comparison;
+    queue->arity      = arity;
+
+    return ZyanVectorInitEx(&queue->vector, element_size, capacity, allocator, growth_factor,
+        shrink_threshold);
+}
+
+ZyanStatus ZyanPriorityQueueInitBuffer(ZyanPriorityQueue* queue, ZyanUSize element_size,
+    void* buffer, ZyanUSize capacity, ZyanComparison comparison, ZyanUSize arity)
+{
+    if (!queue || !comparison || (arity < 2))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    queue->comparison = comparison;
+    queue->arity      = arity;
+
+    return ZyanVectorInitBuffer(&queue->vector, element_size, buffer, capacity);
+}
+
+ZyanStatus ZyanPriorityQueueInitVector(ZyanPriorityQueue* queue, ZyanVector* vector,
+    ZyanComparison comparison, ZyanUSize arity)
+{
+    if (!queue || !vector || !comparison || (arity < 2))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    queue->vector     = *vector;
+    queue->comparison = comparison;
+    queue->arity      = arity;
+
+    ZyanPriorityQueueHeapify(queue);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPriorityQueueDestroy(ZyanPriorityQueue* queue)
+{
+    if (!queue)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorDestroy(&queue->vector);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPriorityQueueTop(const ZyanPriorityQueue* queue, const void** element)
+{
+    if (ZYAN_UNLIKELY(!queue))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorGetConst(&queue->vector, 0, element);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPriorityQueuePush(ZyanPriorityQueue* queue, const void* element)
+{
+    if (ZYAN_UNLIKELY(!queue))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanVectorPush(&queue->vector, element));
+    ZyanPriorityQueueSiftUp(queue, queue->vector.size - 1);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPriorityQueuePushElements(ZyanPriorityQueue* queue, const void* elements,
+    ZyanUSize count)
+{
+    if (!queue)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize size = queue->vector.size;
+    ZYAN_CHECK(ZyanVectorInsertElements(&queue->vector, size, elements, count));
+
+    // Sifting up `k` elements costs `O(k * log(n))`, while rebuilding the heap costs `O(n)`
+    if (count > size / 8)
+    {
+        ZyanPriorityQueueHeapify(queue);
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    for (ZyanUSize i = size; i < size + count; ++i)
+    {
+        ZyanPriorityQueueSiftUp(queue, i);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPriorityQueuePop(ZyanPriorityQueue* queue, void* element)
+{
+    if (ZYAN_UNLIKELY(!queue))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(queue->vector.size == 0))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    void* const top = ZYAN_PRIORITY_QUEUE_OFFSET(queue, 0);
+    if (element)
+    {
+        ZYAN_MEMCPY(element, top, queue->vector.element_size);
+    }
+
+    const ZyanUSize last = queue->vector.size - 1;
+    if (last > 0)
+    {
+        ZYAN_MEMCPY(top, ZYAN_PRIORITY_QUEUE_OFFSET(queue, last), queue->vector.element_size);
+    }
+    ZYAN_CHECK(ZyanVectorPop(&queue->vector));
+    ZyanPriorityQueueSiftDown(queue, 0);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPriorityQueueReplaceTop(ZyanPriorityQueue* queue, const void* element)
+{
+    if (ZYAN_UNLIKELY(!queue || !element))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(queue->vector.size == 0))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZYAN_MEMCPY(ZYAN_PRIORITY_QUEUE_OFFSET(queue, 0), element, queue->vector.element_size);
+    ZyanPriorityQueueSiftDown(queue, 0);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPriorityQueueClear(ZyanPriorityQueue* queue)
+{
+    if (!queue)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorClear(&queue->vector);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPriorityQueueReserve(ZyanPriorityQueue* queue, ZyanUSize capacity)
+{
+    if (!queue)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorReserve(&queue->vector, capacity);
+}
+
+ZyanStatus ZyanPriorityQueueShrinkToFit(ZyanPriorityQueue* queue)
+{
+    if (!queue)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorShrinkToFit(&queue->vector);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPriorityQueueSize(const ZyanPriorityQueue* queue, ZyanUSize* size)
+{
+    if (!queue)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorSize(&queue->vector, size);
+}
+
+ZyanStatus ZyanPriorityQueueCapacity(const ZyanPriorityQueue* queue, ZyanUSize* capacity)
+{
+    if (!queue)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorCapacity(&queue->vector, capacity);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,1565 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/RadixTree.h>
+
+#if (defined(ZYAN_X86) || defined(ZYAN_X64)) && !defined(ZYCORE_NO_LIBC) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    // `emmintrin.h` pulls in parts of the C runtime on some compilers
+#   define ZYAN_RADIX_TREE_SSE2
+#   include <emmintrin.h>
+#   if defined(ZYAN_MSVC)
+#       include <intrin.h>
+#   endif
+#endif
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The number of prefix bytes that are stored inline in every inner node.
+ *
+ * Longer prefixes are compared optimistically and verified against the full key stored in the
+ * leaf.
+ */
+#define ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH 12
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanRadixTreeNodeType` enum.
+ */
+typedef enum ZyanRadixTreeNodeType_
+{
+    ZYAN_RADIX_TREE_NODE4,
+    ZYAN_RADIX_TREE_NODE16,
+    ZYAN_RADIX_TREE_NODE48,
+    ZYAN_RADIX_TREE_NODE256
+} ZyanRadixTreeNodeType;
+
+/**
+ * @brief   Defines the `ZyanRadixTreeLeaf` struct.
+ *
+ * The leaf header is followed by the value and the key bytes.
+ */
+typedef struct ZyanRadixTreeLeaf_
+{
+    /**
+     * @brief   The length of the key in bytes.
+     */
+    ZyanUSize key_length;
+} ZyanRadixTreeLeaf;
+
+/**
+ * @brief   Defines the `ZyanRadixTreeNode` struct.
+ *
+ * This struct is the header of every inner node. Child pointers with the lowest bit set point to
+ * leaves.
+ */
+typedef struct ZyanRadixTreeNode_
+{
+    /**
+     * @brief   The leaf for the key that ends at this node or `ZYAN_NULL`.
+     */
+    ZyanRadixTreeLeaf* leaf;
+    /**
+     * @brief   The length of the compressed path.
+     */
+    ZyanUSize prefix_length;
+    /**
+     * @brief   The number of children.
+     */
+    ZyanU16 count;
+    /**
+     * @brief   The node type.
+     */
+    ZyanU8 type;
+    /**
+     * @brief   The first bytes of the compressed path.
+     */
+    ZyanU8 prefix[ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH];
+} ZyanRadixTreeNode;
+
+/**
+ * @brief   Defines the `ZyanRadixTreeNode4` struct.
+ */
+typedef struct ZyanRadixTreeNode4_
+{
+    ZyanRadixTreeNode header;
+    ZyanU8 keys[4];
+    void* children[4];
+} ZyanRadixTreeNode4;
+
+/**
+ * @brief   Defines the `ZyanRadixTreeNode16` struct.
+ */
+typedef struct ZyanRadixTreeNode16_
+{
+    ZyanRadixTreeNode header;
+    ZyanU8 keys[16];
+    void* children[16];
+} ZyanRadixTreeNode16;
+
+/**
+ * @brief   Defines the `ZyanRadixTreeNode48` struct.
+ *
+ * The `index` array maps every key byte to the child slot plus one or to `0`.
+ */
+typedef struct ZyanRadixTreeNode48_
+{
+    ZyanRadixTreeNode header;
+    ZyanU8 index[256];
+    void* children[48];
+} ZyanRadixTreeNode48;
+
+/**
+ * @brief   Defines the `ZyanRadixTreeNode256` struct.
+ */
+typedef struct ZyanRadixTreeNode256_
+{
+    ZyanRadixTreeNode header;
+    void* children[256];
+} ZyanRadixTreeNode256;
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Checks, if the given child pointer points to a leaf.
+ */
+#define ZYAN_RADIX_TREE_IS_LEAF(child) \
+    (((ZyanUPointer)(child)) & 1)
+
+/**
+ * @brief   Converts a tagged child pointer to a leaf pointer.
+ */
+#define ZYAN_RADIX_TREE_LEAF(child) \
+    ((ZyanRadixTreeLeaf*)((ZyanUPointer)(child) & ~(ZyanUPointer)1))
+
+/**
+ * @brief   Converts a leaf pointer to a tagged child pointer.
+ */
+#define ZYAN_RADIX_TREE_TAG_LEAF(leaf) \
+    ((void*)((ZyanUPointer)(leaf) | 1))
+
+/**
+ * @brief   Returns a pointer to the value of the given leaf.
+ */
+#define ZYAN_RADIX_TREE_LEAF_VALUE(leaf) \
+    ((ZyanU8*)(leaf) + sizeof(ZyanRadixTreeLeaf))
+
+/**
+ * @brief   Returns a pointer to the key of the given leaf.
+ */
+#define ZYAN_RADIX_TREE_LEAF_KEY(tree, leaf) \
+    (ZYAN_RADIX_TREE_LEAF_VALUE(leaf) + (tree)->value_size)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Leaves                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Allocates a new leaf.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key in bytes.
+ * @param   value   A pointer to the value.
+ * @param   leaf    Receives a pointer to the new leaf.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanRadixTreeCreateLeaf(ZyanRadixTree* tree, const ZyanU8* key,
+    ZyanUSize length, const void* value, ZyanRadixTreeLeaf** leaf)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(leaf);
+
+    ZYAN_CHECK(tree->allocator->allocate(tree->allocator, (void**)leaf,
+        sizeof(ZyanRadixTreeLeaf) + tree->value_size + length, 1));
+    ZYAN_ASSERT(!ZYAN_RADIX_TREE_IS_LEAF(*leaf));
+
+    (*leaf)->key_length = length;
+    if (tree->value_size)
+    {
+        ZYAN_MEMCPY(ZYAN_RADIX_TREE_LEAF_VALUE(*leaf), value, tree->value_size);
+    }
+    if (length)
+    {
+        ZYAN_MEMCPY(ZYAN_RADIX_TREE_LEAF_KEY(tree, *leaf), key, length);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Deallocates the given `leaf`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   leaf    A pointer to the leaf.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanRadixTreeFreeLeaf(ZyanRadixTree* tree, ZyanRadixTreeLeaf* leaf)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(leaf);
+
+    return tree->allocator->deallocate(tree->allocator, leaf,
+        sizeof(ZyanRadixTreeLeaf) + tree->value_size + leaf->key_length, 1);
+}
+
+/**
+ * @brief   Checks, if the given `leaf` holds the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   leaf    A pointer to the leaf.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key in bytes.
+ *
+ * @return  `ZYAN_TRUE`, if the keys are equal or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanRadixTreeLeafMatches(const ZyanRadixTree* tree, const ZyanRadixTreeLeaf* leaf,
+    const ZyanU8* key, ZyanUSize length)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(leaf);
+
+    return (leaf->key_length == length) &&
+        (!length || !ZYAN_MEMCMP(ZYAN_RADIX_TREE_LEAF_KEY(tree, leaf), key, length));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Inner nodes                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the size of an inner node of the given `type`.
+ *
+ * @param   type    The node type.
+ *
+ * @return  The size of the node in bytes.
+ */
+static ZyanUSize ZyanRadixTreeNodeSize(ZyanU8 type)
+{
+    static const ZyanUSize sizes[] =
+    {
+        sizeof(ZyanRadixTreeNode4),
+        sizeof(ZyanRadixTreeNode16),
+        sizeof(ZyanRadixTreeNode48),
+        sizeof(ZyanRadixTreeNode256)
+    };
+    ZYAN_ASSERT(type < ZYAN_ARRAY_LENGTH(sizes));
+
+    return sizes[type];
+}
+
+/**
+ * @brief   Allocates a new inner node of the given `type`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   type    The node type.
+ * @param   node    Receives a pointer to the new node.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanRadixTreeAllocateNode(ZyanRadixTree* tree, ZyanRadixTreeNodeType type,
+    ZyanRadixTreeNode** node)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+
+    const ZyanUSize size = ZyanRadixTreeNodeSize((ZyanU8)type);
+    ZYAN_CHECK(tree->allocator->allocate(tree->allocator, (void**)node, size, 1));
+    ZYAN_MEMSET(*node, 0, size);
+    (*node)->type = (ZyanU8)type;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Deallocates the given inner `node`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   node    A pointer to the node.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanRadixTreeFreeNode(ZyanRadixTree* tree, ZyanRadixTreeNode* node)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+
+    return tree->allocator->deallocate(tree->allocator, node, ZyanRadixTreeNodeSize(node->type),
+        1);
+}
+
+/**
+ * @brief   Copies the header of one inner node to another.
+ *
+ * @param   destination A pointer to the destination node.
+ * @param   source      A pointer to the source node.
+ */
+static void ZyanRadixTreeCopyHeader(ZyanRadixTreeNode* destination,
+    const ZyanRadixTreeNode* source)
+{
+    ZYAN_ASSERT(destination);
+    ZYAN_ASSERT(source);
+
+    destination->leaf          = source->leaf;
+    destination->prefix_length = source->prefix_length;
+    destination->count         = source->count;
+    ZYAN_MEMCPY(destination->prefix, source->prefix, ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH);
+}
+
+/**
+ * @brief   Returns the child slot for the given key `byte`.
+ *
+ * @param   node    A pointer to the inner node.
+ * @param   byte    The key byte.
+ *
+ * @return  A pointer to the child slot or `ZYAN_NULL`, if the node has no such child.
+ */
+static void** ZyanRadixTreeFindChild(ZyanRadixTreeNode* node, ZyanU8 byte)
+{
+    ZYAN_ASSERT(node);
+
+    switch (node->type)
+    {
+    case ZYAN_RADIX_TREE_NODE4:
+    {
+        ZyanRadixTreeNode4* const n = (ZyanRadixTreeNode4*)node;
+        for (ZyanUSize i = 0; i < node->count; ++i)
+        {
+            if (n->keys[i] == byte)
+            {
+                return &n->children[i];
+            }
+        }
+        return ZYAN_NULL;
+    }
+    case ZYAN_RADIX_TREE_NODE16:
+    {
+        ZyanRadixTreeNode16* const n = (ZyanRadixTreeNode16*)node;
+#ifdef ZYAN_RADIX_TREE_SSE2
+        // Compare all 16 keys at once and mask out the unused slots
+        const __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8((char)byte),
+            _mm_loadu_si128((const __m128i*)n->keys));
+        const unsigned int mask =
+            (unsigned int)_mm_movemask_epi8(cmp) & ((1u << node->count) - 1);
+        if (!mask)
+        {
+            return ZYAN_NULL;
+        }
+#   if defined(ZYAN_MSVC)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return &n->children[index];
+#   else
+        return &n->children[__builtin_ctz(mask)];
+#   endif
+#else
+        for (ZyanUSize i = 0; i < node->count; ++i)
+        {
+            if (n->keys[i] == byte)
+            {
+                return &n->children[i];
+            }
+        }
+        return ZYAN_NULL;
+#endif
+    }
+    case ZYAN_RADIX_TREE_NODE48:
+    {
+        ZyanRadixTreeNode48* const n = (ZyanRadixTreeNode48*)node;
+        return n->index[byte] ? &n->children[n->index[byte] - 1] : ZYAN_NULL;
+    }
+    case ZYAN_RADIX_TREE_NODE256:
+    {
+        ZyanRadixTreeNode256* const n = (ZyanRadixTreeNode256*)node;
+        return n->children[byte] ? &n->children[byte] : ZYAN_NULL;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * @brief   Returns the child with the smallest key byte.
+ *
+ * @param   node    A pointer to the inner node.
+ *
+ * @return  The child pointer or `ZYAN_NULL`, if the node has no children.
+ */
+static void* ZyanRadixTreeFirstChild(const ZyanRadixTreeNode* node)
+{
+    ZYAN_ASSERT(node);
+
+    if (!node->count)
+    {
+        return ZYAN_NULL;
+    }
+
+    switch (node->type)
+    {
+    case ZYAN_RADIX_TREE_NODE4:
+        return ((const ZyanRadixTreeNode4*)node)->children[0];
+    case ZYAN_RADIX_TREE_NODE16:
+        return ((const ZyanRadixTreeNode16*)node)->children[0];
+    case ZYAN_RADIX_TREE_NODE48:
+    {
+        const ZyanRadixTreeNode48* const n = (const ZyanRadixTreeNode48*)node;
+        for (ZyanUSize i = 0; i < 256; ++i)
+        {
+            if (n->index[i])
+            {
+                return n->children[n->index[i] - 1];
+            }
+        }
+        break;
+    }
+    case ZYAN_RADIX_TREE_NODE256:
+    {
+        const ZyanRadixTreeNode256* const n = (const ZyanRadixTreeNode256*)node;
+        for (ZyanUSize i = 0; i < 256; ++i)
+        {
+            if (n->children[i])
+            {
+                return n->children[i];
+            }
+        }
+        break;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    ZYAN_UNREACHABLE;
+}
+
+/**
+ * @brief   Returns the leaf with the smallest key in the given subtree.
+ *
+ * @param   child   A (tagged) child pointer.
+ *
+ * @return  A pointer to the leaf.
+ */
+static ZyanRadixTreeLeaf* ZyanRadixTreeMinimum(const void* child)
+{
+    ZYAN_ASSERT(child);
+
+    while (!ZYAN_RADIX_TREE_IS_LEAF(child))
+    {
+        const ZyanRadixTreeNode* const node = (const ZyanRadixTreeNode*)child;
+        if (node->leaf)
+        {
+            return node->leaf;
+        }
+        child = ZyanRadixTreeFirstChild(node);
+        ZYAN_ASSERT(child);
+    }
+
+    return ZYAN_RADIX_TREE_LEAF(child);
+}
+
+/**
+ * @brief   Returns the number of leading bytes of the compressed path of the given `node` that
+ *          match the `key` at the given `depth`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   node    A pointer to the inner node.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key in bytes.
+ * @param   depth   The current depth.
+ *
+ * @return  The number of matching bytes.
+ */
+static ZyanUSize ZyanRadixTreePrefixMismatch(const ZyanRadixTree* tree,
+    const ZyanRadixTreeNode* node, const ZyanU8* key, ZyanUSize length, ZyanUSize depth)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(node);
+    ZYAN_ASSERT(depth <= length);
+
+    const ZyanUSize limit = ZYAN_MIN(node->prefix_length, length - depth);
+    const ZyanUSize stored = ZYAN_MIN(limit, ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH);
+    ZyanUSize i = 0;
+    for (; i < stored; ++i)
+    {
+        if (node->prefix[i] != key[depth + i])
+        {
+            return i;
+        }
+    }
+    if (limit > ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH)
+    {
+        // The remaining bytes are only stored in the leaves
+        const ZyanU8* const leaf_key =
+            ZYAN_RADIX_TREE_LEAF_KEY(tree, ZyanRadixTreeMinimum(node));
+        for (; i < limit; ++i)
+        {
+            if (leaf_key[depth + i] != key[depth + i])
+            {
+                return i;
+            }
+        }
+    }
+
+    return i;
+}
+
+/**
+ * @brief   Checks the inline bytes of the compressed path of the given `node`.
+ *
+ * @param   node    A pointer to the inner node.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key in bytes.
+ * @param   depth   The current depth.
+ *
+ * @return  `ZYAN_TRUE`, if the inline bytes match or `ZYAN_FALSE`, if not.
+ *
+ * This check is optimistic. The caller has to compare the full key against the leaf.
+ */
+static ZyanBool ZyanRadixTreeCheckPrefix(const ZyanRadixTreeNode* node, const ZyanU8* key,
+    ZyanUSize length, ZyanUSize depth)
+{
+    ZYAN_ASSERT(node);
+
+    if (node->prefix_length > length - depth)
+    {
+        return ZYAN_FALSE;
+    }
+    const ZyanUSize stored = ZYAN_MIN(node->prefix_length, ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH);
+    return !stored || !ZYAN_MEMCMP(node->prefix, key + depth, stored);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Node modification                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Adds a `child` for the given key `byte`, growing the node if required.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   ref     A pointer to the slot that references the node.
+ * @param   byte    The key byte.
+ * @param   child   The (tagged) child pointer.
+ *
+ * @return  A zycore status code. The node is left untouched, if an error occured.
+ */
+static ZyanStatus ZyanRadixTreeAddChild(ZyanRadixTree* tree, void** ref, ZyanU8 byte, void* child)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(ref);
+    ZYAN_ASSERT(child);
+
+    ZyanRadixTreeNode* const node = (ZyanRadixTreeNode*)*ref;
+    switch (node->type)
+    {
+    case ZYAN_RADIX_TREE_NODE4:
+    case ZYAN_RADIX_TREE_NODE16:
+    {
+        const ZyanUSize capacity = (node->type == ZYAN_RADIX_TREE_NODE4) ? 4 : 16;
+        ZyanU8* const keys = (node->type == ZYAN_RADIX_TREE_NODE4)
+            ? ((ZyanRadixTreeNode4*)node)->keys
+            : ((ZyanRadixTreeNode16*)node)->keys;
+        void** const children = (node->type == ZYAN_RADIX_TREE_NODE4)
+            ? ((ZyanRadixTreeNode4*)node)->children
+            : ((ZyanRadixTreeNode16*)node)->children;
+
+        if (node->count < capacity)
+        {
+            // Keep the keys sorted to allow for in-order iteration
+            ZyanUSize i = 0;
+            while ((i < node->count) && (keys[i] < byte))
+            {
+                ++i;
+            }
+            ZYAN_MEMMOVE(&keys[i + 1], &keys[i], node->count - i);
+            ZYAN_MEMMOVE(&children[i + 1], &children[i], (node->count - i) * sizeof(void*));
+            keys[i] = byte;
+            children[i] = child;
+            ++node->count;
+            return ZYAN_STATUS_SUCCESS;
+        }
+
+        ZyanRadixTreeNode* grown;
+        if (node->type == ZYAN_RADIX_TREE_NODE4)
+        {
+            ZYAN_CHECK(ZyanRadixTreeAllocateNode(tree, ZYAN_RADIX_TREE_NODE16, &grown));
+            ZyanRadixTreeNode16* const n = (ZyanRadixTreeNode16*)grown;
+            ZYAN_MEMCPY(n->keys, keys, capacity);
+            ZYAN_MEMCPY(n->children, children, capacity * sizeof(void*));
+        } else
+        {
+            ZYAN_CHECK(ZyanRadixTreeAllocateNode(tree, ZYAN_RADIX_TREE_NODE48, &grown));
+            ZyanRadixTreeNode48* const n = (ZyanRadixTreeNode48*)grown;
+            for (ZyanUSize i = 0; i < capacity; ++i)
+            {
+                n->index[keys[i]] = (ZyanU8)(i + 1);
+                n->children[i] = children[i];
+            }
+        }
+        ZyanRadixTreeCopyHeader(grown, node);
+        *ref = grown;
+        ZYAN_CHECK(ZyanRadixTreeFreeNode(tree, node));
+        return ZyanRadixTreeAddChild(tree, ref, byte, child);
+    }
+    case ZYAN_RADIX_TREE_NODE48:
+    {
+        ZyanRadixTreeNode48* const n = (ZyanRadixTreeNode48*)node;
+        if (node->count < 48)
+        {
+            ZyanUSize i = 0;
+            while (n->children[i])
+            {
+                ++i;
+            }
+            n->index[byte] = (ZyanU8)(i + 1);
+            n->children[i] = child;
+            ++node->count;
+            return ZYAN_STATUS_SUCCESS;
+        }
+
+        ZyanRadixTreeNode* grown;
+        ZYAN_CHECK(ZyanRadixTreeAllocateNode(tree, ZYAN_RADIX_TREE_NODE256, &grown));
+        for (ZyanUSize i = 0; i < 256; ++i)
+        {
+            if (n->index[i])
+            {
+                ((ZyanRadixTreeNode256*)grown)->children[i] = n->children[n->index[i] - 1];
+            }
+        }
+        ZyanRadixTreeCopyHeader(grown, node);
+        *ref = grown;
+        ZYAN_CHECK(ZyanRadixTreeFreeNode(tree, node));
+        return ZyanRadixTreeAddChild(tree, ref, byte, child);
+    }
+    case ZYAN_RADIX_TREE_NODE256:
+    {
+        ((ZyanRadixTreeNode256*)node)->children[byte] = child;
+        ++node->count;
+        return ZYAN_STATUS_SUCCESS;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * @brief   Removes the child for the given key `byte`.
+ *
+ * @param   node    A pointer to the inner node.
+ * @param   byte    The key byte.
+ */
+static void ZyanRadixTreeRemoveChild(ZyanRadixTreeNode* node, ZyanU8 byte)
+{
+    ZYAN_ASSERT(node);
+
+    switch (node->type)
+    {
+    case ZYAN_RADIX_TREE_NODE4:
+    case ZYAN_RADIX_TREE_NODE16:
+    {
+        ZyanU8* const keys = (node->type == ZYAN_RADIX_TREE_NODE4)
+            ? ((ZyanRadixTreeNode4*)node)->keys
+            : ((ZyanRadixTreeNode16*)node)->keys;
+        void** const children = (node->type == ZYAN_RADIX_TREE_NODE4)
+            ? ((ZyanRadixTreeNode4*)node)->children
+            : ((ZyanRadixTreeNode16*)node)->children;
+        ZyanUSize i = 0;
+        while (keys[i] != byte)
+        {
+            ++i;
+            ZYAN_ASSERT(i < node->count);
+        }
+        ZYAN_MEMMOVE(&keys[i], &keys[i + 1], node->count - i - 1);
+        ZYAN_MEMMOVE(&children[i], &children[i + 1], (node->count - i - 1) * sizeof(void*));
+        keys[node->count - 1] = 0;
+        break;
+    }
+    case ZYAN_RADIX_TREE_NODE48:
+    {
+        ZyanRadixTreeNode48* const n = (ZyanRadixTreeNode48*)node;
+        ZYAN_ASSERT(n->index[byte]);
+        n->children[n->index[byte] - 1] = ZYAN_NULL;
+        n->index[byte] = 0;
+        break;
+    }
+    case ZYAN_RADIX_TREE_NODE256:
+        ZYAN_ASSERT(((ZyanRadixTreeNode256*)node)->children[byte]);
+        ((ZyanRadixTreeNode256*)node)->children[byte] = ZYAN_NULL;
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+    --node->count;
+}
+
+/**
+ * @brief   Replaces an inner node by a smaller node type, collapses it into its only child or
+ *          removes it, if possible.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   ref     A pointer to the slot that references the node.
+ *
+ * @return  A zycore status code.
+ *
+ * Nodes are shrunk with some hysteresis to avoid repeated growing and shrinking. A failed
+ * allocation is not an error, the node just keeps its current type in this case. The slot is
+ * set to `ZYAN_NULL`, if the node neither has children nor a leaf.
+ */
+static ZyanStatus ZyanRadixTreeShrink(ZyanRadixTree* tree, void** ref)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(ref);
+
+    ZyanRadixTreeNode* const node = (ZyanRadixTreeNode*)*ref;
+    if (!node->count)
+    {
+        // The leaf stores the full key, so it can directly replace the node. A node without a
+        // leaf is only left behind, if an earlier shrink failed to allocate the smaller node. It
+        // is removed and the caller drops the cleared slot from the parent
+        *ref = node->leaf ? ZYAN_RADIX_TREE_TAG_LEAF(node->leaf) : ZYAN_NULL;
+        return ZyanRadixTreeFreeNode(tree, node);
+    }
+
+    ZyanRadixTreeNode* shrunk;
+    switch (node->type)
+    {
+    case ZYAN_RADIX_TREE_NODE4:
+    {
+        ZyanRadixTreeNode4* const n = (ZyanRadixTreeNode4*)node;
+        if ((node->count > 1) || node->leaf)
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+
+        // Merge the compressed path of this node, the key byte and the compressed path of the
+        // only child
+        void* const child = n->children[0];
+        if (!ZYAN_RADIX_TREE_IS_LEAF(child))
+        {
+            ZyanRadixTreeNode* const c = (ZyanRadixTreeNode*)child;
+            ZyanUSize length = node->prefix_length;
+            if (length < ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH)
+            {
+                node->prefix[length++] = n->keys[0];
+            }
+            if (length < ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH)
+            {
+                const ZyanUSize count =
+                    ZYAN_MIN(c->prefix_length, ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH - length);
+                ZYAN_MEMCPY(&node->prefix[length], c->prefix, count);
+                length += count;
+            }
+            ZYAN_MEMCPY(c->prefix, node->prefix,
+                ZYAN_MIN(length, ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH));
+            c->prefix_length += node->prefix_length + 1;
+        }
+        *ref = child;
+        return ZyanRadixTreeFreeNode(tree, node);
+    }
+    case ZYAN_RADIX_TREE_NODE16:
+    {
+        if (node->count >= 3)
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+        if (!ZYAN_SUCCESS(ZyanRadixTreeAllocateNode(tree, ZYAN_RADIX_TREE_NODE4, &shrunk)))
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+        const ZyanRadixTreeNode16* const n = (const ZyanRadixTreeNode16*)node;
+        ZyanRadixTreeNode4* const s = (ZyanRadixTreeNode4*)shrunk;
+        ZYAN_MEMCPY(s->keys, n->keys, node->count);
+        ZYAN_MEMCPY(s->children, n->children, node->count * sizeof(void*));
+        break;
+    }
+    case ZYAN_RADIX_TREE_NODE48:
+    {
+        if (node->count >= 12)
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+        if (!ZYAN_SUCCESS(ZyanRadixTreeAllocateNode(tree, ZYAN_RADIX_TREE_NODE16, &shrunk)))
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+        const ZyanRadixTreeNode48* const n = (const ZyanRadixTreeNode48*)node;
+        ZyanRadixTreeNode16* const s = (ZyanRadixTreeNode16*)shrunk;
+        ZyanUSize j = 0;
+        for (ZyanUSize i = 0; i < 256; ++i)
+        {
+            if (n->index[i])
+            {
+                s->keys[j] = (ZyanU8)i;
+                s->children[j++] = n->children[n->index[i] - 1];
+            }
+        }
+        break;
+    }
+    case ZYAN_RADIX_TREE_NODE256:
+    {
+        if (node->count >= 37)
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+        if (!ZYAN_SUCCESS(ZyanRadixTreeAllocateNode(tree, ZYAN_RADIX_TREE_NODE48, &shrunk)))
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+        const ZyanRadixTreeNode256* const n = (const ZyanRadixTreeNode256*)node;
+        ZyanRadixTreeNode48* const s = (ZyanRadixTreeNode48*)shrunk;
+        ZyanUSize j = 0;
+        for (ZyanUSize i = 0; i < 256; ++i)
+        {
+            if (n->children[i])
+            {
+                s->index[i] = (ZyanU8)(j + 1);
+                s->children[j++] = n->children[i];
+            }
+        }
+        break;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    ZyanRadixTreeCopyHeader(shrunk, node);
+    *ref = shrunk;
+    return ZyanRadixTreeFreeNode(tree, node);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Recursive operations                                                                           */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Inserts or updates the entry for the given `key` in the given subtree.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   ref     A pointer to the slot that references the subtree.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key in bytes.
+ * @param   depth   The current depth.
+ * @param   value   A pointer to the value.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanRadixTreeInsertRecursive(ZyanRadixTree* tree, void** ref,
+    const ZyanU8* key, ZyanUSize length, ZyanUSize depth, const void* value)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(ref);
+    ZYAN_ASSERT(depth <= length);
+
+    ZyanRadixTreeLeaf* leaf;
+    if (!*ref)
+    {
+        ZYAN_CHECK(ZyanRadixTreeCreateLeaf(tree, key, length, value, &leaf));
+        *ref = ZYAN_RADIX_TREE_TAG_LEAF(leaf);
+        ++tree->size;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    if (ZYAN_RADIX_TREE_IS_LEAF(*ref))
+    {
+        ZyanRadixTreeLeaf* const existing = ZYAN_RADIX_TREE_LEAF(*ref);
+        if (ZyanRadixTreeLeafMatches(tree, existing, key, length))
+        {
+            if (tree->value_size)
+            {
+                ZYAN_MEMCPY(ZYAN_RADIX_TREE_LEAF_VALUE(existing), value, tree->value_size);
+            }
+            return ZYAN_STATUS_SUCCESS;
+        }
+
+        // Replace the leaf by a new node that holds the longest common prefix of both keys
+        const ZyanU8* const existing_key = ZYAN_RADIX_TREE_LEAF_KEY(tree, existing);
+        ZYAN_ASSERT(existing->key_length >= depth);
+        const ZyanUSize limit = ZYAN_MIN(existing->key_length, length) - depth;
+        ZyanUSize common = 0;
+        while ((common < limit) && (existing_key[depth + common] == key[depth + common]))
+        {
+            ++common;
+        }
+
+        ZYAN_CHECK(ZyanRadixTreeCreateLeaf(tree, key, length, value, &leaf));
+        void* node;
+        const ZyanStatus status =
+            ZyanRadixTreeAllocateNode(tree, ZYAN_RADIX_TREE_NODE4, (ZyanRadixTreeNode**)&node);
+        if (!ZYAN_SUCCESS(status))
+        {
+            ZYAN_CHECK(ZyanRadixTreeFreeLeaf(tree, leaf));
+            return status;
+        }
+        ZyanRadixTreeNode* const n = (ZyanRadixTreeNode*)node;
+        n->prefix_length = common;
+        ZYAN_MEMCPY(n->prefix, key + depth, ZYAN_MIN(common, ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH));
+
+        // Both keys differ, so at most one of them ends at the new node
+        depth += common;
+        if (existing->key_length == depth)
+        {
+            n->leaf = existing;
+        } else
+        {
+            ZYAN_CHECK(ZyanRadixTreeAddChild(tree, &node, existing_key[depth], *ref));
+        }
+        if (length == depth)
+        {
+            n->leaf = leaf;
+        } else
+        {
+            ZYAN_CHECK(ZyanRadixTreeAddChild(tree, &node, key[depth],
+                ZYAN_RADIX_TREE_TAG_LEAF(leaf)));
+        }
+        *ref = node;
+        ++tree->size;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanRadixTreeNode* const node = (ZyanRadixTreeNode*)*ref;
+    if (node->prefix_length)
+    {
+        const ZyanUSize common = ZyanRadixTreePrefixMismatch(tree, node, key, length, depth);
+        if (common < node->prefix_length)
+        {
+            // Split the compressed path at the first mismatching byte
+            ZYAN_CHECK(ZyanRadixTreeCreateLeaf(tree, key, length, value, &leaf));
+            void* parent;
+            const ZyanStatus status = ZyanRadixTreeAllocateNode(tree, ZYAN_RADIX_TREE_NODE4,
+                (ZyanRadixTreeNode**)&parent);
+            if (!ZYAN_SUCCESS(status))
+            {
+                ZYAN_CHECK(ZyanRadixTreeFreeLeaf(tree, leaf));
+                return status;
+            }
+            ZyanRadixTreeNode* const p = (ZyanRadixTreeNode*)parent;
+            p->prefix_length = common;
+            ZYAN_MEMCPY(p->prefix, key + depth,
+                ZYAN_MIN(common, ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH));
+
+            ZyanU8 byte;
+            if (node->prefix_length <= ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH)
+            {
+                byte = node->prefix[common];
+                node->prefix_length -= common + 1;
+                // Bounded by the array instead of the prefix length, so the compiler can prove
+                // that the shift stays inside `prefix`. Bytes past the prefix length are unused.
+                for (ZyanUSize i = common + 1; i < ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH; ++i)
+                {
+                    node->prefix[i - common - 1] = node->prefix[i];
+                }
+            } else
+            {
+                const ZyanU8* const leaf_key =
+                    ZYAN_RADIX_TREE_LEAF_KEY(tree, ZyanRadixTreeMinimum(node));
+                byte = leaf_key[depth + common];
+                node->prefix_length -= common + 1;
+                ZYAN_MEMCPY(node->prefix, leaf_key + depth + common + 1,
+                    ZYAN_MIN(node->prefix_length, ZYAN_RADIX_TREE_MAX_PREFIX_LENGTH));
+            }
+            ZYAN_CHECK(ZyanRadixTreeAddChild(tree, &parent, byte, node));
+
+            if (length == depth + common)
+            {
+                p->leaf = leaf;
+            } else
+            {
+                ZYAN_CHECK(ZyanRadixTreeAddChild(tree, &parent, key[depth + common],
+                    ZYAN_RADIX_TREE_TAG_LEAF(leaf)));
+            }
+            *ref = parent;
+            ++tree->size;
+            return ZYAN_STATUS_SUCCESS;
+        }
+        depth += node->prefix_length;
+    }
+
+    if (depth == length)
+    {
+        if (node->leaf)
+        {
+            if (tree->value_size)
+            {
+                ZYAN_MEMCPY(ZYAN_RADIX_TREE_LEAF_VALUE(node->leaf), value, tree->value_size);
+            }
+            return ZYAN_STATUS_SUCCESS;
+        }
+        ZYAN_CHECK(ZyanRadixTreeCreateLeaf(tree, key, length, value, &node->leaf));
+        ++tree->size;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    void** const slot = ZyanRadixTreeFindChild(node, key[depth]);
+    if (slot)
+    {
+        return ZyanRadixTreeInsertRecursive(tree, slot, key, length, depth + 1, value);
+    }
+
+    ZYAN_CHECK(ZyanRadixTreeCreateLeaf(tree, key, length, value, &leaf));
+    const ZyanStatus status =
+        ZyanRadixTreeAddChild(tree, ref, key[depth], ZYAN_RADIX_TREE_TAG_LEAF(leaf));
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZYAN_CHECK(ZyanRadixTreeFreeLeaf(tree, leaf));
+        return status;
+    }
+    ++tree->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   Removes the entry for the given `key` from the given subtree.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   ref     A pointer to the slot that references the subtree.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key in bytes.
+ * @param   depth   The current depth.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the entry was removed or `ZYAN_STATUS_FALSE`, if the key was not
+ *          found. Another zycore status code, if an error occured.
+ */
+static ZyanStatus ZyanRadixTreeRemoveRecursive(ZyanRadixTree* tree, void** ref,
+    const ZyanU8* key, ZyanUSize length, ZyanUSize depth)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(ref);
+    ZYAN_ASSERT(*ref);
+
+    if (ZYAN_RADIX_TREE_IS_LEAF(*ref))
+    {
+        ZyanRadixTreeLeaf* const leaf = ZYAN_RADIX_TREE_LEAF(*ref);
+        if (!ZyanRadixTreeLeafMatches(tree, leaf, key, length))
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        *ref = ZYAN_NULL;
+        --tree->size;
+        ZYAN_CHECK(ZyanRadixTreeFreeLeaf(tree, leaf));
+        return ZYAN_STATUS_TRUE;
+    }
+
+    ZyanRadixTreeNode* const node = (ZyanRadixTreeNode*)*ref;
+    if (!ZyanRadixTreeCheckPrefix(node, key, length, depth))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+    depth += node->prefix_length;
+
+    if (depth == length)
+    {
+        ZyanRadixTreeLeaf* const leaf = node->leaf;
+        if (!leaf || !ZyanRadixTreeLeafMatches(tree, leaf, key, length))
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        node->leaf = ZYAN_NULL;
+        --tree->size;
+        ZYAN_CHECK(ZyanRadixTreeFreeLeaf(tree, leaf));
+        ZYAN_CHECK(ZyanRadixTreeShrink(tree, ref));
+        return ZYAN_STATUS_TRUE;
+    }
+
+    void** const slot = ZyanRadixTreeFindChild(node, key[depth]);
+    if (!slot)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+    if (!ZYAN_RADIX_TREE_IS_LEAF(*slot))
+    {
+        const ZyanStatus status = ZyanRadixTreeRemoveRecursive(tree, slot, key, length, depth + 1);
+        if ((status != ZYAN_STATUS_TRUE) || *slot)
+        {
+            return status;
+        }
+
+        // The child node was left without entries and has been released
+        ZyanRadixTreeRemoveChild(node, key[depth]);
+        ZYAN_CHECK(ZyanRadixTreeShrink(tree, ref));
+        return ZYAN_STATUS_TRUE;
+    }
+
+    ZyanRadixTreeLeaf* const leaf = ZYAN_RADIX_TREE_LEAF(*slot);
+    if (!ZyanRadixTreeLeafMatches(tree, leaf, key, length))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+    ZyanRadixTreeRemoveChild(node, key[depth]);
+    --tree->size;
+    ZYAN_CHECK(ZyanRadixTreeFreeLeaf(tree, leaf));
+    ZYAN_CHECK(ZyanRadixTreeShrink(tree, ref));
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/**
+ * @brief   Deallocates all nodes and leaves of the given subtree.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   child   A (tagged) child pointer.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanRadixTreeFreeSubtree(ZyanRadixTree* tree, void* child)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(child);
+
+    if (ZYAN_RADIX_TREE_IS_LEAF(child))
+    {
+        return ZyanRadixTreeFreeLeaf(tree, ZYAN_RADIX_TREE_LEAF(child));
+    }
+
+    ZyanRadixTreeNode* const node = (ZyanRadixTreeNode*)child;
+    if (node->leaf)
+    {
+        ZYAN_CHECK(ZyanRadixTreeFreeLeaf(tree, node->leaf));
+    }
+    switch (node->type)
+    {
+    case ZYAN_RADIX_TREE_NODE4:
+        for (ZyanUSize i = 0; i < node->count; ++i)
+        {
+            ZYAN_CHECK(ZyanRadixTreeFreeSubtree(tree, ((ZyanRadixTreeNode4*)node)->children[i]));
+        }
+        break;
+    case ZYAN_RADIX_TREE_NODE16:
+        for (ZyanUSize i = 0; i < node->count; ++i)
+        {
+            ZYAN_CHECK(ZyanRadixTreeFreeSubtree(tree, ((ZyanRadixTreeNode16*)node)->children[i]));
+        }
+        break;
+    case ZYAN_RADIX_TREE_NODE48:
+        for (ZyanUSize i = 0; i < 48; ++i)
+        {
+            void* const c = ((ZyanRadixTreeNode48*)node)->children[i];
+            if (c)
+            {
+                ZYAN_CHECK(ZyanRadixTreeFreeSubtree(tree, c));
+            }
+        }
+        break;
+    case ZYAN_RADIX_TREE_NODE256:
+        for (ZyanUSize i = 0; i < 256; ++i)
+        {
+            void* const c = ((ZyanRadixTreeNode256*)node)->children[i];
+            if (c)
+            {
+                ZYAN_CHECK(ZyanRadixTreeFreeSubtree(tree, c));
+            }
+        }
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    return ZyanRadixTreeFreeNode(tree, node);
+}
+
+/**
+ * @brief   Invokes the `callback` for every entry of the given subtree in lexicographical order.
+ *
+ * @param   tree        A pointer to the `ZyanRadixTree` instance.
+ * @param   child       A (tagged) child pointer.
+ * @param   callback    The callback function.
+ * @param   user_data   A user data pointer that is passed to the callback.
+ *
+ * @return  `ZYAN_STATUS_FALSE`, if the callback requested to stop the iteration or another zycore
+ *          status code.
+ */
+static ZyanStatus ZyanRadixTreeVisit(const ZyanRadixTree* tree, void* child,
+    ZyanRadixTreeCallback callback, void* user_data)
+{
+    ZYAN_ASSERT(tree);
+    ZYAN_ASSERT(child);
+    ZYAN_ASSERT(callback);
+
+#define ZYAN_RADIX_TREE_VISIT_LEAF(leaf) \
+    { \
+        const ZyanStatus status_ = callback(ZYAN_RADIX_TREE_LEAF_KEY(tree, leaf), \
+            (leaf)->key_length, ZYAN_RADIX_TREE_LEAF_VALUE(leaf), user_data); \
+        if (!ZYAN_SUCCESS(status_) || (status_ == ZYAN_STATUS_FALSE)) \
+        { \
+            return status_; \
+        } \
+    }
+#define ZYAN_RADIX_TREE_VISIT_CHILD(c) \
+    { \
+        const ZyanStatus status_ = ZyanRadixTreeVisit(tree, c, callback, user_data); \
+        if (!ZYAN_SUCCESS(status_) || (status_ == ZYAN_STATUS_FALSE)) \
+        { \
+            return status_; \
+        } \
+    }
+
+    if (ZYAN_RADIX_TREE_IS_LEAF(child))
+    {
+        ZYAN_RADIX_TREE_VISIT_LEAF(ZYAN_RADIX_TREE_LEAF(child));
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // A key that ends at this node is a prefix of all other keys in the subtree
+    const ZyanRadixTreeNode* const node = (const ZyanRadixTreeNode*)child;
+    if (node->leaf)
+    {
+        ZYAN_RADIX_TREE_VISIT_LEAF(node->leaf);
+    }
+    switch (node->type)
+    {
+    case ZYAN_RADIX_TREE_NODE4:
+        for (ZyanUSize i = 0; i < node->count; ++i)
+        {
+            ZYAN_RADIX_TREE_VISIT_CHILD(((const ZyanRadixTreeNode4*)node)->children[i]);
+        }
+        break;
+    case ZYAN_RADIX_TREE_NODE16:
+        for (ZyanUSize i = 0; i < node->count; ++i)
+        {
+            ZYAN_RADIX_TREE_VISIT_CHILD(((const ZyanRadixTreeNode16*)node)->children[i]);
+        }
+        break;
+    case ZYAN_RADIX_TREE_NODE48:
+    {
+        const ZyanRadixTreeNode48* const n = (const ZyanRadixTreeNode48*)node;
+        for (ZyanUSize i = 0; i < 256; ++i)
+        {
+            if (n->index[i])
+            {
+                ZYAN_RADIX_TREE_VISIT_CHILD(n->children[n->index[i] - 1]);
+            }
+        }
+        break;
+    }
+    case ZYAN_RADIX_TREE_NODE256:
+    {
+        const ZyanRadixTreeNode256* const n = (const ZyanRadixTreeNode256*)node;
+        for (ZyanUSize i = 0; i < 256; ++i)
+        {
+            if (n->children[i])
+            {
+                ZYAN_RADIX_TREE_VISIT_CHILD(n->children[i]);
+            }
+        }
+        break;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+#undef ZYAN_RADIX_TREE_VISIT_CHILD
+#undef ZYAN_RADIX_TREE_VISIT_LEAF
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRadixTreeInit(ZyanRadixTree* tree, ZyanUSize value_size)
+{
+    return ZyanRadixTreeInitEx(tree, value_size, ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanRadixTreeInitEx(ZyanRadixTree* tree, ZyanUSize value_size,
+    ZyanAllocator* allocator)
+{
+    if (!tree || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    tree->allocator  = allocator;
+    tree->value_size = value_size;
+    tree->root       = ZYAN_NULL;
+    tree->size       = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRadixTreeDestroy(ZyanRadixTree* tree)
+{
+    return ZyanRadixTreeClear(tree);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRadixTreeGet(const ZyanRadixTree* tree, const void* key, ZyanUSize length,
+    void** value)
+{
+    if (!tree || (!key && length) || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* const bytes = (const ZyanU8*)key;
+    const ZyanRadixTreeLeaf* leaf = ZYAN_NULL;
+    void* child = tree->root;
+    ZyanUSize depth = 0;
+    while (child)
+    {
+        if (ZYAN_RADIX_TREE_IS_LEAF(child))
+        {
+            leaf = ZYAN_RADIX_TREE_LEAF(child);
+            break;
+        }
+        ZyanRadixTreeNode* const node = (ZyanRadixTreeNode*)child;
+        if (!ZyanRadixTreeCheckPrefix(node, bytes, length, depth))
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        depth += node->prefix_length;
+        if (depth == length)
+        {
+            leaf = node->leaf;
+            break;
+        }
+        void** const slot = ZyanRadixTreeFindChild(node, bytes[depth++]);
+        child = slot ? *slot : ZYAN_NULL;
+    }
+
+    if (!leaf || !ZyanRadixTreeLeafMatches(tree, leaf, bytes, length))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    *value = ZYAN_RADIX_TREE_LEAF_VALUE(leaf);
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanRadixTreeLongestPrefixMatch(const ZyanRadixTree* tree, const void* key,
+    ZyanUSize length, ZyanUSize* match_length, void** value)
+{
+    if (!tree || (!key && length) || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* const bytes = (const ZyanU8*)key;
+    const ZyanRadixTreeLeaf* best = ZYAN_NULL;
+    void* child = tree->root;
+    ZyanUSize depth = 0;
+
+    // Every candidate is verified against its full key, as the compressed paths are only checked
+    // optimistically
+#define ZYAN_RADIX_TREE_IS_PREFIX(leaf) \
+    (((leaf)->key_length <= length) && (!(leaf)->key_length || \
+        !ZYAN_MEMCMP(ZYAN_RADIX_TREE_LEAF_KEY(tree, leaf), bytes, (leaf)->key_length)))
+
+    while (child)
+    {
+        if (ZYAN_RADIX_TREE_IS_LEAF(child))
+        {
+            const ZyanRadixTreeLeaf* const leaf = ZYAN_RADIX_TREE_LEAF(child);
+            if (ZYAN_RADIX_TREE_IS_PREFIX(leaf))
+            {
+                best = leaf;
+            }
+            break;
+        }
+        ZyanRadixTreeNode* const node = (ZyanRadixTreeNode*)child;
+        if (!ZyanRadixTreeCheckPrefix(node, bytes, length, depth))
+        {
+            break;
+        }
+        depth += node->prefix_length;
+        if (node->leaf && ZYAN_RADIX_TREE_IS_PREFIX(node->leaf))
+        {
+            best = node->leaf;
+        }
+        if (depth == length)
+        {
+            break;
+        }
+        void** const slot = ZyanRadixTreeFindChild(node, bytes[depth++]);
+        child = slot ? *slot : ZYAN_NULL;
+    }
+
+#undef ZYAN_RADIX_TREE_IS_PREFIX
+
+    if (!best)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    if (match_length)
+    {
+        *match_length = best->key_length;
+    }
+    *value = ZYAN_RADIX_TREE_LEAF_VALUE(best);
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRadixTreeInsert(ZyanRadixTree* tree, const void* key, ZyanUSize length,
+    const void* value)
+{
+    if (!tree || (!key && length) || (!value && tree->value_size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanRadixTreeInsertRecursive(tree, &tree->root, (const ZyanU8*)key, length, 0, value);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRadixTreeRemove(ZyanRadixTree* tree, const void* key, ZyanUSize length)
+{
+    if (!tree || (!key && length))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!tree->root)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    return ZyanRadixTreeRemoveRecursive(tree, &tree->root, (const ZyanU8*)key, length, 0);
+}
+
+ZyanStatus ZyanRadixTreeClear(ZyanRadixTree* tree)
+{
+    if (!tree)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (tree->root)
+    {
+        ZYAN_CHECK(ZyanRadixTreeFreeSubtree(tree, tree->root));
+        tree->root = ZYAN_NULL;
+    }
+    tree->size = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRadixTreeForEachPrefix(const ZyanRadixTree* tree, const void* prefix,
+    ZyanUSize length, ZyanRadixTreeCallback callback, void* user_data)
+{
+    if (!tree || (!prefix && length) || !callback)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* const bytes = (const ZyanU8*)prefix;
+    void* child = tree->root;
+    ZyanUSize depth = 0;
+    while (child)
+    {
+        if (ZYAN_RADIX_TREE_IS_LEAF(child))
+        {
+            const ZyanRadixTreeLeaf* const leaf = ZYAN_RADIX_TREE_LEAF(child);
+            if ((leaf->key_length < length) || (length &&
+                ZYAN_MEMCMP(ZYAN_RADIX_TREE_LEAF_KEY(tree, leaf), bytes, length)))
+            {
+                return ZYAN_STATUS_SUCCESS;
+            }
+            break;
+        }
+
+        const ZyanRadixTreeNode* const node = (const ZyanRadixTreeNode*)child;
+        if (node->prefix_length)
+        {
+            // The prefix may end inside of the compressed path
+            const ZyanUSize common =
+                ZyanRadixTreePrefixMismatch(tree, node, bytes, length, depth);
+            if (depth + common == length)
+            {
+                break;
+            }
+            if (common < node->prefix_length)
+            {
+                return ZYAN_STATUS_SUCCESS;
+            }
+            depth += node->prefix_length;
+        }
+        if (depth == length)
+        {
+            break;
+        }
+        void** const slot = ZyanRadixTreeFindChild((ZyanRadixTreeNode*)node, bytes[depth++]);
+        child = slot ? *slot : ZYAN_NULL;
+    }
+
+    if (!child)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanStatus status = ZyanRadixTreeVisit(tree, child, callback, user_data);
+    return (status == ZYAN_STATUS_FALSE) ? ZYAN_STATUS_SUCCESS : status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRadixTreeSize(const ZyanRadixTree* tree, ZyanUSize* size)
+{
+    if (!tree || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = tree->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
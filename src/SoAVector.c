@@ -0,0 +1,438 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/SoAVector.h>
+#include <Zycore/Trace.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+#define ZYAN_SOA_VECTOR_MIN_CAPACITY     1
+#define ZYAN_SOA_VECTOR_GROWTH_FACTOR    2.00f
+#define ZYAN_SOA_VECTOR_SHRINK_THRESHOLD 0.25f
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Rounds the given value up to the next multiple of `ZYAN_CACHE_LINE_SIZE`.
+ *
+ * @param   x   The value.
+ *
+ * @return  The rounded value.
+ */
+#define ZYAN_SOA_VECTOR_ALIGN(x) \
+    (((x) + (ZYAN_CACHE_LINE_SIZE - 1)) & ~(ZyanUSize)(ZYAN_CACHE_LINE_SIZE - 1))
+
+/**
+ * @brief   Returns a pointer to the value of the given `field` in the row at `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   field   The field index.
+ * @param   index   The row index.
+ *
+ * @return  A pointer to the field value.
+ */
+#define ZYAN_SOA_VECTOR_OFFSET(vector, field, index) \
+    ((vector)->columns[field] + (index) * (vector)->fields[field].size)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Moves the columns of the vector into a new allocation with the given capacity.
+ *
+ * @param   vector      A pointer to the `ZyanSoAVector` instance.
+ * @param   capacity    The new capacity.
+ *
+ * @return  A zycore status code.
+ *
+ * The first `min(size, capacity)` rows are preserved.
+ */
+static ZyanStatus ZyanSoAVectorReallocate(ZyanSoAVector* vector, ZyanUSize capacity)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(vector->allocator);
+    ZYAN_ASSERT(vector->allocator->allocate);
+    ZYAN_ASSERT(vector->allocator->deallocate);
+
+    capacity = ZYAN_MAX(ZYAN_SOA_VECTOR_MIN_CAPACITY, capacity);
+
+    // Reserve enough slack to align the first column
+    ZyanUSize data_size = ZYAN_CACHE_LINE_SIZE - 1;
+    for (ZyanUSize i = 0; i < vector->field_count; ++i)
+    {
+        const ZyanUSize field_size = vector->fields[i].size;
+        if (capacity > ((ZyanUSize)-1 - data_size - ZYAN_CACHE_LINE_SIZE) / field_size)
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+        data_size += ZYAN_SOA_VECTOR_ALIGN(capacity * field_size);
+    }
+
+    void* data;
+    ZYAN_CHECK(vector->allocator->allocate(vector->allocator, &data, 1, data_size));
+
+    const ZyanUSize count = ZYAN_MIN(vector->size, capacity);
+    ZyanU8* column = (ZyanU8*)ZYAN_SOA_VECTOR_ALIGN((ZyanUPointer)data);
+    for (ZyanUSize i = 0; i < vector->field_count; ++i)
+    {
+        const ZyanUSize field_size = vector->fields[i].size;
+        if (count)
+        {
+            ZYAN_MEMCPY(column, vector->columns[i], count * field_size);
+        }
+        vector->columns[i] = column;
+        column += ZYAN_SOA_VECTOR_ALIGN(capacity * field_size);
+    }
+
+    void* const previous_data = vector->data;
+    const ZyanUSize previous_data_size = vector->data_size;
+#ifdef ZYCORE_TRACING
+    const ZyanUSize previous_capacity = vector->capacity;
+#endif
+    vector->data      = data;
+    vector->data_size = data_size;
+    vector->capacity  = capacity;
+
+    ZYAN_TRACE((capacity > previous_capacity) ? ZYAN_TRACE_EVENT_CONTAINER_GROW :
+        ZYAN_TRACE_EVENT_CONTAINER_SHRINK, vector, data, previous_data, data_size,
+        previous_data_size);
+
+    if (!previous_data)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+    return vector->allocator->deallocate(vector->allocator, previous_data, 1, previous_data_size);
+}
+
+/**
+ * @brief   Grows the columns of the vector, so that they fit at least `size` rows.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   size    The required number of rows.
+ *
+ * @return  A zycore status code.
+ */
+static ZYAN_NOINLINE ZYAN_COLD ZyanStatus ZyanSoAVectorGrow(ZyanSoAVector* vector, ZyanUSize size)
+{
+    return ZyanSoAVectorReallocate(vector,
+        ZYAN_MAX(size, (ZyanUSize)(size * vector->growth_factor)));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSoAVectorInit(ZyanSoAVector* vector, const ZyanSoAVectorField* fields,
+    ZyanUSize field_count, ZyanUSize row_size, ZyanUSize capacity)
+{
+    return ZyanSoAVectorInitEx(vector, fields, field_count, row_size, capacity,
+        ZyanAllocatorDefault(), ZYAN_SOA_VECTOR_GROWTH_FACTOR, ZYAN_SOA_VECTOR_SHRINK_THRESHOLD);
+}
+
+ZyanStatus ZyanSoAVectorInitEx(ZyanSoAVector* vector, const ZyanSoAVectorField* fields,
+    ZyanUSize field_count, ZyanUSize row_size, ZyanUSize capacity, ZyanAllocator* allocator,
+    float growth_factor, float shrink_threshold)
+{
+    if (!vector || !fields || !field_count || (field_count > ZYAN_SOA_VECTOR_MAX_FIELDS) ||
+        !allocator || (growth_factor < 1.0f) || (shrink_threshold < 0.0f) ||
+        (shrink_threshold > 1.0f))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    for (ZyanUSize i = 0; i < field_count; ++i)
+    {
+        if (!fields[i].size || (fields[i].size > row_size) ||
+            (fields[i].offset > row_size - fields[i].size))
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+    }
+
+    vector->allocator        = allocator;
+    vector->growth_factor    = growth_factor;
+    vector->shrink_threshold = shrink_threshold;
+    vector->size             = 0;
+    vector->capacity         = 0;
+    vector->row_size         = row_size;
+    vector->field_count      = field_count;
+    vector->data             = ZYAN_NULL;
+    vector->data_size        = 0;
+    for (ZyanUSize i = 0; i < field_count; ++i)
+    {
+        vector->fields[i]  = fields[i];
+        vector->columns[i] = ZYAN_NULL;
+    }
+
+    return ZyanSoAVectorReallocate(vector, capacity);
+}
+
+ZyanStatus ZyanSoAVectorDestroy(ZyanSoAVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(vector->data);
+    ZYAN_ASSERT(vector->allocator->deallocate);
+
+    return vector->allocator->deallocate(vector->allocator, vector->data, 1, vector->data_size);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSoAVectorGet(const ZyanSoAVector* vector, ZyanUSize index, void* row)
+{
+    if (ZYAN_UNLIKELY(!vector || !row))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(index >= vector->size))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    for (ZyanUSize i = 0; i < vector->field_count; ++i)
+    {
+        ZYAN_MEMCPY((ZyanU8*)row + vector->fields[i].offset,
+            ZYAN_SOA_VECTOR_OFFSET(vector, i, index), vector->fields[i].size);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorGetField(ZyanSoAVector* vector, ZyanUSize index, ZyanUSize field,
+    void** element)
+{
+    return ZyanSoAVectorGetFieldConst(vector, index, field, (const void**)element);
+}
+
+ZyanStatus ZyanSoAVectorGetFieldConst(const ZyanSoAVector* vector, ZyanUSize index,
+    ZyanUSize field, const void** element)
+{
+    if (ZYAN_UNLIKELY(!vector || !element || (field >= vector->field_count)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(index >= vector->size))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    *element = ZYAN_SOA_VECTOR_OFFSET(vector, field, index);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorGetColumn(ZyanSoAVector* vector, ZyanUSize field, void** column)
+{
+    return ZyanSoAVectorGetColumnConst(vector, field, (const void**)column);
+}
+
+ZyanStatus ZyanSoAVectorGetColumnConst(const ZyanSoAVector* vector, ZyanUSize field,
+    const void** column)
+{
+    if (!vector || !column || (field >= vector->field_count))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *column = vector->columns[field];
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Assignment                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSoAVectorAssign(ZyanSoAVector* vector, ZyanUSize index, const void* row)
+{
+    if (ZYAN_UNLIKELY(!vector || !row))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (ZYAN_UNLIKELY(index >= vector->size))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    for (ZyanUSize i = 0; i < vector->field_count; ++i)
+    {
+        ZYAN_MEMCPY(ZYAN_SOA_VECTOR_OFFSET(vector, i, index),
+            (const ZyanU8*)row + vector->fields[i].offset, vector->fields[i].size);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSoAVectorPush(ZyanSoAVector* vector, const void* row)
+{
+    if (ZYAN_UNLIKELY(!vector || !row))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (ZYAN_UNLIKELY(vector->size == vector->capacity))
+    {
+        ZYAN_CHECK(ZyanSoAVectorGrow(vector, vector->size + 1));
+    }
+
+    ++vector->size;
+
+    return ZyanSoAVectorAssign(vector, vector->size - 1, row);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSoAVectorPop(ZyanSoAVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (vector->size == 0)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    --vector->size;
+    if (vector->size < vector->capacity * vector->shrink_threshold)
+    {
+        return ZyanSoAVectorReallocate(vector,
+            (ZyanUSize)(vector->size * vector->growth_factor));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorClear(ZyanSoAVector* vector)
+{
+    return ZyanSoAVectorResize(vector, 0);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSoAVectorResize(ZyanSoAVector* vector, ZyanUSize size)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if ((size > vector->capacity) || (size < vector->capacity * vector->shrink_threshold))
+    {
+        ZYAN_CHECK(ZyanSoAVectorReallocate(vector,
+            ZYAN_MAX(size, (ZyanUSize)(size * vector->growth_factor))));
+    }
+
+    vector->size = size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorReserve(ZyanSoAVector* vector, ZyanUSize capacity)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (capacity > vector->capacity)
+    {
+        ZYAN_CHECK(ZyanSoAVectorReallocate(vector, capacity));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorShrinkToFit(ZyanSoAVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanSoAVectorReallocate(vector, vector->size);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSoAVectorSize(const ZyanSoAVector* vector, ZyanUSize* size)
+{
+    if (!vector || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = vector->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorCapacity(const ZyanSoAVector* vector, ZyanUSize* capacity)
+{
+    if (!vector || !capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *capacity = vector->capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
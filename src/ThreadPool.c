@@ -0,0 +1,964 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/ThreadPool.h>
+#include <Zycore/Internal/Thread.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The capacity of the deque of every worker (must be a power of two).
+ *
+ * Tasks that do not fit into the deque anymore are executed immediately by the submitting worker.
+ */
+#define ZYAN_THREAD_POOL_DEQUE_CAPACITY     4096
+
+/**
+ * @brief   The maximum number of worker threads.
+ */
+#define ZYAN_THREAD_POOL_MAX_THREADS        1024
+
+/**
+ * @brief   The number of unsuccessful attempts to find a task, before a thread goes to sleep.
+ */
+#define ZYAN_THREAD_POOL_SPIN_COUNT         128
+
+/**
+ * @brief   The number of chunks per worker that are created by `ZyanThreadPoolParallelFor`.
+ */
+#define ZYAN_THREAD_POOL_CHUNKS_PER_THREAD  4
+
+/**
+ * @brief   The number of chunks `ZyanThreadPoolParallelFor` keeps on the stack, before it falls
+ *          back to the allocator.
+ */
+#define ZYAN_THREAD_POOL_STACK_CHUNKS       32
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * @brief   Rounds the given size up to the next multiple of `ZYAN_CACHE_LINE_SIZE`.
+ *
+ * @param   size    The size.
+ *
+ * @return  The rounded size.
+ */
+#define ZYAN_THREAD_POOL_ALIGN(size) \
+    (((size) + ZYAN_CACHE_LINE_SIZE - 1) & ~(ZyanUSize)(ZYAN_CACHE_LINE_SIZE - 1))
+
+/**
+ * @brief   Returns the task at the given index of a strided task array.
+ *
+ * @param   first   A pointer to the first task.
+ * @param   stride  The distance between two consecutive tasks in bytes.
+ * @param   index   The index.
+ *
+ * @return  A pointer to the task.
+ */
+#define ZYAN_THREAD_POOL_TASK_AT(first, stride, index) \
+    ((ZyanTask*)((ZyanU8*)(first) + (stride) * (index)))
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines the `ZyanThreadPoolWorker` struct.
+ *
+ * `top` is modified by thieves and `bottom` by the owning worker only, which is why both of them
+ * are placed in separate cache lines.
+ */
+typedef struct ZyanThreadPoolWorker_
+{
+    /**
+     * @brief   The index of the oldest task in the deque.
+     */
+    ZyanAtomic64 top;
+    /**
+     * @brief   Padding.
+     */
+    ZyanU8 padding[ZYAN_CACHE_LINE_SIZE - sizeof(ZyanAtomic64)];
+    /**
+     * @brief   The index after the newest task in the deque.
+     */
+    ZyanAtomic64 bottom;
+    /**
+     * @brief   The ring buffer of the deque.
+     */
+    ZyanAtomicPointer* buffer;
+    /**
+     * @brief   The internal state of the thread pool.
+     */
+    struct ZyanThreadPoolState_* state;
+    /**
+     * @brief   The state of the random number generator that selects the victims.
+     */
+    ZyanU32 random;
+    /**
+     * @brief   The thread handle.
+     */
+    ZyanThread thread;
+} ZyanThreadPoolWorker;
+
+/**
+ * @brief   Pads a `ZyanThreadPoolWorker` struct to a multiple of the cache line size.
+ */
+typedef union ZyanThreadPoolWorkerSlot_
+{
+    /**
+     * @brief   The worker.
+     */
+    ZyanThreadPoolWorker worker;
+    /**
+     * @brief   Padding.
+     */
+    ZyanU8 padding[ZYAN_THREAD_POOL_ALIGN(sizeof(ZyanThreadPoolWorker))];
+} ZyanThreadPoolWorkerSlot;
+
+/**
+ * @brief   Defines the `ZyanThreadPoolState` struct.
+ */
+typedef struct ZyanThreadPoolState_
+{
+    /**
+     * @brief   Incremented whenever new tasks are submitted or a task group finishes.
+     */
+    ZyanAtomic64 epoch;
+    /**
+     * @brief   The number of tasks in the shared queue.
+     */
+    ZyanAtomic64 queued;
+    /**
+     * @brief   The number of threads that sleep on `condition`.
+     */
+    ZyanAtomic32 sleeping;
+    /**
+     * @brief   Set to a non-zero value, if the workers should exit.
+     */
+    ZyanAtomic32 shutdown;
+    /**
+     * @brief   Used to derive the random victim selection seeds of non-worker threads.
+     */
+    ZyanAtomic32 seed;
+    /**
+     * @brief   Guards the shared queue and `condition`.
+     */
+    ZyanMutex mutex;
+    /**
+     * @brief   The condition variable idle threads sleep on.
+     */
+    ZyanCondition condition;
+    /**
+     * @brief   The first task in the shared queue.
+     */
+    ZyanTask* head;
+    /**
+     * @brief   The last task in the shared queue.
+     */
+    ZyanTask* tail;
+    /**
+     * @brief   The workers.
+     */
+    ZyanThreadPoolWorkerSlot* workers;
+    /**
+     * @brief   The number of workers.
+     */
+    ZyanUSize worker_count;
+    /**
+     * @brief   The allocation that holds the state, the workers and the deques.
+     */
+    void* memory;
+    /**
+     * @brief   The size of `memory`.
+     */
+    ZyanUSize memory_size;
+} ZyanThreadPoolState;
+
+/**
+ * @brief   Defines the `ZyanThreadPoolChunk` struct.
+ */
+typedef struct ZyanThreadPoolChunk_
+{
+    /**
+     * @brief   The task that processes the chunk.
+     */
+    ZyanTask task;
+    /**
+     * @brief   The first index.
+     */
+    ZyanUSize begin;
+    /**
+     * @brief   The index after the last index.
+     */
+    ZyanUSize end;
+    /**
+     * @brief   The range function.
+     */
+    ZyanTaskRangeFunction function;
+    /**
+     * @brief   The user data pointer that is passed to `function`.
+     */
+    void* user_data;
+} ZyanThreadPoolChunk;
+
+/* ============================================================================================== */
+/* Internal variables                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The worker that is executed by the current thread, or `ZYAN_NULL` for all threads that
+ *          are not owned by a thread pool.
+ */
+static ZYAN_THREAD_LOCAL ZyanThreadPoolWorker* zyan_thread_pool_worker = ZYAN_NULL;
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deque                                                                                          */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Pushes a task to the bottom of the deque of the given worker.
+ *
+ * @param   worker  A pointer to the `ZyanThreadPoolWorker` struct (owned by the calling thread).
+ * @param   task    A pointer to the task.
+ *
+ * @return  `ZYAN_TRUE`, if the task was pushed or `ZYAN_FALSE`, if the deque is full.
+ */
+static ZyanBool ZyanThreadPoolPush(ZyanThreadPoolWorker* worker, ZyanTask* task)
+{
+    const ZyanU64 b = ZyanAtomicLoad64(&worker->bottom, ZYAN_MEMORY_ORDER_RELAXED);
+    const ZyanU64 t = ZyanAtomicLoad64(&worker->top, ZYAN_MEMORY_ORDER_ACQUIRE);
+    if ((ZyanI64)(b - t) >= ZYAN_THREAD_POOL_DEQUE_CAPACITY)
+    {
+        return ZYAN_FALSE;
+    }
+
+    ZyanAtomicStorePointer(&worker->buffer[b & (ZYAN_THREAD_POOL_DEQUE_CAPACITY - 1)], task,
+        ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanAtomicStore64(&worker->bottom, b + 1, ZYAN_MEMORY_ORDER_RELEASE);
+
+    return ZYAN_TRUE;
+}
+
+/**
+ * @brief   Pops a task from the bottom of the deque of the given worker.
+ *
+ * @param   worker  A pointer to the `ZyanThreadPoolWorker` struct (owned by the calling thread).
+ *
+ * @return  A pointer to the task or `ZYAN_NULL`, if the deque is empty.
+ */
+static ZyanTask* ZyanThreadPoolTake(ZyanThreadPoolWorker* worker)
+{
+    const ZyanU64 b = ZyanAtomicLoad64(&worker->bottom, ZYAN_MEMORY_ORDER_RELAXED) - 1;
+    ZyanAtomicStore64(&worker->bottom, b, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanAtomicThreadFence(ZYAN_MEMORY_ORDER_SEQ_CST);
+    ZyanU64 t = ZyanAtomicLoad64(&worker->top, ZYAN_MEMORY_ORDER_RELAXED);
+
+    if ((ZyanI64)(b - t) < 0)
+    {
+        // The deque is empty
+        ZyanAtomicStore64(&worker->bottom, b + 1, ZYAN_MEMORY_ORDER_RELAXED);
+        return ZYAN_NULL;
+    }
+
+    ZyanTask* task = ZyanAtomicLoadPointer(
+        &worker->buffer[b & (ZYAN_THREAD_POOL_DEQUE_CAPACITY - 1)], ZYAN_MEMORY_ORDER_RELAXED);
+    if (b != t)
+    {
+        return task;
+    }
+
+    // This is the last task in the deque, which might be stolen concurrently
+    if (!ZyanAtomicCompareExchange64(&worker->top, &t, t + 1, ZYAN_MEMORY_ORDER_SEQ_CST,
+        ZYAN_MEMORY_ORDER_RELAXED))
+    {
+        task = ZYAN_NULL;
+    }
+    ZyanAtomicStore64(&worker->bottom, b + 1, ZYAN_MEMORY_ORDER_RELAXED);
+
+    return task;
+}
+
+/**
+ * @brief   Steals a task from the top of the deque of the given worker.
+ *
+ * @param   worker  A pointer to the `ZyanThreadPoolWorker` struct.
+ *
+ * @return  A pointer to the task or `ZYAN_NULL`, if the deque is empty or another thread won the
+ *          race for the task.
+ */
+static ZyanTask* ZyanThreadPoolSteal(ZyanThreadPoolWorker* worker)
+{
+    ZyanU64 t = ZyanAtomicLoad64(&worker->top, ZYAN_MEMORY_ORDER_ACQUIRE);
+    ZyanAtomicThreadFence(ZYAN_MEMORY_ORDER_SEQ_CST);
+    const ZyanU64 b = ZyanAtomicLoad64(&worker->bottom, ZYAN_MEMORY_ORDER_ACQUIRE);
+
+    if ((ZyanI64)(b - t) <= 0)
+    {
+        return ZYAN_NULL;
+    }
+
+    ZyanTask* const task = ZyanAtomicLoadPointer(
+        &worker->buffer[t & (ZYAN_THREAD_POOL_DEQUE_CAPACITY - 1)], ZYAN_MEMORY_ORDER_RELAXED);
+    if (!ZyanAtomicCompareExchange64(&worker->top, &t, t + 1, ZYAN_MEMORY_ORDER_SEQ_CST,
+        ZYAN_MEMORY_ORDER_RELAXED))
+    {
+        return ZYAN_NULL;
+    }
+
+    return task;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Scheduling                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Returns the worker of the given thread pool that is executed by the calling thread.
+ *
+ * @param   state   A pointer to the `ZyanThreadPoolState` struct.
+ *
+ * @return  A pointer to the worker or `ZYAN_NULL`, if the calling thread is not a worker of the
+ *          given pool.
+ */
+static ZyanThreadPoolWorker* ZyanThreadPoolGetCurrentWorker(const ZyanThreadPoolState* state)
+{
+    ZyanThreadPoolWorker* const worker = zyan_thread_pool_worker;
+    return (worker && (worker->state == state)) ? worker : ZYAN_NULL;
+}
+
+/**
+ * @brief   Returns the next value of the given xorshift random number generator.
+ *
+ * @param   random  A pointer to the generator state (must not be zero).
+ *
+ * @return  The next random value.
+ */
+static ZyanU32 ZyanThreadPoolRandom(ZyanU32* random)
+{
+    ZyanU32 x = *random;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *random = x;
+    return x;
+}
+
+/**
+ * @brief   Wakes up all sleeping threads after new tasks were submitted or a task group finished.
+ *
+ * @param   state   A pointer to the `ZyanThreadPoolState` struct.
+ */
+static void ZyanThreadPoolNotify(ZyanThreadPoolState* state)
+{
+    ZyanAtomicFetchAdd64(&state->epoch, 1, ZYAN_MEMORY_ORDER_SEQ_CST);
+    if (ZyanAtomicLoad32(&state->sleeping, ZYAN_MEMORY_ORDER_SEQ_CST))
+    {
+        ZyanMutexLock(&state->mutex);
+        ZyanConditionBroadcast(&state->condition);
+        ZyanMutexUnlock(&state->mutex);
+    }
+}
+
+/**
+ * @brief   Checks, if there are tasks in the shared queue or in any of the deques.
+ *
+ * @param   state   A pointer to the `ZyanThreadPoolState` struct.
+ *
+ * @return  `ZYAN_TRUE`, if there might be tasks to execute or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanThreadPoolHasWork(ZyanThreadPoolState* state)
+{
+    if (ZyanAtomicLoad64(&state->queued, ZYAN_MEMORY_ORDER_SEQ_CST))
+    {
+        return ZYAN_TRUE;
+    }
+    for (ZyanUSize i = 0; i < state->worker_count; ++i)
+    {
+        ZyanThreadPoolWorker* const worker = &state->workers[i].worker;
+        const ZyanU64 t = ZyanAtomicLoad64(&worker->top, ZYAN_MEMORY_ORDER_SEQ_CST);
+        const ZyanU64 b = ZyanAtomicLoad64(&worker->bottom, ZYAN_MEMORY_ORDER_SEQ_CST);
+        if ((ZyanI64)(b - t) > 0)
+        {
+            return ZYAN_TRUE;
+        }
+    }
+    return ZYAN_FALSE;
+}
+
+/**
+ * @brief   Puts the calling thread to sleep until new tasks are submitted or a task group
+ *          finishes.
+ *
+ * @param   state   A pointer to the `ZyanThreadPoolState` struct.
+ * @param   group   A pointer to the `ZyanTaskGroup` the calling thread waits for, or `ZYAN_NULL`
+ *                  for worker threads.
+ */
+static void ZyanThreadPoolSleep(ZyanThreadPoolState* state, ZyanTaskGroup* group)
+{
+    // Every event that could end the sleep increments the epoch after it was published. Reading
+    // the epoch before checking for these events ensures that no wakeup is lost.
+    const ZyanU64 epoch = ZyanAtomicLoad64(&state->epoch, ZYAN_MEMORY_ORDER_SEQ_CST);
+    if (group
+        ? !ZyanAtomicLoad64(&group->pending, ZYAN_MEMORY_ORDER_ACQUIRE)
+        : ZyanAtomicLoad32(&state->shutdown, ZYAN_MEMORY_ORDER_ACQUIRE))
+    {
+        return;
+    }
+    if (ZyanThreadPoolHasWork(state))
+    {
+        return;
+    }
+
+    ZyanMutexLock(&state->mutex);
+    ZyanAtomicFetchAdd32(&state->sleeping, 1, ZYAN_MEMORY_ORDER_SEQ_CST);
+    while (ZyanAtomicLoad64(&state->epoch, ZYAN_MEMORY_ORDER_SEQ_CST) == epoch)
+    {
+        ZyanConditionWait(&state->condition, &state->mutex);
+    }
+    ZyanAtomicFetchSub32(&state->sleeping, 1, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanMutexUnlock(&state->mutex);
+}
+
+/**
+ * @brief   Searches for a task to execute.
+ *
+ * @param   state   A pointer to the `ZyanThreadPoolState` struct.
+ * @param   worker  A pointer to the worker of the calling thread or `ZYAN_NULL`.
+ * @param   random  A pointer to the state of the random number generator of the calling thread.
+ *
+ * @return  A pointer to the task or `ZYAN_NULL`, if no task was found.
+ *
+ * The own deque is checked first, followed by the shared queue and the deques of all other
+ * workers, starting at a random victim.
+ */
+static ZyanTask* ZyanThreadPoolFindTask(ZyanThreadPoolState* state, ZyanThreadPoolWorker* worker,
+    ZyanU32* random)
+{
+    ZyanTask* task;
+    if (worker && ((task = ZyanThreadPoolTake(worker))))
+    {
+        return task;
+    }
+
+    if (ZyanAtomicLoad64(&state->queued, ZYAN_MEMORY_ORDER_RELAXED))
+    {
+        ZyanMutexLock(&state->mutex);
+        task = state->head;
+        if (task)
+        {
+            state->head = task->next;
+            if (!state->head)
+            {
+                state->tail = ZYAN_NULL;
+            }
+            ZyanAtomicFetchSub64(&state->queued, 1, ZYAN_MEMORY_ORDER_RELAXED);
+        }
+        ZyanMutexUnlock(&state->mutex);
+        if (task)
+        {
+            return task;
+        }
+    }
+
+    const ZyanUSize count = state->worker_count;
+    const ZyanUSize start = ZyanThreadPoolRandom(random) % count;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ZyanThreadPoolWorker* const victim = &state->workers[(start + i) % count].worker;
+        if ((victim != worker) && ((task = ZyanThreadPoolSteal(victim))))
+        {
+            return task;
+        }
+    }
+
+    return ZYAN_NULL;
+}
+
+/**
+ * @brief   Executes the given task and updates its task group.
+ *
+ * @param   state   A pointer to the `ZyanThreadPoolState` struct.
+ * @param   task    A pointer to the task.
+ */
+static void ZyanThreadPoolExecute(ZyanThreadPoolState* state, ZyanTask* task)
+{
+    // The task might be released as soon as the group is complete
+    ZyanTaskGroup* const group = task->group;
+    task->function(task->user_data);
+
+    if (ZyanAtomicFetchSub64(&group->pending, 1, ZYAN_MEMORY_ORDER_ACQ_REL) == 1)
+    {
+        ZyanThreadPoolNotify(state);
+    }
+}
+
+/**
+ * @brief   Submits the given tasks to the thread pool.
+ *
+ * @param   state   A pointer to the `ZyanThreadPoolState` struct.
+ * @param   group   A pointer to the `ZyanTaskGroup` instance that tracks the tasks.
+ * @param   first   A pointer to the first task.
+ * @param   stride  The distance between two consecutive tasks in bytes.
+ * @param   count   The number of tasks.
+ *
+ * The stride allows to submit tasks that are embedded into larger structs.
+ */
+static void ZyanThreadPoolEnqueue(ZyanThreadPoolState* state, ZyanTaskGroup* group,
+    ZyanTask* first, ZyanUSize stride, ZyanUSize count)
+{
+    if (!count)
+    {
+        return;
+    }
+
+    ZyanAtomicFetchAdd64(&group->pending, count, ZYAN_MEMORY_ORDER_RELAXED);
+
+    ZyanThreadPoolWorker* const worker = ZyanThreadPoolGetCurrentWorker(state);
+    if (worker)
+    {
+        ZyanUSize i = 0;
+        for (; i < count; ++i)
+        {
+            ZyanTask* const task = ZYAN_THREAD_POOL_TASK_AT(first, stride, i);
+            task->group = group;
+            if (!ZyanThreadPoolPush(worker, task))
+            {
+                break;
+            }
+        }
+        if (i)
+        {
+            ZyanThreadPoolNotify(state);
+        }
+        // The deque is full. Executing the remaining tasks right away keeps the memory usage
+        // bounded, while the other workers keep stealing the queued ones.
+        for (; i < count; ++i)
+        {
+            ZyanTask* const task = ZYAN_THREAD_POOL_TASK_AT(first, stride, i);
+            task->group = group;
+            ZyanThreadPoolExecute(state, task);
+        }
+        return;
+    }
+
+    ZyanTask* last = ZYAN_NULL;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ZyanTask* const task = ZYAN_THREAD_POOL_TASK_AT(first, stride, i);
+        task->group = group;
+        task->next  = ZYAN_NULL;
+        if (last)
+        {
+            last->next = task;
+        }
+        last = task;
+    }
+
+    ZyanMutexLock(&state->mutex);
+    if (state->tail)
+    {
+        state->tail->next = first;
+    } else
+    {
+        state->head = first;
+    }
+    state->tail = last;
+    ZyanAtomicFetchAdd64(&state->queued, count, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanMutexUnlock(&state->mutex);
+
+    ZyanThreadPoolNotify(state);
+}
+
+/**
+ * @brief   The entry point of the worker threads.
+ *
+ * @param   argument    A pointer to the `ZyanThreadPoolWorker` struct.
+ */
+ZYAN_THREAD_ROUTINE(ZyanThreadPoolWorkerRoutine, argument)
+{
+    ZyanThreadPoolWorker* const worker = (ZyanThreadPoolWorker*)argument;
+    ZyanThreadPoolState* const state = worker->state;
+    zyan_thread_pool_worker = worker;
+
+    ZyanUSize spins = 0;
+    for (;;)
+    {
+        ZyanTask* const task = ZyanThreadPoolFindTask(state, worker, &worker->random);
+        if (task)
+        {
+            ZyanThreadPoolExecute(state, task);
+            spins = 0;
+            continue;
+        }
+        if (ZyanAtomicLoad32(&state->shutdown, ZYAN_MEMORY_ORDER_ACQUIRE))
+        {
+            break;
+        }
+        if (++spins < ZYAN_THREAD_POOL_SPIN_COUNT)
+        {
+            ZyanAtomicPause();
+            continue;
+        }
+        ZyanThreadPoolSleep(state, ZYAN_NULL);
+        spins = 0;
+    }
+
+    zyan_thread_pool_worker = ZYAN_NULL;
+    ZYAN_THREAD_ROUTINE_RETURN;
+}
+
+/**
+ * @brief   Processes a single `ZyanThreadPoolChunk`.
+ *
+ * @param   user_data   A pointer to the `ZyanThreadPoolChunk` struct.
+ */
+static void ZyanThreadPoolChunkRoutine(void* user_data)
+{
+    const ZyanThreadPoolChunk* const chunk = (const ZyanThreadPoolChunk*)user_data;
+    chunk->function(chunk->begin, chunk->end, chunk->user_data);
+}
+
+/**
+ * @brief   Stops and joins the first `count` workers and releases all resources of the given
+ *          thread pool state.
+ *
+ * @param   state       A pointer to the `ZyanThreadPoolState` struct.
+ * @param   count       The number of workers that were started.
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ *
+ * @return  A zycore status code.
+ */
+static ZyanStatus ZyanThreadPoolShutdown(ZyanThreadPoolState* state, ZyanUSize count,
+    ZyanAllocator* allocator)
+{
+    ZyanAtomicStore32(&state->shutdown, 1, ZYAN_MEMORY_ORDER_RELEASE);
+    ZyanThreadPoolNotify(state);
+
+    ZyanStatus result = ZYAN_STATUS_SUCCESS;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        const ZyanStatus status = ZyanThreadJoin(state->workers[i].worker.thread);
+        if (!ZYAN_SUCCESS(status))
+        {
+            result = status;
+        }
+    }
+
+    ZyanConditionDestroy(&state->condition);
+    ZyanMutexDestroy(&state->mutex);
+
+    const ZyanStatus status = allocator->deallocate(allocator, state->memory, sizeof(ZyanU8),
+        state->memory_size);
+    return ZYAN_SUCCESS(result) ? status : result;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanThreadPoolInit(ZyanThreadPool* pool, ZyanUSize thread_count)
+{
+    return ZyanThreadPoolInitEx(pool, thread_count, ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanThreadPoolInitEx(ZyanThreadPool* pool, ZyanUSize thread_count,
+    ZyanAllocator* allocator)
+{
+    if (!pool || !allocator || (thread_count > ZYAN_THREAD_POOL_MAX_THREADS))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!thread_count)
+    {
+        thread_count = ZYAN_MIN(ZyanThreadGetHardwareConcurrency(), ZYAN_THREAD_POOL_MAX_THREADS);
+    }
+
+    // The state, the workers and the deques share a single allocation. The deques do not have to
+    // be aligned to the cache line size, as they are only accessed by the owner and by thieves.
+    const ZyanUSize state_size  = ZYAN_THREAD_POOL_ALIGN(sizeof(ZyanThreadPoolState));
+    const ZyanUSize worker_size = thread_count * sizeof(ZyanThreadPoolWorkerSlot);
+    const ZyanUSize deque_size  = ZYAN_THREAD_POOL_DEQUE_CAPACITY * sizeof(ZyanAtomicPointer);
+    const ZyanUSize memory_size =
+        state_size + worker_size + thread_count * deque_size + ZYAN_CACHE_LINE_SIZE - 1;
+
+    void* memory;
+    ZYAN_CHECK(allocator->allocate(allocator, &memory, sizeof(ZyanU8), memory_size));
+
+    ZyanU8* const base = (ZyanU8*)(((ZyanUPointer)memory + ZYAN_CACHE_LINE_SIZE - 1) &
+        ~(ZyanUPointer)(ZYAN_CACHE_LINE_SIZE - 1));
+    ZyanThreadPoolState* const state = (ZyanThreadPoolState*)base;
+    ZyanAtomicPointer* const buffers = (ZyanAtomicPointer*)(base + state_size + worker_size);
+
+    ZyanAtomicStore64(&state->epoch, 0, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanAtomicStore64(&state->queued, 0, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanAtomicStore32(&state->sleeping, 0, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanAtomicStore32(&state->shutdown, 0, ZYAN_MEMORY_ORDER_RELAXED);
+    ZyanAtomicStore32(&state->seed, 0x9E3779B9, ZYAN_MEMORY_ORDER_RELAXED);
+    state->head         = ZYAN_NULL;
+    state->tail         = ZYAN_NULL;
+    state->workers      = (ZyanThreadPoolWorkerSlot*)(base + state_size);
+    state->worker_count = thread_count;
+    state->memory       = memory;
+    state->memory_size  = memory_size;
+
+    for (ZyanUSize i = 0; i < thread_count; ++i)
+    {
+        ZyanThreadPoolWorker* const worker = &state->workers[i].worker;
+        ZyanAtomicStore64(&worker->top, 0, ZYAN_MEMORY_ORDER_RELAXED);
+        ZyanAtomicStore64(&worker->bottom, 0, ZYAN_MEMORY_ORDER_RELAXED);
+        worker->buffer = &buffers[i * ZYAN_THREAD_POOL_DEQUE_CAPACITY];
+        worker->state  = state;
+        worker->random = (ZyanU32)(i + 1) * 0x9E3779B9;
+    }
+
+    ZyanStatus status = ZyanMutexInit(&state->mutex);
+    if (!ZYAN_SUCCESS(status))
+    {
+        allocator->deallocate(allocator, memory, sizeof(ZyanU8), memory_size);
+        return status;
+    }
+    status = ZyanConditionInit(&state->condition);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanMutexDestroy(&state->mutex);
+        allocator->deallocate(allocator, memory, sizeof(ZyanU8), memory_size);
+        return status;
+    }
+
+    for (ZyanUSize i = 0; i < thread_count; ++i)
+    {
+        ZyanThreadPoolWorker* const worker = &state->workers[i].worker;
+        status = ZyanThreadCreate(&worker->thread, &ZyanThreadPoolWorkerRoutine, worker);
+        if (!ZYAN_SUCCESS(status))
+        {
+            ZyanThreadPoolShutdown(state, i, allocator);
+            return status;
+        }
+    }
+
+    pool->allocator    = allocator;
+    pool->thread_count = thread_count;
+    pool->state        = state;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanThreadPoolDestroy(ZyanThreadPool* pool)
+{
+    if (!pool || !pool->state)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanStatus status =
+        ZyanThreadPoolShutdown(pool->state, pool->thread_count, pool->allocator);
+    pool->state = ZYAN_NULL;
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Tasks                                                                                          */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanTaskGroupInit(ZyanTaskGroup* group)
+{
+    if (!group)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanAtomicStore64(&group->pending, 0, ZYAN_MEMORY_ORDER_RELAXED);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanThreadPoolSubmit(ZyanThreadPool* pool, ZyanTaskGroup* group, ZyanTask* task)
+{
+    return ZyanThreadPoolSubmitBatch(pool, group, task, 1);
+}
+
+ZyanStatus ZyanThreadPoolSubmitBatch(ZyanThreadPool* pool, ZyanTaskGroup* group,
+    ZyanTask* tasks, ZyanUSize count)
+{
+    if (!pool || !pool->state || !group || (count && !tasks))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        if (!tasks[i].function)
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+    }
+
+    ZyanThreadPoolEnqueue(pool->state, group, tasks, sizeof(ZyanTask), count);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanThreadPoolWait(ZyanThreadPool* pool, ZyanTaskGroup* group)
+{
+    if (!pool || !pool->state || !group)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanThreadPoolState* const state = pool->state;
+    ZyanThreadPoolWorker* const worker = ZyanThreadPoolGetCurrentWorker(state);
+    ZyanU32 random = worker ? worker->random :
+        (ZyanAtomicFetchAdd32(&state->seed, 0x9E3779B9, ZYAN_MEMORY_ORDER_RELAXED) | 1);
+
+    ZyanUSize spins = 0;
+    while (ZyanAtomicLoad64(&group->pending, ZYAN_MEMORY_ORDER_ACQUIRE))
+    {
+        ZyanTask* const task = ZyanThreadPoolFindTask(state, worker, &random);
+        if (task)
+        {
+            ZyanThreadPoolExecute(state, task);
+            spins = 0;
+            continue;
+        }
+        if (++spins < ZYAN_THREAD_POOL_SPIN_COUNT)
+        {
+            ZyanAtomicPause();
+            continue;
+        }
+        ZyanThreadPoolSleep(state, group);
+        spins = 0;
+    }
+
+    if (worker)
+    {
+        worker->random = random;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Parallel algorithms                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanThreadPoolParallelFor(ZyanThreadPool* pool, ZyanUSize begin, ZyanUSize end,
+    ZyanUSize grain_size, ZyanTaskRangeFunction function, void* user_data)
+{
+    if (!pool || !pool->state || !function || (begin > end))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize length = end - begin;
+    ZyanUSize count = pool->thread_count * ZYAN_THREAD_POOL_CHUNKS_PER_THREAD;
+    if (grain_size)
+    {
+        count = ZYAN_MIN(count, length / grain_size + ((length % grain_size) ? 1 : 0));
+    }
+    count = ZYAN_MIN(count, length);
+    if (count <= 1)
+    {
+        if (length)
+        {
+            function(begin, end, user_data);
+        }
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanThreadPoolChunk stack_chunks[ZYAN_THREAD_POOL_STACK_CHUNKS];
+    ZyanThreadPoolChunk* chunks = stack_chunks;
+    if (count > ZYAN_ARRAY_LENGTH(stack_chunks))
+    {
+        ZYAN_CHECK(pool->allocator->allocate(pool->allocator, (void**)&chunks,
+            sizeof(ZyanThreadPoolChunk), count));
+    }
+
+    const ZyanUSize base = length / count;
+    const ZyanUSize remainder = length % count;
+    ZyanUSize offset = begin;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        chunks[i].task.function  = &ZyanThreadPoolChunkRoutine;
+        chunks[i].task.user_data = &chunks[i];
+        chunks[i].begin          = offset;
+        offset += base + ((i < remainder) ? 1 : 0);
+        chunks[i].end            = offset;
+        chunks[i].function       = function;
+        chunks[i].user_data      = user_data;
+    }
+    ZYAN_ASSERT(offset == end);
+
+    // The calling thread processes the first chunk itself
+    ZyanTaskGroup group = ZYAN_TASK_GROUP_INIT;
+    ZyanThreadPoolEnqueue(pool->state, &group, &chunks[1].task, sizeof(ZyanThreadPoolChunk),
+        count - 1);
+    function(chunks[0].begin, chunks[0].end, user_data);
+    ZyanStatus status = ZyanThreadPoolWait(pool, &group);
+
+    if (chunks != stack_chunks)
+    {
+        const ZyanStatus result = pool->allocator->deallocate(pool->allocator, chunks,
+            sizeof(ZyanThreadPoolChunk), count);
+        status = ZYAN_SUCCESS(status) ? result : status;
+    }
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanThreadPoolGetThreadCount(const ZyanThreadPool* pool, ZyanUSize* count)
+{
+    if (!pool || !pool->state || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *count = pool->thread_count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,89 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Trace.h>
+
+#ifdef ZYCORE_TRACING
+
+#include <Zycore/Atomic.h>
+
+#ifdef ZYCORE_TRACING_USDT
+#   include <sys/sdt.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal variables                                                                             */
+/* ============================================================================================== */
+
+/**
+ * @brief   The installed trace handler.
+ */
+static ZyanAtomicPointer zyan_trace_handler = ZYAN_ATOMIC_INIT(ZYAN_NULL);
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+ZyanStatus ZyanTraceSetHandler(const ZyanTraceHandler* handler)
+{
+    if (handler && !handler->callback)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanAtomicStorePointer(&zyan_trace_handler, (void*)handler, ZYAN_MEMORY_ORDER_RELEASE);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+void ZyanTraceEmit(ZyanTraceEvent event, const void* object, ZyanUPointer address,
+    ZyanUPointer previous_address, ZyanUSize size, ZyanUSize previous_size)
+{
+#ifdef ZYCORE_TRACING_USDT
+    DTRACE_PROBE6(zycore, event, (int)event, object, address, previous_address, size,
+        previous_size);
+#endif
+
+    const ZyanTraceHandler* const handler = (const ZyanTraceHandler*)
+        ZyanAtomicLoadPointer(&zyan_trace_handler, ZYAN_MEMORY_ORDER_ACQUIRE);
+    if (!handler)
+    {
+        return;
+    }
+
+    ZyanTraceRecord record;
+    record.event            = event;
+    record.object           = object;
+    record.address          = (const void*)address;
+    record.previous_address = (const void*)previous_address;
+    record.size             = size;
+    record.previous_size    = previous_size;
+    handler->callback(&record, handler->user_data);
+}
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_TRACING */
@@ -0,0 +1,63 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Compiles the whole library as a single translation unit.
+ *
+ * Used instead of the individual source files, if `ZYCORE_UNITY_BUILD` is enabled. As every
+ * function definition is visible to the compiler, calls between the modules (e.g. from
+ * `ZyanBitset` to `ZyanVector`) can be inlined without link-time optimization.
+ *
+ * Projects that are built as a single translation unit themselves can include this file after all
+ * other code to get the same effect for their own calls into Zycore.
+ */
+
+#include "Allocator.c"
+#include "Bitset.c"
+#include "BloomFilter.c"
+#include "BTree.c"
+#include "Cache.c"
+#include "CPU.c"
+#include "ConcurrentVector.c"
+#include "CountMinSketch.c"
+#include "CuckooFilter.c"
+#include "Deque.c"
+#include "Epoch.c"
+#include "Hash.c"
+#include "HyperLogLog.c"
+#include "List.c"
+#include "Lock.c"
+#include "Pool.c"
+#include "PriorityQueue.c"
+#include "RadixTree.c"
+#include "SoAVector.c"
+#include "Trace.c"
+#include "Vector.c"
+
+#ifndef ZYCORE_NO_LIBC
+#   include "ThreadPool.c"
+#endif
@@ -25,7 +25,11 @@
 ***************************************************************************************************/
 
 #include <Zycore/LibC.h>
+#include <Zycore/Trace.h>
 #include <Zycore/Vector.h>
+#ifndef ZYCORE_NO_LIBC
+#   include <Zycore/ThreadPool.h>
+#endif
 
 /* ============================================================================================== */
 /* Internal constants                                                                             */
@@ -35,6 +39,13 @@
 #define ZYAN_VECTOR_GROWTH_FACTOR    2.00f
 #define ZYAN_VECTOR_SHRINK_THRESHOLD 0.25f
 
+/**
+ * @brief   The size of the blocks the parallel algorithms split the vector into.
+ *
+ * The chunks that are assigned to the worker threads always consist of whole blocks.
+ */
+#define ZYAN_VECTOR_PARALLEL_BLOCK_SIZE 16384
+
 /* ============================================================================================== */
 /* Internal macros                                                                                */
 /* ============================================================================================== */
@@ -73,6 +84,22 @@
 #define ZYAN_VECTOR_OFFSET(vector, index) \
     ((void*)((ZyanU8*)(vector)->data + ((index) * (vector)->element_size)))
 
+/**
+ * @brief   Adds the given `value` to the instrumentation counter `field` of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   field   The name of the counter.
+ * @param   value   The value to add.
+ *
+ * Expands to nothing, if Zycore is built without `ZYCORE_VECTOR_STATISTICS`.
+ */
+#ifdef ZYCORE_VECTOR_STATISTICS
+#   define ZYAN_VECTOR_STATISTICS_ADD(vector, field, value) \
+        (vector)->statistics.field += (value)
+#else
+#   define ZYAN_VECTOR_STATISTICS_ADD(vector, field, value)
+#endif
+
 /* ============================================================================================== */
 /* Internal functions                                                                             */
 /* ============================================================================================== */
@@ -119,13 +146,66 @@ static ZyanStatus ZyanVectorReallocate(ZyanVector* vector, ZyanUSize capacity)
         }
     }
 
+#if defined(ZYCORE_VECTOR_STATISTICS) || defined(ZYCORE_TRACING)
+    const ZyanUSize previous_capacity = vector->capacity;
+#endif
+#ifdef ZYCORE_TRACING
+    const void* const previous_data = vector->data;
+#endif
+
     vector->capacity = capacity;
     ZYAN_CHECK(vector->allocator->reallocate(vector->allocator, &vector->data,
         vector->element_size, vector->capacity));
 
+#ifdef ZYCORE_VECTOR_STATISTICS
+    ++vector->statistics.reallocations;
+    if (capacity > previous_capacity)
+    {
+        ++vector->statistics.grow_count;
+        vector->statistics.peak_capacity = ZYAN_MAX(vector->statistics.peak_capacity, capacity);
+    } else
+    {
+        ++vector->statistics.shrink_count;
+    }
+#endif
+
+    ZYAN_TRACE((capacity > previous_capacity) ? ZYAN_TRACE_EVENT_CONTAINER_GROW :
+        ZYAN_TRACE_EVENT_CONTAINER_SHRINK, vector, vector->data, previous_data,
+        capacity * vector->element_size, previous_capacity * vector->element_size);
+
     return ZYAN_STATUS_SUCCESS;
 }
 
+/**
+ * @brief   Grows the internal buffer of the vector, so that it fits at least `size` elements.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   size    The required number of elements.
+ *
+ * @return  A zycore status code.
+ *
+ * Kept out of line, so the insertion functions only contain the fast path.
+ */
+static ZYAN_NOINLINE ZYAN_COLD ZyanStatus ZyanVectorGrow(ZyanVector* vector, ZyanUSize size)
+{
+    return ZyanVectorReallocate(vector, ZYAN_MAX(1, (ZyanUSize)(size * vector->growth_factor)));
+}
+
+/**
+ * @brief   Shrinks the internal buffer of the vector after elements were removed.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ *
+ * @return  A zycore status code.
+ *
+ * Kept out of line, so the deletion functions only contain the fast path.
+ */
+static ZYAN_NOINLINE ZYAN_COLD ZyanStatus ZyanVectorShrink(ZyanVector* vector)
+{
+    return ZyanVectorReallocate(vector,
+        ZYAN_MAX(1, (ZyanUSize)(vector->size * vector->growth_factor)));
+}
+
 /**
  * @brief   Shifts all elements starting at the specified `index` by the amount of `count` to the
  *          left.
@@ -149,6 +229,8 @@ static ZyanStatus ZyanVectorShiftLeft(ZyanVector* vector, ZyanUSize index, ZyanU
     void* const dest     = ZYAN_VECTOR_OFFSET(vector, index);
     const ZyanUSize size = (vector->size - index) * vector->element_size;
     ZYAN_MEMMOVE(dest, source, size);
+    ZYAN_VECTOR_STATISTICS_ADD(vector, shift_left_bytes, size);
+    ZYAN_TRACE(ZYAN_TRACE_EVENT_CONTAINER_COPY, vector, dest, source, size, 0);
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -175,10 +257,137 @@ static ZyanStatus ZyanVectorShiftRight(ZyanVector* vector, ZyanUSize index, Zyan
     void* const dest     = ZYAN_VECTOR_OFFSET(vector, index + count);
     const ZyanUSize size = (vector->size - index) * vector->element_size;
     ZYAN_MEMMOVE(dest, source, size);
+    ZYAN_VECTOR_STATISTICS_ADD(vector, shift_right_bytes, size);
+    ZYAN_TRACE(ZYAN_TRACE_EVENT_CONTAINER_COPY, vector, dest, source, size, 0);
 
     return ZYAN_STATUS_SUCCESS;
 }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Parallel algorithms                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYCORE_NO_LIBC
+
+/**
+ * @brief   Defines the `ZyanVectorParallelContext` struct.
+ */
+typedef struct ZyanVectorParallelContext_
+{
+    /**
+     * @brief   A pointer to the `ZyanVector` instance.
+     */
+    const ZyanVector* vector;
+    /**
+     * @brief   The number of elements per chunk.
+     */
+    ZyanUSize chunk_size;
+    /**
+     * @brief   The element function (`ZyanVectorParallelForEach` only).
+     */
+    ZyanVectorElementFunction function;
+    /**
+     * @brief   The reduce function (`ZyanVectorParallelReduce` only).
+     */
+    ZyanVectorReduceFunction reduce;
+    /**
+     * @brief   The accumulators of all chunks (`ZyanVectorParallelReduce` only).
+     */
+    ZyanU8* partials;
+    /**
+     * @brief   The distance between two accumulators in bytes.
+     */
+    ZyanUSize partial_stride;
+    /**
+     * @brief   The identity value of the reduction.
+     */
+    const void* identity;
+    /**
+     * @brief   The size of the identity value in bytes.
+     */
+    ZyanUSize result_size;
+    /**
+     * @brief   The user data pointer.
+     */
+    void* user_data;
+} ZyanVectorParallelContext;
+
+/**
+ * @brief   Calculates the number of elements per chunk for the parallel algorithms.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   pool    A pointer to the `ZyanThreadPool` instance or `ZYAN_NULL`.
+ *
+ * @return  The number of elements per chunk. A value greater than or equal to the size of the
+ *          vector indicates that the vector should be processed on the calling thread.
+ */
+static ZyanUSize ZyanVectorParallelChunkSize(const ZyanVector* vector, const ZyanThreadPool* pool)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(vector->element_size);
+
+    const ZyanUSize block_size =
+        ZYAN_MAX(1, ZYAN_VECTOR_PARALLEL_BLOCK_SIZE / vector->element_size);
+    const ZyanUSize block_count = vector->size / block_size + ((vector->size % block_size) ? 1 : 0);
+    if (!pool || (pool->thread_count < 2) || (block_count < 2))
+    {
+        return vector->size;
+    }
+
+    // A few chunks per thread allow the pool to balance the load between the threads
+    const ZyanUSize chunk_count = ZYAN_MIN(block_count, pool->thread_count * 4);
+    const ZyanUSize blocks_per_chunk =
+        block_count / chunk_count + ((block_count % chunk_count) ? 1 : 0);
+
+    return blocks_per_chunk * block_size;
+}
+
+/**
+ * @brief   Invokes the element function for all elements of the chunks `[begin, end)`.
+ *
+ * @param   begin       The index of the first chunk.
+ * @param   end         The index after the last chunk.
+ * @param   user_data   A pointer to the `ZyanVectorParallelContext` struct.
+ */
+static void ZyanVectorParallelForEachChunks(ZyanUSize begin, ZyanUSize end, void* user_data)
+{
+    const ZyanVectorParallelContext* const context = (const ZyanVectorParallelContext*)user_data;
+    const ZyanVector* const vector = context->vector;
+
+    const ZyanUSize last = ZYAN_MIN(vector->size, end * context->chunk_size);
+    for (ZyanUSize i = begin * context->chunk_size; i < last; ++i)
+    {
+        context->function(ZYAN_VECTOR_OFFSET(vector, i), i, context->user_data);
+    }
+}
+
+/**
+ * @brief   Reduces every chunk in `[begin, end)` into its own accumulator.
+ *
+ * @param   begin       The index of the first chunk.
+ * @param   end         The index after the last chunk.
+ * @param   user_data   A pointer to the `ZyanVectorParallelContext` struct.
+ */
+static void ZyanVectorParallelReduceChunks(ZyanUSize begin, ZyanUSize end, void* user_data)
+{
+    const ZyanVectorParallelContext* const context = (const ZyanVectorParallelContext*)user_data;
+    const ZyanVector* const vector = context->vector;
+
+    for (ZyanUSize chunk = begin; chunk < end; ++chunk)
+    {
+        void* const accumulator = context->partials + chunk * context->partial_stride;
+        ZYAN_MEMCPY(accumulator, context->identity, context->result_size);
+
+        const ZyanUSize last = ZYAN_MIN(vector->size, (chunk + 1) * context->chunk_size);
+        for (ZyanUSize i = chunk * context->chunk_size; i < last; ++i)
+        {
+            context->reduce(accumulator, ZYAN_VECTOR_OFFSET(vector, i), context->user_data);
+        }
+    }
+}
+
+#endif /* ZYCORE_NO_LIBC */
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -213,6 +422,9 @@ ZyanStatus ZyanVectorInitEx(ZyanVector* vector, ZyanUSize element_size, ZyanUSiz
     vector->capacity         = ZYAN_MAX(ZYAN_VECTOR_MIN_CAPACITY, capacity);
     vector->element_size     = element_size;
     vector->data             = ZYAN_NULL;
+#ifdef ZYCORE_VECTOR_STATISTICS
+    ZyanVectorResetStatistics(vector);
+#endif
 
     return allocator->allocate(vector->allocator, &vector->data, vector->element_size,
         vector->capacity);
@@ -233,6 +445,9 @@ ZyanStatus ZyanVectorInitBuffer(ZyanVector* vector, ZyanUSize element_size,
     vector->capacity         = capacity;
     vector->element_size     = element_size;
     vector->data             = buffer;
+#ifdef ZYCORE_VECTOR_STATISTICS
+    ZyanVectorResetStatistics(vector);
+#endif
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -261,13 +476,13 @@ ZyanStatus ZyanVectorDestroy(ZyanVector* vector)
 /* Lookup                                                                                         */
 /* ---------------------------------------------------------------------------------------------- */
 
-ZyanStatus ZyanVectorGet(const ZyanVector* vector, ZyanUSize index, void** element)
+ZYAN_HOT ZyanStatus ZyanVectorGet(const ZyanVector* vector, ZyanUSize index, void** element)
 {
-    if (!vector || !element)
+    if (ZYAN_UNLIKELY(!vector || !element))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index >= vector->size)
+    if (ZYAN_UNLIKELY(index >= vector->size))
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
@@ -280,13 +495,14 @@ ZyanStatus ZyanVectorGet(const ZyanVector* vector, ZyanUSize index, void** eleme
     return ZYAN_STATUS_SUCCESS;
 }
 
-ZyanStatus ZyanVectorGetConst(const ZyanVector* vector, ZyanUSize index, const void** element)
+ZYAN_HOT ZyanStatus ZyanVectorGetConst(const ZyanVector* vector, ZyanUSize index,
+    const void** element)
 {
-    if (!vector || !element)
+    if (ZYAN_UNLIKELY(!vector || !element))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index >= vector->size)
+    if (ZYAN_UNLIKELY(index >= vector->size))
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
@@ -305,11 +521,11 @@ ZyanStatus ZyanVectorGetConst(const ZyanVector* vector, ZyanUSize index, const v
 
 ZyanStatus ZyanVectorAssign(ZyanVector* vector, ZyanUSize index, const void* element)
 {
-    if (!vector || !element)
+    if (ZYAN_UNLIKELY(!vector || !element))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index >= vector->size)
+    if (ZYAN_UNLIKELY(index >= vector->size))
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
@@ -327,9 +543,9 @@ ZyanStatus ZyanVectorAssign(ZyanVector* vector, ZyanUSize index, const void* ele
 /* Insertion                                                                                      */
 /* ---------------------------------------------------------------------------------------------- */
 
-ZyanStatus ZyanVectorPush(ZyanVector* vector, const void* element)
+ZYAN_HOT ZyanStatus ZyanVectorPush(ZyanVector* vector, const void* element)
 {
-    if (!vector || !element)
+    if (ZYAN_UNLIKELY(!vector || !element))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
@@ -337,10 +553,9 @@ ZyanStatus ZyanVectorPush(ZyanVector* vector, const void* element)
     ZYAN_ASSERT(vector->element_size);
     ZYAN_ASSERT(vector->data);
 
-    if (ZYAN_VECTOR_SHOULD_GROW(vector->size + 1, vector->capacity))
+    if (ZYAN_UNLIKELY(ZYAN_VECTOR_SHOULD_GROW(vector->size + 1, vector->capacity)))
     {
-        ZYAN_CHECK(ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)((vector->size + 1) * vector->growth_factor))));
+        ZYAN_CHECK(ZyanVectorGrow(vector, vector->size + 1));
     }
 
     void* const offset = ZYAN_VECTOR_OFFSET(vector, vector->size);
@@ -359,11 +574,11 @@ ZyanStatus ZyanVectorInsert(ZyanVector* vector, ZyanUSize index, const void* ele
 ZyanStatus ZyanVectorInsertElements(ZyanVector* vector, ZyanUSize index, const void* elements,
     ZyanUSize count)
 {
-    if (!vector || !elements || !count)
+    if (ZYAN_UNLIKELY(!vector || !elements || !count))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index > vector->size)
+    if (ZYAN_UNLIKELY(index > vector->size))
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
@@ -371,10 +586,9 @@ ZyanStatus ZyanVectorInsertElements(ZyanVector* vector, ZyanUSize index, const v
     ZYAN_ASSERT(vector->element_size);
     ZYAN_ASSERT(vector->data);
 
-    if (ZYAN_VECTOR_SHOULD_GROW(vector->size + count, vector->capacity))
+    if (ZYAN_UNLIKELY(ZYAN_VECTOR_SHOULD_GROW(vector->size + count, vector->capacity)))
     {
-        ZYAN_CHECK(ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)((vector->size + count) * vector->growth_factor))));
+        ZYAN_CHECK(ZyanVectorGrow(vector, vector->size + count));
     }
 
     if (index < vector->size)
@@ -400,11 +614,11 @@ ZyanStatus ZyanVectorDelete(ZyanVector* vector, ZyanUSize index)
 
 ZyanStatus ZyanVectorDeleteElements(ZyanVector* vector, ZyanUSize index, ZyanUSize count)
 {
-    if (!vector || !count)
+    if (ZYAN_UNLIKELY(!vector || !count))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index >= vector->size)
+    if (ZYAN_UNLIKELY(index >= vector->size))
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
@@ -415,10 +629,10 @@ ZyanStatus ZyanVectorDeleteElements(ZyanVector* vector, ZyanUSize index, ZyanUSi
     }
 
     vector->size -= count;
-    if (ZYAN_VECTOR_SHOULD_SHRINK(vector->size, vector->capacity, vector->shrink_threshold))
+    if (ZYAN_UNLIKELY(ZYAN_VECTOR_SHOULD_SHRINK(vector->size, vector->capacity,
+        vector->shrink_threshold)))
     {
-        return ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)(vector->size * vector->growth_factor)));
+        return ZyanVectorShrink(vector);
     }
 
     return ZYAN_STATUS_SUCCESS;
@@ -426,20 +640,20 @@ ZyanStatus ZyanVectorDeleteElements(ZyanVector* vector, ZyanUSize index, ZyanUSi
 
 ZyanStatus ZyanVectorPop(ZyanVector* vector)
 {
-    if (!vector)
+    if (ZYAN_UNLIKELY(!vector))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (vector->size == 0)
+    if (ZYAN_UNLIKELY(vector->size == 0))
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
     --vector->size;
-    if (ZYAN_VECTOR_SHOULD_SHRINK(vector->size, vector->capacity, vector->shrink_threshold))
+    if (ZYAN_UNLIKELY(ZYAN_VECTOR_SHOULD_SHRINK(vector->size, vector->capacity,
+        vector->shrink_threshold)))
     {
-        return ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)(vector->size * vector->growth_factor)));
+        return ZyanVectorShrink(vector);
     }
 
     return ZYAN_STATUS_SUCCESS;
@@ -520,6 +734,143 @@ ZyanStatus ZyanVectorCapacity(const ZyanVector* vector, ZyanUSize* capacity)
     return ZYAN_STATUS_SUCCESS;
 }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Statistics                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifdef ZYCORE_VECTOR_STATISTICS
+
+ZyanStatus ZyanVectorGetStatistics(const ZyanVector* vector, ZyanVectorStatistics* statistics)
+{
+    if (!vector || !statistics)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *statistics = vector->statistics;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorResetStatistics(ZyanVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    vector->statistics.reallocations     = 0;
+    vector->statistics.grow_count        = 0;
+    vector->statistics.shrink_count      = 0;
+    vector->statistics.shift_left_bytes  = 0;
+    vector->statistics.shift_right_bytes = 0;
+    vector->statistics.peak_capacity     = vector->capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#endif /* ZYCORE_VECTOR_STATISTICS */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Parallel algorithms                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYCORE_NO_LIBC
+
+ZyanStatus ZyanVectorParallelForEach(ZyanVector* vector, ZyanThreadPool* pool,
+    ZyanVectorElementFunction function, void* user_data)
+{
+    if (!vector || !function)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanVectorParallelContext context;
+    context.vector     = vector;
+    context.chunk_size = ZyanVectorParallelChunkSize(vector, pool);
+    context.function   = function;
+    context.user_data  = user_data;
+
+    if (context.chunk_size >= vector->size)
+    {
+        for (ZyanUSize i = 0; i < vector->size; ++i)
+        {
+            function(ZYAN_VECTOR_OFFSET(vector, i), i, user_data);
+        }
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanUSize chunk_count = vector->size / context.chunk_size +
+        ((vector->size % context.chunk_size) ? 1 : 0);
+
+    return ZyanThreadPoolParallelFor(pool, 0, chunk_count, 1, &ZyanVectorParallelForEachChunks,
+        &context);
+}
+
+ZyanStatus ZyanVectorParallelReduce(const ZyanVector* vector, ZyanThreadPool* pool,
+    void* result, ZyanUSize result_size, const void* identity, ZyanVectorReduceFunction reduce,
+    ZyanVectorReduceFunction combine, void* user_data)
+{
+    if (!vector || !result || !result_size || !identity || !reduce || !combine)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_MEMCPY(result, identity, result_size);
+
+    const ZyanUSize chunk_size = ZyanVectorParallelChunkSize(vector, pool);
+    if (chunk_size >= vector->size)
+    {
+        for (ZyanUSize i = 0; i < vector->size; ++i)
+        {
+            reduce(result, ZYAN_VECTOR_OFFSET(vector, i), user_data);
+        }
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanUSize chunk_count = vector->size / chunk_size +
+        ((vector->size % chunk_size) ? 1 : 0);
+
+    // Every accumulator gets its own cache lines to avoid false sharing between the threads
+    const ZyanUSize stride = (result_size + ZYAN_CACHE_LINE_SIZE - 1) &
+        ~(ZyanUSize)(ZYAN_CACHE_LINE_SIZE - 1);
+    if (chunk_count > ((ZyanUSize)-1 - ZYAN_CACHE_LINE_SIZE) / stride)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    const ZyanUSize buffer_size = chunk_count * stride + ZYAN_CACHE_LINE_SIZE - 1;
+    void* buffer;
+    ZYAN_CHECK(pool->allocator->allocate(pool->allocator, &buffer, sizeof(ZyanU8), buffer_size));
+
+    ZyanVectorParallelContext context;
+    context.vector         = vector;
+    context.chunk_size     = chunk_size;
+    context.reduce         = reduce;
+    context.partials       = (ZyanU8*)(((ZyanUPointer)buffer + ZYAN_CACHE_LINE_SIZE - 1) &
+        ~(ZyanUPointer)(ZYAN_CACHE_LINE_SIZE - 1));
+    context.partial_stride = stride;
+    context.identity       = identity;
+    context.result_size    = result_size;
+    context.user_data      = user_data;
+
+    const ZyanStatus status = ZyanThreadPoolParallelFor(pool, 0, chunk_count, 1,
+        &ZyanVectorParallelReduceChunks, &context);
+    if (ZYAN_SUCCESS(status))
+    {
+        for (ZyanUSize i = 0; i < chunk_count; ++i)
+        {
+            combine(result, context.partials + i * stride, user_data);
+        }
+    }
+
+    ZYAN_CHECK(pool->allocator->deallocate(pool->allocator, buffer, sizeof(ZyanU8),
+        buffer_size));
+
+    return status;
+}
+
+#endif /* ZYCORE_NO_LIBC */
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
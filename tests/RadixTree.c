@@ -0,0 +1,212 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `RadixTree` implementation.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Defines.h>
+#include <Zycore/RadixTree.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Helper macros                                                                                  */
+/* ============================================================================================== */
+
+/**
+ * @brief   Prints the failed `condition` and leaves the current test, if it does not hold.
+ */
+#define TEST_CHECK(condition) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            return ZYAN_FALSE; \
+        } \
+    } while (0)
+
+/* ============================================================================================== */
+/* Failing allocator                                                                              */
+/* ============================================================================================== */
+
+/**
+ * @brief   Makes every following allocation fail, if set.
+ */
+static ZyanBool fail_allocations = ZYAN_FALSE;
+
+static ZyanStatus AllocatorAllocate(ZyanAllocator* allocator, void** p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_UNUSED(allocator);
+
+    if (fail_allocations)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    *p = malloc(element_size * n);
+    if (!*p)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus AllocatorReallocate(ZyanAllocator* allocator, void** p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_UNUSED(allocator);
+
+    if (fail_allocations)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    void* const x = realloc(*p, element_size * n);
+    if (!x)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    *p = x;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus AllocatorDeallocate(ZyanAllocator* allocator, void* p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_UNUSED(allocator);
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    free(p);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+/**
+ * @brief   Removes all entries of an inner node, while some of the shrink allocations fail.
+ *
+ * @param   nested  `ZYAN_TRUE` to place the node below the root or `ZYAN_FALSE` to use the root
+ *                  itself.
+ *
+ * @return  `ZYAN_TRUE`, if the test passed or `ZYAN_FALSE`, if not.
+ *
+ * The `Node16` keeps its type, as long as the `Node4` allocation fails. Once the allocation
+ * succeeds again, it is shrunk into a `Node4` with a single child and without a leaf. Removing
+ * the last child must release that node instead of leaving a dangling leaf reference behind.
+ */
+static ZyanBool TestRemoveAfterFailedShrink(ZyanBool nested)
+{
+    ZyanAllocator allocator;
+    TEST_CHECK(ZYAN_SUCCESS(ZyanAllocatorInit(&allocator, &AllocatorAllocate,
+        &AllocatorReallocate, &AllocatorDeallocate)));
+
+    ZyanRadixTree tree;
+    TEST_CHECK(ZYAN_SUCCESS(ZyanRadixTreeInitEx(&tree, sizeof(ZyanU32), &allocator)));
+
+    // Insert 5 keys that share the same inner node, which is a `Node16` afterwards
+    const ZyanU8 sibling = 'y';
+    ZyanU32 value = 0xFFFFFFFF;
+    if (nested)
+    {
+        TEST_CHECK(ZYAN_SUCCESS(ZyanRadixTreeInsert(&tree, &sibling, 1, &value)));
+    }
+    ZyanU8 keys[5][2];
+    const ZyanUSize offset = nested ? 1 : 0;
+    for (ZyanU32 i = 0; i < ZYAN_ARRAY_LENGTH(keys); ++i)
+    {
+        keys[i][0] = 'x';
+        keys[i][offset] = (ZyanU8)('0' + i);
+        TEST_CHECK(ZYAN_SUCCESS(ZyanRadixTreeInsert(&tree, keys[i], offset + 1, &i)));
+    }
+
+    // The node drops below the shrink threshold while allocations fail
+    TEST_CHECK(ZyanRadixTreeRemove(&tree, keys[4], offset + 1) == ZYAN_STATUS_TRUE);
+    TEST_CHECK(ZyanRadixTreeRemove(&tree, keys[3], offset + 1) == ZYAN_STATUS_TRUE);
+    fail_allocations = ZYAN_TRUE;
+    const ZyanStatus status = ZyanRadixTreeRemove(&tree, keys[2], offset + 1);
+    fail_allocations = ZYAN_FALSE;
+    TEST_CHECK(status == ZYAN_STATUS_TRUE);
+
+    // The shrink succeeds now and leaves a leafless `Node4` with a single child
+    TEST_CHECK(ZyanRadixTreeRemove(&tree, keys[1], offset + 1) == ZYAN_STATUS_TRUE);
+    TEST_CHECK(ZyanRadixTreeRemove(&tree, keys[0], offset + 1) == ZYAN_STATUS_TRUE);
+
+    ZyanUSize size;
+    TEST_CHECK(ZYAN_SUCCESS(ZyanRadixTreeSize(&tree, &size)));
+    TEST_CHECK(size == offset);
+    void* result;
+    for (ZyanUSize i = 0; i < ZYAN_ARRAY_LENGTH(keys); ++i)
+    {
+        TEST_CHECK(ZyanRadixTreeGet(&tree, keys[i], offset + 1, &result) == ZYAN_STATUS_FALSE);
+    }
+    if (nested)
+    {
+        TEST_CHECK(ZyanRadixTreeGet(&tree, &sibling, 1, &result) == ZYAN_STATUS_TRUE);
+        TEST_CHECK(*(const ZyanU32*)result == value);
+        TEST_CHECK(ZyanRadixTreeRemove(&tree, &sibling, 1) == ZYAN_STATUS_TRUE);
+    }
+    TEST_CHECK(!tree.root);
+
+    // The tree is still usable
+    value = 42;
+    TEST_CHECK(ZYAN_SUCCESS(ZyanRadixTreeInsert(&tree, keys[0], offset + 1, &value)));
+    TEST_CHECK(ZyanRadixTreeGet(&tree, keys[0], offset + 1, &result) == ZYAN_STATUS_TRUE);
+    TEST_CHECK(*(const ZyanU32*)result == value);
+
+    TEST_CHECK(ZYAN_SUCCESS(ZyanRadixTreeDestroy(&tree)));
+
+    return ZYAN_TRUE;
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(void)
+{
+    if (!TestRemoveAfterFailedShrink(ZYAN_FALSE))
+    {
+        return EXIT_FAILURE;
+    }
+    if (!TestRemoveAfterFailedShrink(ZYAN_TRUE))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* ============================================================================================== */